@@ -0,0 +1,79 @@
+/**
+ * @file bench_async_result.cpp
+ * @brief Micro benchmarks of AsyncResult against `std::future`.
+ *
+ * Both complete an operation and read its result in the same thread, so the timings are the cost of the shared
+ * state: `std::promise` allocates it with a mutex and a condition variable, AsyncPromise with two atomics. The
+ * chained variants add one continuation (`std::future` has none, the continuation is called by the consumer).
+ */
+#include "lib/async_result.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <future>
+
+namespace
+{
+
+using interview::library::AsyncPromise;
+using interview::library::AsyncResult;
+using interview::library::Result;
+
+// --- Complete, then read ---
+
+void BM_StdFuture(benchmark::State& state)
+{
+    std::uint32_t value = 1U;
+    for (auto _ : state)
+    {
+        std::promise<Result<std::uint32_t>> promise;
+        std::future<Result<std::uint32_t>> future = promise.get_future();
+        promise.set_value(Result<std::uint32_t>(value));
+        benchmark::DoNotOptimize(future.get());
+    }
+}
+BENCHMARK(BM_StdFuture);
+
+void BM_AsyncResult(benchmark::State& state)
+{
+    std::uint32_t value = 1U;
+    for (auto _ : state)
+    {
+        AsyncPromise<std::uint32_t> promise;
+        AsyncResult<std::uint32_t> async = promise.getAsyncResult();
+        promise.setResult(value);
+        benchmark::DoNotOptimize(async.get());
+    }
+}
+BENCHMARK(BM_AsyncResult);
+
+// --- Attach a continuation, complete, then read ---
+
+void BM_StdFutureChained(benchmark::State& state)
+{
+    std::uint32_t value = 1U;
+    for (auto _ : state)
+    {
+        std::promise<Result<std::uint32_t>> promise;
+        std::future<Result<std::uint32_t>> future = promise.get_future();
+        promise.set_value(Result<std::uint32_t>(value));
+        benchmark::DoNotOptimize(future.get().map([](std::uint32_t v) { return v + 1U; }));
+    }
+}
+BENCHMARK(BM_StdFutureChained);
+
+void BM_AsyncResultChained(benchmark::State& state)
+{
+    std::uint32_t value = 1U;
+    for (auto _ : state)
+    {
+        AsyncPromise<std::uint32_t> promise;
+        AsyncResult<std::uint32_t> async = promise.getAsyncResult().then([](std::uint32_t v) { return v + 1U; });
+        promise.setResult(value);
+        benchmark::DoNotOptimize(async.get());
+    }
+}
+BENCHMARK(BM_AsyncResultChained);
+
+}  // namespace
@@ -0,0 +1,66 @@
+/**
+ * @file bench_atomic_result_slot.cpp
+ * @brief Micro benchmarks of an AtomicResultSlot against a `Result` guarded by a mutex.
+ *
+ * Each iteration hands one result over: the producer stores it, the consumer checks for it and moves it out. The
+ * threads are not contended, so the benchmarks measure the cost of the synchronization itself.
+ */
+#include "lib/atomic_result_slot.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <mutex>
+
+namespace
+{
+
+using interview::library::AtomicResultSlot;
+using interview::library::Result;
+using interview::library::Status;
+
+/// @brief Hand-off of the baseline, a `Result` member guarded by a mutex.
+struct GuardedResult
+{
+    std::mutex mutex_;
+    bool ready_{false};
+    Result<std::uint64_t> result_{Status::ERROR};
+};
+
+void BM_MutexHandOff(benchmark::State& state)
+{
+    GuardedResult slot;
+    std::uint64_t value = 0U;
+    for (auto _ : state)
+    {
+        {
+            std::lock_guard<std::mutex> lock(slot.mutex_);
+            slot.result_ = Result<std::uint64_t>(value++);
+            slot.ready_ = true;
+        }
+        std::lock_guard<std::mutex> lock(slot.mutex_);
+        if (slot.ready_)
+        {
+            slot.ready_ = false;
+            benchmark::DoNotOptimize(Result<std::uint64_t>(std::move(slot.result_)));
+        }
+    }
+}
+BENCHMARK(BM_MutexHandOff);
+
+void BM_AtomicSlotHandOff(benchmark::State& state)
+{
+    AtomicResultSlot<std::uint64_t> slot;
+    std::uint64_t value = 0U;
+    for (auto _ : state)
+    {
+        slot.publish(value++);
+        if (slot.ready())
+        {
+            benchmark::DoNotOptimize(slot.take());
+        }
+    }
+}
+BENCHMARK(BM_AtomicSlotHandOff);
+
+}  // namespace
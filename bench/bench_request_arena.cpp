@@ -0,0 +1,71 @@
+/**
+ * @file bench_request_arena.cpp
+ * @brief Micro benchmarks of results allocated in a RequestArena.
+ *
+ * `greetName` of the example builds a `Result<std::string>` longer than the small string buffer, which costs a
+ * malloc / free pair per call. The arena variant builds a `Result<std::pmr::string>` in a RequestArena reset after
+ * every request, as a request handler would.
+ */
+#include "lib/request_arena.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <memory_resource>
+#include <string>
+
+namespace
+{
+
+using interview::library::createError;
+using interview::library::inPlace;
+using interview::library::RequestArena;
+using interview::library::Result;
+using interview::library::Status;
+
+const std::string kName = "Daniel from the benchmark";
+
+Result<std::string> greetName(const std::string& name)
+{
+    if (name.empty())
+    {
+        return createError(Status::INVALID_ARG);
+    }
+    Result<std::string> greeting(inPlace);
+    greeting->reserve(name.size() + 8U);
+    greeting->append("Hello, ").append(name).append("!");
+    return greeting;
+}
+
+Result<std::pmr::string> greetName(const std::string& name, RequestArena& arena)
+{
+    if (name.empty())
+    {
+        return createError(Status::INVALID_ARG);
+    }
+    Result<std::pmr::string> greeting = arena.makeResult<std::pmr::string>();
+    greeting->reserve(name.size() + 8U);
+    greeting->append("Hello, ").append(name).append("!");
+    return greeting;
+}
+
+void BM_GreetNameHeap(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(greetName(kName));
+    }
+}
+BENCHMARK(BM_GreetNameHeap);
+
+void BM_GreetNameArena(benchmark::State& state)
+{
+    RequestArena arena;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(greetName(kName, arena));
+        arena.reset();
+    }
+}
+BENCHMARK(BM_GreetNameArena);
+
+}  // namespace
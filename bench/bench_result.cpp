@@ -0,0 +1,561 @@
+/**
+ * @file bench_result.cpp
+ * @brief Micro benchmarks of the Result class.
+ *
+ * Measures construction, copy/move, access and propagation of `Result` and compares it against the common
+ * alternatives: raw return values, `std::optional` and an out-parameter together with a returned status.
+ * Functions marked with `BENCH_NOINLINE` model a call boundary, so the cost of returning the object is measured
+ * and not optimized away after inlining.
+ */
+#include "lib/result.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#define BENCH_NOINLINE __attribute__((noinline))
+
+namespace
+{
+
+using interview::library::createError;
+using interview::library::Result;
+using interview::library::Status;
+
+constexpr std::int64_t kChainDepth = 16;
+
+// --- Functions under test (same logic as `divideNumbers` from the example) ---
+
+BENCH_NOINLINE std::uint32_t divideRaw(std::uint32_t a, std::uint32_t b)
+{
+    return (b == 0U) ? 0U : a / b;
+}
+
+BENCH_NOINLINE Status divideOutParam(std::uint32_t a, std::uint32_t b, std::uint32_t& out)
+{
+    if (b == 0U)
+    {
+        return Status::INVALID_ARG;
+    }
+    out = a / b;
+    return Status::OK;
+}
+
+BENCH_NOINLINE std::optional<std::uint32_t> divideOptional(std::uint32_t a, std::uint32_t b)
+{
+    if (b == 0U)
+    {
+        return std::nullopt;
+    }
+    return a / b;
+}
+
+BENCH_NOINLINE Result<std::uint32_t> divideResult(std::uint32_t a, std::uint32_t b)
+{
+    if (b == 0U)
+    {
+        return createError(Status::INVALID_ARG);
+    }
+    return static_cast<std::uint32_t>(a / b);
+}
+
+// --- Deep call chains, every level propagates the error of the level below ---
+
+BENCH_NOINLINE std::uint32_t chainRaw(std::uint32_t value, std::uint32_t divisor, std::int64_t depth)
+{
+    if (depth == 0)
+    {
+        return divideRaw(value, divisor);
+    }
+    return chainRaw(value, divisor, depth - 1) + 1U;
+}
+
+BENCH_NOINLINE Status chainOutParam(std::uint32_t value, std::uint32_t divisor, std::int64_t depth, std::uint32_t& out)
+{
+    if (depth == 0)
+    {
+        return divideOutParam(value, divisor, out);
+    }
+    const Status status = chainOutParam(value, divisor, depth - 1, out);
+    if (status != Status::OK)
+    {
+        return status;
+    }
+    out += 1U;
+    return Status::OK;
+}
+
+BENCH_NOINLINE std::optional<std::uint32_t> chainOptional(std::uint32_t value,
+                                                         std::uint32_t divisor,
+                                                         std::int64_t depth)
+{
+    if (depth == 0)
+    {
+        return divideOptional(value, divisor);
+    }
+    const auto result = chainOptional(value, divisor, depth - 1);
+    if (!result)
+    {
+        return std::nullopt;
+    }
+    return *result + 1U;
+}
+
+BENCH_NOINLINE Result<std::uint32_t> chainResult(std::uint32_t value, std::uint32_t divisor, std::int64_t depth)
+{
+    if (depth == 0)
+    {
+        return divideResult(value, divisor);
+    }
+    const auto result = chainResult(value, divisor, depth - 1);
+    if (!result)
+    {
+        return createError(result.getError());
+    }
+    return static_cast<std::uint32_t>(result.getValue() + 1U);
+}
+
+// --- Chains of fallible steps: hand-written checks vs combinators ---
+
+inline Result<std::uint32_t> checkedHalve(std::uint32_t value)
+{
+    if ((value & 1U) != 0U)
+    {
+        return createError(Status::INVALID_ARG);
+    }
+    return value / 2U;
+}
+
+BENCH_NOINLINE Result<std::uint32_t> stepsManual(std::uint32_t value)
+{
+    const auto first = checkedHalve(value);
+    if (!first)
+    {
+        return createError(first.getError());
+    }
+    const auto second = checkedHalve(first.getValue());
+    if (!second)
+    {
+        return createError(second.getError());
+    }
+    const auto third = checkedHalve(second.getValue());
+    if (!third)
+    {
+        return createError(third.getError());
+    }
+    return static_cast<std::uint32_t>(third.getValue() + 1U);
+}
+
+/**
+ * Inspect the generated code with
+ *   objdump -d --no-show-raw-insn -C bazel-bin/bench_result | grep -A30 "stepsCombinators"
+ * each `andThen` inlines into one test of the step condition and no intermediate `Result` is materialized.
+ */
+BENCH_NOINLINE Result<std::uint32_t> stepsCombinators(std::uint32_t value)
+{
+    return checkedHalve(value)
+        .andThen(checkedHalve)
+        .andThen(checkedHalve)
+        .map([](std::uint32_t halved) { return halved + 1U; });
+}
+
+void BM_StepsManual(benchmark::State& state)
+{
+    std::uint32_t value = static_cast<std::uint32_t>(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value);
+        benchmark::DoNotOptimize(stepsManual(value));
+    }
+}
+BENCHMARK(BM_StepsManual)->Arg(6)->Arg(8);
+
+void BM_StepsCombinators(benchmark::State& state)
+{
+    std::uint32_t value = static_cast<std::uint32_t>(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value);
+        benchmark::DoNotOptimize(stepsCombinators(value));
+    }
+}
+BENCHMARK(BM_StepsCombinators)->Arg(6)->Arg(8);
+
+// --- Construction ---
+
+void BM_ConstructRaw(benchmark::State& state)
+{
+    std::uint32_t a = 42U;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        std::uint32_t value = a;
+        benchmark::DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_ConstructRaw);
+
+void BM_ConstructOptional(benchmark::State& state)
+{
+    std::uint32_t a = 42U;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        std::optional<std::uint32_t> value(a);
+        benchmark::DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_ConstructOptional);
+
+void BM_ConstructResultFromValue(benchmark::State& state)
+{
+    std::uint32_t a = 42U;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(a);
+        Result<std::uint32_t> result(a);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ConstructResultFromValue);
+
+void BM_ConstructResultFromError(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        Result<std::uint32_t> result = createError(Status::INVALID_ARG);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ConstructResultFromError);
+
+void BM_ConstructResultString(benchmark::State& state)
+{
+    const std::string payload(64, 'x');
+    for (auto _ : state)
+    {
+        Result<std::string> result(payload);
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_ConstructResultString);
+
+// --- Large payload: temporary moved in vs constructed in place ---
+
+struct LargeMessage
+{
+    LargeMessage(std::uint32_t id, const std::string& body) : id_(id), body_(body) {}
+
+    std::uint32_t id_;
+    std::array<std::uint64_t, 32> header_{};
+    std::string body_;
+};
+
+BENCH_NOINLINE Result<LargeMessage> buildMessageMoved(std::uint32_t id, const std::string& body)
+{
+    return LargeMessage(id, body);
+}
+
+BENCH_NOINLINE Result<LargeMessage> buildMessageInPlace(std::uint32_t id, const std::string& body)
+{
+    return interview::library::makeResult<LargeMessage>(id, body);
+}
+
+void BM_ConstructLargeMoved(benchmark::State& state)
+{
+    const std::string body(64, 'x');
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(buildMessageMoved(1U, body));
+    }
+}
+BENCHMARK(BM_ConstructLargeMoved);
+
+void BM_ConstructLargeInPlace(benchmark::State& state)
+{
+    const std::string body(64, 'x');
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(buildMessageInPlace(1U, body));
+    }
+}
+BENCHMARK(BM_ConstructLargeInPlace);
+
+// --- Copy / move ---
+
+void BM_CopyResult(benchmark::State& state)
+{
+    const Result<std::uint32_t> original(42U);
+    for (auto _ : state)
+    {
+        Result<std::uint32_t> copy(original);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_CopyResult);
+
+void BM_MoveResult(benchmark::State& state)
+{
+    Result<std::uint32_t> original(42U);
+    for (auto _ : state)
+    {
+        Result<std::uint32_t> moved(std::move(original));
+        benchmark::DoNotOptimize(moved);
+        original = std::move(moved);
+    }
+}
+BENCHMARK(BM_MoveResult);
+
+void BM_CopyResultString(benchmark::State& state)
+{
+    const Result<std::string> original(std::string(64, 'x'));
+    for (auto _ : state)
+    {
+        Result<std::string> copy(original);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_CopyResultString);
+
+void BM_MoveResultString(benchmark::State& state)
+{
+    Result<std::string> original(std::string(64, 'x'));
+    for (auto _ : state)
+    {
+        Result<std::string> moved(std::move(original));
+        benchmark::DoNotOptimize(moved);
+        original = std::move(moved);
+    }
+}
+BENCHMARK(BM_MoveResultString);
+
+// Long-lived slot, e.g. of a connection, assigned the result of every request
+void BM_AssignResultString(benchmark::State& state)
+{
+    const Result<std::string> request(std::string(64, 'x'));
+    Result<std::string> slot(std::string(64, 'y'));
+    for (auto _ : state)
+    {
+        slot = request;
+        benchmark::DoNotOptimize(slot);
+    }
+}
+BENCHMARK(BM_AssignResultString);
+
+void BM_AssignResultStringAlternating(benchmark::State& state)
+{
+    const Result<std::string> request(std::string(64, 'x'));
+    const Result<std::string> failure(Status::ERROR);
+    Result<std::string> slot(failure);
+    for (auto _ : state)
+    {
+        slot = request;
+        benchmark::DoNotOptimize(slot);
+        slot = failure;
+        benchmark::DoNotOptimize(slot);
+    }
+}
+BENCHMARK(BM_AssignResultStringAlternating);
+
+// --- Access ---
+
+void BM_GetValue(benchmark::State& state)
+{
+    Result<std::uint32_t> result(42U);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(result);
+        benchmark::DoNotOptimize(result.getValue());
+    }
+}
+BENCHMARK(BM_GetValue);
+
+void BM_OptionalValue(benchmark::State& state)
+{
+    std::optional<std::uint32_t> value(42U);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value);
+        benchmark::DoNotOptimize(*value);
+    }
+}
+BENCHMARK(BM_OptionalValue);
+
+// --- Returning across a call boundary ---
+
+void BM_ReturnRaw(benchmark::State& state)
+{
+    std::uint32_t divisor = static_cast<std::uint32_t>(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(divisor);
+        benchmark::DoNotOptimize(divideRaw(100U, divisor));
+    }
+}
+BENCHMARK(BM_ReturnRaw)->Arg(0)->Arg(3);
+
+void BM_ReturnOutParam(benchmark::State& state)
+{
+    std::uint32_t divisor = static_cast<std::uint32_t>(state.range(0));
+    for (auto _ : state)
+    {
+        std::uint32_t out = 0U;
+        benchmark::DoNotOptimize(divisor);
+        benchmark::DoNotOptimize(divideOutParam(100U, divisor, out));
+        benchmark::DoNotOptimize(out);
+    }
+}
+BENCHMARK(BM_ReturnOutParam)->Arg(0)->Arg(3);
+
+void BM_ReturnOptional(benchmark::State& state)
+{
+    std::uint32_t divisor = static_cast<std::uint32_t>(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(divisor);
+        benchmark::DoNotOptimize(divideOptional(100U, divisor));
+    }
+}
+BENCHMARK(BM_ReturnOptional)->Arg(0)->Arg(3);
+
+void BM_ReturnResult(benchmark::State& state)
+{
+    std::uint32_t divisor = static_cast<std::uint32_t>(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(divisor);
+        benchmark::DoNotOptimize(divideResult(100U, divisor));
+    }
+}
+BENCHMARK(BM_ReturnResult)->Arg(0)->Arg(3);
+
+// --- Propagation through a deep call chain (0 - error at the bottom, 3 - success) ---
+
+void BM_ChainRaw(benchmark::State& state)
+{
+    std::uint32_t divisor = static_cast<std::uint32_t>(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(divisor);
+        benchmark::DoNotOptimize(chainRaw(100U, divisor, kChainDepth));
+    }
+}
+BENCHMARK(BM_ChainRaw)->Arg(0)->Arg(3);
+
+void BM_ChainOutParam(benchmark::State& state)
+{
+    std::uint32_t divisor = static_cast<std::uint32_t>(state.range(0));
+    for (auto _ : state)
+    {
+        std::uint32_t out = 0U;
+        benchmark::DoNotOptimize(divisor);
+        benchmark::DoNotOptimize(chainOutParam(100U, divisor, kChainDepth, out));
+        benchmark::DoNotOptimize(out);
+    }
+}
+BENCHMARK(BM_ChainOutParam)->Arg(0)->Arg(3);
+
+void BM_ChainOptional(benchmark::State& state)
+{
+    std::uint32_t divisor = static_cast<std::uint32_t>(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(divisor);
+        benchmark::DoNotOptimize(chainOptional(100U, divisor, kChainDepth));
+    }
+}
+BENCHMARK(BM_ChainOptional)->Arg(0)->Arg(3);
+
+void BM_ChainResult(benchmark::State& state)
+{
+    std::uint32_t divisor = static_cast<std::uint32_t>(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(divisor);
+        benchmark::DoNotOptimize(chainResult(100U, divisor, kChainDepth));
+    }
+}
+BENCHMARK(BM_ChainResult)->Arg(0)->Arg(3);
+
+// --- Columns of per-field results: packed tag byte against a separate error and flag ---
+
+constexpr std::size_t kColumn = 1U << 20U;
+
+/// @brief Layout of `Result<std::uint16_t>` before the packed storage: union of value and error plus a flag.
+struct UnpackedResult
+{
+    union
+    {
+        std::uint16_t value_;
+        Status error_;
+    };
+    bool has_value_;
+};
+#if !INTERVIEW_RESULT_AUDIT
+static_assert(sizeof(UnpackedResult) == 2U * sizeof(Result<std::uint16_t>), "packed column must be half the size");
+#endif
+
+template <typename Cell, typename Make>
+std::vector<Cell> makeColumn(Make make)
+{
+    std::vector<Cell> column;
+    column.reserve(kColumn);
+    for (std::size_t index = 0U; index < kColumn; ++index)
+    {
+        column.push_back(make(static_cast<std::uint16_t>(index), (index % 16U) == 0U));
+    }
+    return column;
+}
+
+void BM_ScanUnpackedColumn(benchmark::State& state)
+{
+    const std::vector<UnpackedResult> column = makeColumn<UnpackedResult>([](std::uint16_t value, bool failed) {
+        UnpackedResult cell{};
+        cell.has_value_ = !failed;
+        if (failed)
+        {
+            cell.error_ = Status::INVALID_ARG;
+        }
+        else
+        {
+            cell.value_ = value;
+        }
+        return cell;
+    });
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0U;
+        for (const UnpackedResult& cell : column)
+        {
+            sum += cell.has_value_ ? cell.value_ : 0U;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * kColumn * sizeof(UnpackedResult)));
+}
+BENCHMARK(BM_ScanUnpackedColumn);
+
+void BM_ScanPackedColumn(benchmark::State& state)
+{
+    const std::vector<Result<std::uint16_t>> column =
+        makeColumn<Result<std::uint16_t>>([](std::uint16_t value, bool failed) {
+            return failed ? Result<std::uint16_t>(Status::INVALID_ARG) : Result<std::uint16_t>(value);
+        });
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0U;
+        for (const Result<std::uint16_t>& cell : column)
+        {
+            sum += cell.hasValue() ? *cell : 0U;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * kColumn * sizeof(Result<std::uint16_t>)));
+}
+BENCHMARK(BM_ScanPackedColumn);
+
+}  // namespace
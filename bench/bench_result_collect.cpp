@@ -0,0 +1,70 @@
+/**
+ * @file bench_result_collect.cpp
+ * @brief Micro benchmarks of `collectAll` against a hand written loop.
+ *
+ * The loop checks all the results for an error first, then copies the values with `getValue()`, which checks them
+ * again. `collectAll` checks each result once, reserves the vector once and moves the values of an rvalue range.
+ */
+#include "lib/result_collect.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using interview::library::collectAll;
+using interview::library::Result;
+using interview::library::Status;
+
+constexpr std::size_t kResults = 1024U;
+
+std::vector<Result<std::string>> makeResults()
+{
+    return std::vector<Result<std::string>>(kResults, Result<std::string>("value longer than the small buffer"));
+}
+
+void BM_HandWrittenCollect(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<Result<std::string>> results = makeResults();
+        state.ResumeTiming();
+
+        Result<std::vector<std::string>> values(Status::ERROR);
+        bool ok = true;
+        for (const Result<std::string>& result : results)
+        {
+            ok = ok && result.hasValue();
+        }
+        if (ok)
+        {
+            std::vector<std::string> collected;
+            for (const Result<std::string>& result : results)
+            {
+                collected.push_back(result.getValue());
+            }
+            values = Result<std::vector<std::string>>(std::move(collected));
+        }
+        benchmark::DoNotOptimize(values);
+    }
+}
+BENCHMARK(BM_HandWrittenCollect);
+
+void BM_CollectAll(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<Result<std::string>> results = makeResults();
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(collectAll(std::move(results)));
+    }
+}
+BENCHMARK(BM_CollectAll);
+
+}  // namespace
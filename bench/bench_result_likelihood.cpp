@@ -0,0 +1,160 @@
+/**
+ * @file bench_result_likelihood.cpp
+ * @brief Micro benchmarks of the branch hints of `Result` (`INTERVIEW_RESULT_LIKELIHOOD`).
+ *
+ * A validation chain rejects the given share of its inputs (per mille) and formats a diagnostic for each rejected
+ * one, laid out inline (`<false>`) or outlined into an `INTERVIEW_RESULT_COLD` function (`<true>`). Build the
+ * target once per policy to compare them: by default the hints expect values, `--config=result_no_hints` drops
+ * them and `--config=result_expect_error` expects errors. `BM_ValidateFootprint` calls 256 distinct
+ * instantiations of the chain, so the time reflects how much of the error handling shares the instruction cache
+ * with the hot code.
+ */
+#include "lib/result.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+#define BENCH_NOINLINE __attribute__((noinline))
+
+namespace
+{
+
+using interview::library::createError;
+using interview::library::Result;
+using interview::library::Status;
+
+constexpr std::size_t kFields = 4096U;
+constexpr std::size_t kVariants = 256U;
+constexpr std::uint32_t kRejected = 0xFFFF0000U;
+
+std::uint64_t diagnostics = 0U;
+
+/// @brief Fields of the batch, the given share of them is out of range, in an unpredictable order.
+std::vector<std::uint32_t> makeFields(std::int64_t rejectedPerMille)
+{
+    std::vector<std::uint32_t> fields;
+    fields.reserve(kFields);
+    std::uint32_t state = 12345U;
+    for (std::size_t index = 0U; index < kFields; ++index)
+    {
+        state = (state * 1103515245U) + 12345U;
+        const bool rejected = static_cast<std::int64_t>((state >> 8U) % 1000U) < rejectedPerMille;
+        fields.push_back(rejected ? (kRejected | state) : ((state >> 4U) & 0xFFFFU));
+    }
+    return fields;
+}
+
+template <std::uint32_t Salt>
+BENCH_NOINLINE Result<std::uint32_t> checkRange(std::uint32_t field)
+{
+    if (field >= kRejected)
+    {
+        return createError(Status::INVALID_ARG);
+    }
+    return field ^ Salt;
+}
+
+template <std::uint32_t Salt>
+BENCH_NOINLINE Result<std::uint32_t> checkChecksum(std::uint32_t field)
+{
+    if ((field & 0x10000U) != 0U)
+    {
+        return createError(Status::ERROR);
+    }
+    return field + Salt;
+}
+
+/// @brief Stores the validated field, models the consumer of the values.
+BENCH_NOINLINE void storeField(std::uint32_t field)
+{
+    benchmark::DoNotOptimize(field);
+}
+
+/// @brief Reports the rejected field, the error handling is laid out inline.
+void reportRejected(std::uint32_t field, std::uint32_t variant, Status status)
+{
+    char diagnostic[64];
+    const int length = std::snprintf(diagnostic, sizeof(diagnostic), "field %u of variant %u rejected: %s", field,
+                                     variant, toString(status));
+    diagnostics += static_cast<std::uint64_t>(length) + static_cast<std::uint64_t>(diagnostic[6]);
+}
+
+/// @brief Reports the rejected field, the error handling is outlined into the cold section.
+INTERVIEW_RESULT_COLD void reportRejectedCold(std::uint32_t field, std::uint32_t variant, Status status)
+{
+    reportRejected(field, variant, status);
+}
+
+/// @brief Validates the field and stores it, or reports it rejected.
+template <std::uint32_t Salt, bool Outlined>
+BENCH_NOINLINE std::uint32_t validateField(std::uint32_t field)
+{
+    const Result<std::uint32_t> checked = checkRange<Salt>(field).andThen(checkChecksum<Salt>);
+    if (checked)
+    {
+        storeField(*checked);
+        return 1U;
+    }
+    if (Outlined)
+    {
+        reportRejectedCold(field, Salt, checked.getError());
+    }
+    else
+    {
+        reportRejected(field, Salt, checked.getError());
+    }
+    return 0U;
+}
+
+using Validator = std::uint32_t (*)(std::uint32_t);
+
+template <bool Outlined, std::size_t... Salts>
+constexpr std::array<Validator, sizeof...(Salts)> makeValidators(std::index_sequence<Salts...>)
+{
+    return {{&validateField<static_cast<std::uint32_t>(Salts), Outlined>...}};
+}
+
+template <bool Outlined>
+void BM_ValidateFields(benchmark::State& state)
+{
+    const std::vector<std::uint32_t> fields = makeFields(state.range(0));
+    for (auto _ : state)
+    {
+        std::uint32_t valid = 0U;
+        for (const std::uint32_t field : fields)
+        {
+            valid += validateField<1U, Outlined>(field);
+        }
+        benchmark::DoNotOptimize(valid);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kFields));
+}
+BENCHMARK_TEMPLATE(BM_ValidateFields, false)->Arg(1)->Arg(500)->Arg(999);
+BENCHMARK_TEMPLATE(BM_ValidateFields, true)->Arg(1)->Arg(500)->Arg(999);
+
+template <bool Outlined>
+void BM_ValidateFootprint(benchmark::State& state)
+{
+    static constexpr std::array<Validator, kVariants> validators =
+        makeValidators<Outlined>(std::make_index_sequence<kVariants>{});
+    const std::vector<std::uint32_t> fields = makeFields(state.range(0));
+    for (auto _ : state)
+    {
+        std::uint32_t valid = 0U;
+        for (std::size_t index = 0U; index < kFields; ++index)
+        {
+            valid += validators[index % kVariants](fields[index]);
+        }
+        benchmark::DoNotOptimize(valid);
+    }
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kFields));
+}
+BENCHMARK_TEMPLATE(BM_ValidateFootprint, false)->Arg(1);
+BENCHMARK_TEMPLATE(BM_ValidateFootprint, true)->Arg(1);
+
+}  // namespace
@@ -0,0 +1,77 @@
+/**
+ * @file bench_result_parallel.cpp
+ * @brief Micro benchmarks of `parallelTransform` against a sequential loop.
+ *
+ * The argument is the position of the failing row in per mille of the batch, 1000 for a batch without error. With
+ * an early error the parallel transform stops all the threads, so its time drops like the one of the loop.
+ */
+#include "lib/result_parallel.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+using interview::library::createError;
+using interview::library::parallelTransform;
+using interview::library::Result;
+using interview::library::Status;
+
+constexpr std::size_t kRows = 1U << 20U;
+
+std::vector<std::uint32_t> makeRows(std::int64_t failingPerMille)
+{
+    std::vector<std::uint32_t> rows(kRows);
+    std::iota(rows.begin(), rows.end(), 1U);
+    if (failingPerMille < 1000)
+    {
+        rows[(kRows * static_cast<std::size_t>(failingPerMille)) / 1000U] = 0U;
+    }
+    return rows;
+}
+
+Result<std::uint32_t> divideNumbers(std::uint32_t divisor)
+{
+    if (divisor == 0U)
+    {
+        return createError(Status::INVALID_ARG);
+    }
+    return 1000000007U / divisor;
+}
+
+void BM_SequentialTransform(benchmark::State& state)
+{
+    const std::vector<std::uint32_t> rows = makeRows(state.range(0));
+    for (auto _ : state)
+    {
+        Result<std::vector<std::uint32_t>> result(std::vector<std::uint32_t>(rows.size()));
+        for (std::size_t index = 0U; index < rows.size(); ++index)
+        {
+            const Result<std::uint32_t> row = divideNumbers(rows[index]);
+            if (!row)
+            {
+                result = createError(row.getError());
+                break;
+            }
+            (*result)[index] = *row;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK(BM_SequentialTransform)->Arg(1000)->Arg(100);
+
+void BM_ParallelTransform(benchmark::State& state)
+{
+    const std::vector<std::uint32_t> rows = makeRows(state.range(0));
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(parallelTransform(rows, [](std::uint32_t row) { return divideNumbers(row); }));
+    }
+}
+BENCHMARK(BM_ParallelTransform)->Arg(1000)->Arg(100)->UseRealTime();
+
+}  // namespace
@@ -0,0 +1,109 @@
+/**
+ * @file bench_result_pipeline.cpp
+ * @brief Micro benchmarks of a ResultPipeline against a vector of results per stage.
+ *
+ * The records are parsed, validated and summed. The baseline materializes a `std::vector<Result<T>>` after every
+ * stage, the pipeline keeps one batch per stage.
+ */
+#include "lib/result_pipeline.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+using interview::library::createError;
+using interview::library::ErrorPolicy;
+using interview::library::fromRange;
+using interview::library::Result;
+using interview::library::sink;
+using interview::library::stage;
+using interview::library::Status;
+
+constexpr std::size_t kRecords = 1U << 16U;
+
+std::vector<std::string> makeRecords()
+{
+    std::vector<std::string> records;
+    records.reserve(kRecords);
+    for (std::size_t index = 0U; index < kRecords; ++index)
+    {
+        records.push_back(((index % 97U) == 0U) ? std::string("corrupted") : std::to_string(index));
+    }
+    return records;
+}
+
+Result<std::uint32_t> parse(const std::string& record)
+{
+    std::uint32_t value = 0U;
+    for (const char digit : record)
+    {
+        if ((digit < '0') || (digit > '9'))
+        {
+            return createError(Status::INVALID_ARG);
+        }
+        value = (value * 10U) + static_cast<std::uint32_t>(digit - '0');
+    }
+    return value;
+}
+
+Result<std::uint32_t> validate(std::uint32_t value)
+{
+    if ((value % 1000U) == 999U)
+    {
+        return createError(Status::ERROR);
+    }
+    return value;
+}
+
+void BM_VectorPerStage(benchmark::State& state)
+{
+    const std::vector<std::string> records = makeRecords();
+    for (auto _ : state)
+    {
+        std::vector<Result<std::uint32_t>> parsed;
+        parsed.reserve(records.size());
+        for (const std::string& record : records)
+        {
+            parsed.push_back(parse(record));
+        }
+        std::vector<Result<std::uint32_t>> validated;
+        validated.reserve(parsed.size());
+        for (const Result<std::uint32_t>& value : parsed)
+        {
+            if (value.hasValue())
+            {
+                validated.push_back(validate(*value));
+            }
+        }
+        std::uint64_t sum = 0U;
+        for (const Result<std::uint32_t>& value : validated)
+        {
+            sum += value.hasValue() ? *value : 0U;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_VectorPerStage);
+
+void BM_Pipeline(benchmark::State& state)
+{
+    const std::vector<std::string> records = makeRecords();
+    for (auto _ : state)
+    {
+        std::uint64_t sum = 0U;
+        // Lambdas rather than function pointers, so the stages are inlined into the loop of the pipeline
+        benchmark::DoNotOptimize(
+            fromRange(records) | stage([](const std::string& record) { return parse(record); }, ErrorPolicy::SKIP) |
+            stage([](std::uint32_t value) { return validate(value); }, ErrorPolicy::SKIP) |
+            sink([&sum](std::uint32_t value) { sum += value; }));
+        benchmark::DoNotOptimize(sum);
+    }
+}
+BENCHMARK(BM_Pipeline);
+
+}  // namespace
@@ -0,0 +1,248 @@
+/**
+ * @file bench_result_simd.cpp
+ * @brief Micro benchmarks of the bulk operations over batches of results.
+ *
+ * Compares the kernels of `result_simd.hpp` on a `ResultVector` against the naive row by row loop over
+ * `std::vector<Result<std::uint32_t>>`, for a block of 64K rows. The kernels are run with each instruction
+ * set supported by the CPU (argument: 0 - scalar, 1 - NEON, 2 - AVX2, 3 - AVX-512). `anyError` and
+ * `firstError` scan a block without errors, which is the common case of the validation and the worst case
+ * of the scan. `partition` and `compressValues` process a block with 5% of random errors.
+ */
+#include "lib/result_simd.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+using interview::library::isSimdLevelSupported;
+using interview::library::Result;
+using interview::library::ResultVector;
+using interview::library::SimdLevel;
+using interview::library::simdLevelName;
+using interview::library::Status;
+
+constexpr std::size_t kBlockRows = 65536U;
+constexpr double kErrorRate = 0.05;
+
+/// @brief Rows of the block, the same rows are stored in both layouts.
+struct Block
+{
+    explicit Block(double errorRate)
+    {
+        std::mt19937 generator(42U);
+        std::bernoulli_distribution isError(errorRate);
+        rows_.reserve(kBlockRows);
+        batch_.reserve(kBlockRows);
+        for (std::size_t i = 0U; i < kBlockRows; ++i)
+        {
+            if (isError(generator))
+            {
+                rows_.emplace_back(Status::ERROR);
+                batch_.pushError(Status::ERROR);
+            }
+            else
+            {
+                rows_.emplace_back(static_cast<std::uint32_t>(i));
+                batch_.pushValue(static_cast<std::uint32_t>(i));
+            }
+        }
+    }
+
+    std::vector<Result<std::uint32_t>> rows_; /* Array of structures. */
+    ResultVector<std::uint32_t> batch_;       /* Structure of arrays. */
+};
+
+const Block& validBlock()
+{
+    static const Block block(0.0);
+    return block;
+}
+
+const Block& mixedBlock()
+{
+    static const Block block(kErrorRate);
+    return block;
+}
+
+/// @brief Get the level of the benchmark argument, skips the benchmark if the CPU does not support it.
+bool selectLevel(benchmark::State& state, SimdLevel& level)
+{
+    level = static_cast<SimdLevel>(state.range(0));
+    if (!isSimdLevelSupported(level))
+    {
+        state.SkipWithError("Instruction set not supported by the CPU");
+        return false;
+    }
+    state.SetLabel(simdLevelName(level));
+    return true;
+}
+
+void setRowsProcessed(benchmark::State& state)
+{
+    state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(kBlockRows));
+}
+
+// --- anyError ---
+
+void BM_AnyErrorNaive(benchmark::State& state)
+{
+    const auto& rows = validBlock().rows_;
+    for (auto _ : state)
+    {
+        bool anyError = false;
+        for (const auto& row : rows)
+        {
+            if (!row.hasValue())
+            {
+                anyError = true;
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(anyError);
+    }
+    setRowsProcessed(state);
+}
+BENCHMARK(BM_AnyErrorNaive);
+
+void BM_AnyErrorKernel(benchmark::State& state)
+{
+    SimdLevel level;
+    if (!selectLevel(state, level))
+    {
+        return;
+    }
+    const auto& batch = validBlock().batch_;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(interview::library::anyError(batch.validity(), batch.size(), level));
+    }
+    setRowsProcessed(state);
+}
+BENCHMARK(BM_AnyErrorKernel)->DenseRange(0, 3);
+
+// --- firstError ---
+
+void BM_FirstErrorNaive(benchmark::State& state)
+{
+    const auto& rows = validBlock().rows_;
+    for (auto _ : state)
+    {
+        std::size_t first = 0U;
+        while ((first < rows.size()) && rows[first].hasValue())
+        {
+            ++first;
+        }
+        benchmark::DoNotOptimize(first);
+    }
+    setRowsProcessed(state);
+}
+BENCHMARK(BM_FirstErrorNaive);
+
+void BM_FirstErrorKernel(benchmark::State& state)
+{
+    SimdLevel level;
+    if (!selectLevel(state, level))
+    {
+        return;
+    }
+    const auto& batch = validBlock().batch_;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(interview::library::firstError(batch, level));
+    }
+    setRowsProcessed(state);
+}
+BENCHMARK(BM_FirstErrorKernel)->DenseRange(0, 3);
+
+// --- partition ---
+
+void BM_PartitionNaive(benchmark::State& state)
+{
+    const auto& rows = mixedBlock().rows_;
+    std::vector<std::uint32_t> ok;
+    std::vector<std::uint32_t> failed;
+    ok.reserve(kBlockRows);
+    failed.reserve(kBlockRows);
+    for (auto _ : state)
+    {
+        ok.clear();
+        failed.clear();
+        for (std::size_t i = 0U; i < rows.size(); ++i)
+        {
+            (rows[i].hasValue() ? ok : failed).push_back(static_cast<std::uint32_t>(i));
+        }
+        benchmark::DoNotOptimize(ok.data());
+        benchmark::DoNotOptimize(failed.data());
+    }
+    setRowsProcessed(state);
+}
+BENCHMARK(BM_PartitionNaive);
+
+void BM_PartitionKernel(benchmark::State& state)
+{
+    SimdLevel level;
+    if (!selectLevel(state, level))
+    {
+        return;
+    }
+    const auto& batch = mixedBlock().batch_;
+    std::vector<std::uint32_t> ok(kBlockRows);
+    std::vector<std::uint32_t> failed(kBlockRows);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            interview::library::partition(batch.validity(), batch.size(), ok.data(), failed.data(), level));
+        benchmark::ClobberMemory();
+    }
+    setRowsProcessed(state);
+}
+BENCHMARK(BM_PartitionKernel)->DenseRange(0, 3);
+
+// --- compressValues ---
+
+void BM_CompressValuesNaive(benchmark::State& state)
+{
+    const auto& rows = mixedBlock().rows_;
+    std::vector<std::uint32_t> values;
+    values.reserve(kBlockRows);
+    for (auto _ : state)
+    {
+        values.clear();
+        for (const auto& row : rows)
+        {
+            if (row.hasValue())
+            {
+                values.push_back(row.valueUnchecked());
+            }
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+    setRowsProcessed(state);
+}
+BENCHMARK(BM_CompressValuesNaive);
+
+void BM_CompressValuesKernel(benchmark::State& state)
+{
+    SimdLevel level;
+    if (!selectLevel(state, level))
+    {
+        return;
+    }
+    const auto& batch = mixedBlock().batch_;
+    std::vector<std::uint32_t> values(kBlockRows);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(
+            interview::library::compressValues(batch.values(), batch.validity(), values.data(), level));
+        benchmark::ClobberMemory();
+    }
+    setRowsProcessed(state);
+}
+BENCHMARK(BM_CompressValuesKernel)->DenseRange(0, 3);
+
+}  // namespace
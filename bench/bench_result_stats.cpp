@@ -0,0 +1,58 @@
+/**
+ * @file bench_result_stats.cpp
+ * @brief Micro benchmarks of the per call site error counters.
+ *
+ * Measures the error path of a function returning `Result` through `createError()`. Run the benchmark target
+ * with and without `--define result_stats=1` and compare: without the define `createError()` is the plain
+ * function checked below and the timings match `BM_ReturnResult`. With it the difference is the cost of
+ * counting the error.
+ */
+#include "lib/result.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <type_traits>
+
+#define BENCH_NOINLINE __attribute__((noinline))
+
+namespace
+{
+
+using interview::library::createError;
+using interview::library::ErrorCreate;
+using interview::library::Result;
+using interview::library::Status;
+
+#if !INTERVIEW_RESULT_STATS
+// Without the counters `createError()` keeps its single parameter and stays `noexcept`
+static_assert(std::is_same<decltype(&createError<Status>), ErrorCreate<Status> (*)(Status&&) noexcept>::value,
+              "createError must be unchanged when the counters are disabled");
+#endif
+
+constexpr const char* kMode = INTERVIEW_RESULT_STATS ? "result_stats=1" : "result_stats=0";
+
+BENCH_NOINLINE Result<std::uint32_t> checkedAdd(std::uint32_t a, std::uint32_t b)
+{
+    if (b > (UINT32_MAX - a))
+    {
+        return createError(Status::INVALID_ARG);
+    }
+    return a + b;
+}
+
+// --- Error path (0 - every call fails) and success path (1) ---
+
+void BM_CreateErrorCounted(benchmark::State& state)
+{
+    std::uint32_t b = (state.range(0) == 0) ? UINT32_MAX : 1U;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(b);
+        benchmark::DoNotOptimize(checkedAdd(1U, b));
+    }
+    state.SetLabel(kMode);
+}
+BENCHMARK(BM_CreateErrorCounted)->Arg(0)->Arg(1);
+
+}  // namespace
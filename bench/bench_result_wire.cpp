@@ -0,0 +1,94 @@
+/**
+ * @file bench_result_wire.cpp
+ * @brief Micro benchmarks of the binary encoding of results against a hand written wire struct.
+ *
+ * A worker sends a `Result<Sample>` to the aggregator through a shared memory slot. The baseline converts it into a
+ * separate wire struct which is copied into the slot, and copied and converted back on the other side. The frame of
+ * `serializeInto` is written into the slot directly and `ResultView` reads the sample in place.
+ */
+#include "lib/result_wire.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+
+using interview::library::createError;
+using interview::library::Result;
+using interview::library::ResultView;
+using interview::library::resultWireSize;
+using interview::library::serializeInto;
+using interview::library::Span;
+using interview::library::Status;
+
+struct Sample
+{
+    std::uint64_t id_;
+    double values_[15];
+};
+
+/// @brief Wire struct written by hand for the baseline.
+struct WireSample
+{
+    std::uint32_t hasValue_;
+    std::uint32_t status_;
+    Sample sample_;
+};
+
+Result<Sample> readSample(std::uint64_t id)
+{
+    if (id == 0U)
+    {
+        return createError(Status::INVALID_ARG);
+    }
+    Sample sample{id, {}};
+    sample.values_[0] = static_cast<double>(id);
+    return sample;
+}
+
+void BM_WireStructRoundTrip(benchmark::State& state)
+{
+    alignas(8) unsigned char slot[sizeof(WireSample)];
+    std::uint64_t id = 1U;
+    for (auto _ : state)
+    {
+        const Result<Sample> sent = readSample(id++);
+        WireSample wire{};
+        wire.hasValue_ = sent.hasValue() ? 1U : 0U;
+        if (sent.hasValue())
+        {
+            wire.sample_ = *sent;
+        }
+        else
+        {
+            wire.status_ = static_cast<std::uint32_t>(sent.getError());
+        }
+        std::memcpy(slot, &wire, sizeof(wire));
+        benchmark::ClobberMemory();
+
+        WireSample received;
+        std::memcpy(&received, slot, sizeof(received));
+        benchmark::DoNotOptimize(received.hasValue_ != 0U ? received.sample_.values_[0] : 0.0);
+    }
+}
+BENCHMARK(BM_WireStructRoundTrip);
+
+void BM_ResultWireRoundTrip(benchmark::State& state)
+{
+    alignas(8) unsigned char slot[resultWireSize<Sample>()];
+    std::uint64_t id = 1U;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(serializeInto(Span<unsigned char>(slot), readSample(id++)));
+        benchmark::ClobberMemory();
+
+        const Result<ResultView<Sample>> view = ResultView<Sample>::fromBuffer(Span<const unsigned char>(slot));
+        benchmark::DoNotOptimize((view && view->hasValue()) ? view->getValue().values_[0] : 0.0);
+    }
+}
+BENCHMARK(BM_ResultWireRoundTrip);
+
+}  // namespace
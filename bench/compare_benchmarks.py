@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""Compares two runs of //:bench_result and fails when a tracked micro benchmark regressed.
+
+Both runs are the JSON output of Google Benchmark (--benchmark_out=<file> --benchmark_out_format=json), taken on
+the same machine. With --benchmark_repetitions the medians are compared, otherwise the single measurements. The
+tracked benchmarks and their limits are listed in bench/tracked_benchmarks.txt.
+
+Exit status: 0 when no tracked benchmark regressed, 1 when one did, 2 when a tracked benchmark is missing.
+"""
+
+import argparse
+import json
+import os
+import re
+import statistics
+import sys
+
+NANOSECONDS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_times(path, metric):
+    """Returns the time of each benchmark in nanoseconds, the median of the repetitions."""
+    with open(path, encoding="utf-8") as file:
+        benchmarks = json.load(file)["benchmarks"]
+    medians = {}
+    samples = {}
+    for benchmark in benchmarks:
+        time = benchmark[metric] * NANOSECONDS[benchmark.get("time_unit", "ns")]
+        name = benchmark.get("run_name", benchmark["name"])
+        if benchmark.get("run_type") == "aggregate":
+            if benchmark.get("aggregate_name") == "median":
+                medians[name] = time
+        else:
+            samples.setdefault(name, []).append(time)
+    times = {name: statistics.median(values) for name, values in samples.items()}
+    times.update(medians)
+    return times
+
+
+def load_tracked(path, threshold):
+    """Returns the tracked patterns together with the allowed slowdown in percent."""
+    tracked = []
+    with open(path, encoding="utf-8") as file:
+        for line in file:
+            fields = line.split("#", 1)[0].split()
+            if fields:
+                limit = float(fields[1]) if len(fields) > 1 else threshold
+                tracked.append((re.compile(fields[0]), limit))
+    return tracked
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", help="JSON output of the baseline run")
+    parser.add_argument("current", help="JSON output of the run to check")
+    parser.add_argument(
+        "--tracked",
+        default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "tracked_benchmarks.txt"),
+        help="file listing the tracked benchmarks (default: %(default)s)",
+    )
+    parser.add_argument("--threshold", type=float, default=10.0, help="allowed slowdown in percent (default: 10)")
+    parser.add_argument("--metric", choices=["cpu_time", "real_time"], default="cpu_time")
+    args = parser.parse_args()
+
+    baseline = load_times(args.baseline, args.metric)
+    current = load_times(args.current, args.metric)
+    regressed = False
+    missing = False
+    print(f"{'Benchmark':<48} {'Baseline':>12} {'Current':>12} {'Change':>8}  Limit")
+    for pattern, limit in load_tracked(args.tracked, args.threshold):
+        names = sorted(name for name in baseline if pattern.fullmatch(name))
+        if not names:
+            print(f"{pattern.pattern:<48} missing in the baseline")
+            missing = True
+        for name in names:
+            if name not in current:
+                print(f"{name:<48} {baseline[name]:>10.2f}ns {'missing':>12}")
+                missing = True
+                continue
+            change = (current[name] - baseline[name]) / baseline[name] * 100.0
+            verdict = "REGRESSED" if change > limit else ""
+            regressed = regressed or change > limit
+            print(f"{name:<48} {baseline[name]:>10.2f}ns {current[name]:>10.2f}ns {change:>+7.1f}% {limit:>5.1f}% "
+                  f"{verdict}")
+    if missing:
+        return 2
+    return 1 if regressed else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+"""Measures the time to compile a small translation unit using the Result library.
+
+The same probe is compiled in several variants, each one several times, and the median is printed:
+
+  baseline  includes lib/result.hpp of the revision given with --baseline
+  header    includes lib/result.hpp
+  fwd       includes lib/result_fwd.hpp and only declares functions, as a header using the library would
+  pch       includes lib/result.hpp after the precompiled lib/result_pch.hpp
+  module    imports interview.result, with --module (GCC 14 or newer, clang 16 or newer)
+
+The lines column counts the preprocessed lines of the probe, the part the precompiled header and the module save.
+Run it from the repository or with `bazel run //:compile_time -- <options>`.
+"""
+
+import argparse
+import os
+import shlex
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+PROBE = """\
+#include "lib/result.hpp"
+
+#include <string>
+
+using interview::library::createError;
+using interview::library::Result;
+using interview::library::Status;
+
+Result<std::string> lookup(int key)
+{
+    if (key < 0)
+    {
+        return createError(Status::INVALID_ARG);
+    }
+    return std::string(static_cast<unsigned>(key), 'x');
+}
+
+int probe(int key)
+{
+    return lookup(key).map([](const std::string& text) { return static_cast<int>(text.size()); }).valueOr(-1);
+}
+"""
+
+PROBE_FWD = """\
+#include "lib/result_fwd.hpp"
+
+namespace interview
+{
+namespace library
+{
+
+Result<int> parse(const char* text);
+Result<void> store(const Result<int>& value);
+ResultVector<int>* batch();
+
+}  // namespace library
+}  // namespace interview
+"""
+
+# The module probe cannot include lib/result.hpp before the import, the rest is the same.
+PROBE_MODULE = PROBE.replace(
+    '#include "lib/result.hpp"\n\n#include <string>', "#include <string>\n\nimport interview.result;"
+)
+
+
+def repository_root():
+    """Returns the source tree, the workspace when started with `bazel run`."""
+    workspace = os.environ.get("BUILD_WORKSPACE_DIRECTORY")
+    if workspace:
+        return workspace
+    return os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def run(command, cwd=None):
+    result = subprocess.run(command, cwd=cwd, stdout=subprocess.PIPE, stderr=subprocess.PIPE, text=True)
+    if result.returncode != 0:
+        sys.exit(f"{' '.join(shlex.quote(part) for part in command)} failed:\n{result.stderr}")
+    return result.stdout
+
+
+def median_milliseconds(command, runs, cwd=None):
+    times = []
+    for _ in range(runs):
+        start = time.perf_counter()
+        run(command, cwd)
+        times.append((time.perf_counter() - start) * 1000.0)
+    return statistics.median(times)
+
+
+def preprocessed_lines(command, cwd=None):
+    return run(command + ["-E", "-o", "-"], cwd).count("\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "g++"), help="C++ compiler (default: %(default)s)")
+    parser.add_argument("--std", default="c++17", help="C++ standard of the probe (default: %(default)s)")
+    parser.add_argument("--flags", default="-O2", help="further compiler flags (default: %(default)s)")
+    parser.add_argument("--runs", type=int, default=5, help="compilations per variant (default: %(default)s)")
+    parser.add_argument("--baseline", help="git revision measured as the baseline, e.g. HEAD~1")
+    parser.add_argument("--module", action="store_true", help="also measure the import, needs -std=c++20")
+    args = parser.parse_args()
+
+    root = repository_root()
+    clang = "clang" in run([args.compiler, "--version"])
+    flags = [args.compiler, f"-std={args.std}"] + shlex.split(args.flags)
+    rows = []
+    with tempfile.TemporaryDirectory() as work:
+        for name, text in (("probe.cpp", PROBE), ("probe_fwd.cpp", PROBE_FWD), ("probe_module.cpp", PROBE_MODULE)):
+            with open(os.path.join(work, name), "w", encoding="utf-8") as file:
+                file.write(text)
+        probe = os.path.join(work, "probe.cpp")
+        output = ["-c", "-o", os.path.join(work, "probe.o")]
+
+        if args.baseline:
+            baseline = os.path.join(work, "baseline")
+            os.mkdir(baseline)
+            archive = subprocess.run(["git", "-C", root, "archive", args.baseline, "lib"], stdout=subprocess.PIPE,
+                                     check=True)
+            subprocess.run(["tar", "-x", "-C", baseline], input=archive.stdout, check=True)
+            command = flags + [f"-I{baseline}", probe]
+            rows.append(("baseline", median_milliseconds(command + output, args.runs), preprocessed_lines(command)))
+
+        command = flags + [f"-I{root}", probe]
+        rows.append(("header", median_milliseconds(command + output, args.runs), preprocessed_lines(command)))
+
+        command = flags + [f"-I{root}", os.path.join(work, "probe_fwd.cpp")]
+        rows.append(("fwd", median_milliseconds(command + output, args.runs), preprocessed_lines(command)))
+
+        # The precompiled header is built with the flags of the probe, a mismatch would silently parse the header.
+        if clang:
+            pch = os.path.join(work, "result_pch.pch")
+            run(flags + [f"-I{root}", "-x", "c++-header", os.path.join(root, "lib/result_pch.hpp"), "-o", pch])
+            command = flags + [f"-I{root}", "-include-pch", pch, probe]
+        else:
+            prefix = os.path.join(work, "result_pch.hpp")
+            with open(prefix, "w", encoding="utf-8") as file:
+                file.write('#include "lib/result_pch.hpp"\n')
+            run(flags + [f"-I{root}", "-x", "c++-header", prefix, "-o", prefix + ".gch"])
+            command = flags + [f"-I{root}", "-Winvalid-pch", "-include", prefix, probe]
+        rows.append(("pch", median_milliseconds(command + output, args.runs), None))
+
+        if args.module:
+            interface = os.path.join(root, "lib/result.cppm")
+            if clang:
+                pcm = os.path.join(work, "result.pcm")
+                run(flags + [f"-I{root}", "--precompile", "-x", "c++-module", interface, "-o", pcm])
+                command = flags + [f"-fmodule-file=interview.result={pcm}", os.path.join(work, "probe_module.cpp")]
+            else:
+                # GCC writes the compiled interface to gcm.cache/ in the working directory.
+                run(flags + ["-fmodules-ts", f"-I{root}", "-x", "c++", "-c", interface, "-o",
+                             os.path.join(work, "result.o")], cwd=work)
+                command = flags + ["-fmodules-ts", os.path.join(work, "probe_module.cpp")]
+            rows.append(("module", median_milliseconds(command + output, args.runs, cwd=work), None))
+
+    print(f"{os.path.basename(args.compiler)} -std={args.std} {args.flags}, median of {args.runs} runs")
+    print(f"{'Variant':<10} {'Time':>10} {'Lines':>8}")
+    for name, milliseconds, lines in rows:
+        print(f"{name:<10} {milliseconds:>8.0f}ms {lines if lines is not None else '-':>8}")
+
+
+if __name__ == "__main__":
+    main()
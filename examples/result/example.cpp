@@ -19,7 +19,11 @@ interview::library::Result<std::string> greetName(const std::string& name)
     {
         return interview::library::createError(interview::library::Status::INVALID_ARG);
     }
-    return std::string("Hello, " + name + "!");
+    // Build the greeting in the storage of the Result object, no temporary string is moved in
+    interview::library::Result<std::string> greeting(interview::library::inPlace);
+    greeting->reserve(name.size() + 8U);
+    greeting->append("Hello, ").append(name).append("!");
+    return greeting;
 }
 
 interview::library::Result<std::uint32_t> readData(const std::vector<std::uint32_t>& data)
@@ -37,7 +41,7 @@ interview::library::Result<std::string> stringParseWithError(const bool error)
     {
         return interview::library::createError(interview::library::Status::ERROR);
     }
-    return std::string("Parsed string");
+    return interview::library::makeResult<std::string>("Parsed string");
 }
 
 int32_t main()
@@ -50,7 +54,7 @@ int32_t main()
     }
     else
     {
-        std::cout << "divideNumbers error: " << static_cast<std::uint32_t>(result1.getError()) << std::endl;
+        std::cout << "divideNumbers error: " << interview::library::toString(result1.getError()) << std::endl;
     }
 
     const auto result2 = divideNumbers(10U, 0U);
@@ -60,7 +64,7 @@ int32_t main()
     }
     else
     {
-        std::cout << "divideNumbers error: " << static_cast<std::uint32_t>(result2.getError()) << std::endl;
+        std::cout << "divideNumbers error: " << interview::library::toString(result2.getError()) << std::endl;
     }
 
     const auto result3 = greetName("Daniel");
@@ -70,7 +74,7 @@ int32_t main()
     }
     else
     {
-        std::cout << "greetName error status: " << static_cast<std::uint32_t>(result3.getError()) << std::endl;
+        std::cout << "greetName error status: " << interview::library::toString(result3.getError()) << std::endl;
     }
 
     const auto result4 = greetName("");
@@ -80,7 +84,7 @@ int32_t main()
     }
     else
     {
-        std::cout << "greetName error status: " << static_cast<std::uint32_t>(result4.getError()) << std::endl;
+        std::cout << "greetName error status: " << interview::library::toString(result4.getError()) << std::endl;
     }
 
     // Example 3: Move semantics
@@ -101,7 +105,7 @@ int32_t main()
     }
     else
     {
-        std::cout << "readData error status: " << static_cast<std::uint32_t>(result7.getError()) << std::endl;
+        std::cout << "readData error status: " << interview::library::toString(result7.getError()) << std::endl;
     }
 
     data.clear();
@@ -113,7 +117,7 @@ int32_t main()
     }
     else
     {
-        std::cout << "readData error status: " << static_cast<std::uint32_t>(result8.getError()) << std::endl;
+        std::cout << "readData error status: " << interview::library::toString(result8.getError()) << std::endl;
     }
 
     const auto result9 = stringParseWithError(true);
@@ -123,7 +127,7 @@ int32_t main()
     }
     else
     {
-        std::cout << "stringParseWithError error status: " << static_cast<std::uint32_t>(result9.getError())
+        std::cout << "stringParseWithError error status: " << interview::library::toString(result9.getError())
                   << std::endl;
     }
 
@@ -0,0 +1,294 @@
+/**
+ * @file fuzz_result.cpp
+ * @brief libFuzzer target driving random sequences of operations on `Result` objects.
+ *
+ * Each input byte selects an operation (construction, copy and move assignment, swap, emplace, moving out,
+ * throwing copies) on a few slots of results with tracked payloads, see `test/lifetime_tracker.hpp`, and of
+ * results in the packed and niche storages. After each operation all slots are compared with a shadow model, and
+ * after the input every tracked object must have been destructed exactly once. Any mismatch aborts, so the
+ * sanitizers linked in report the input:
+ *
+ *   bazel run --config=fuzz //:fuzz_result -- -max_total_time=60
+ */
+#include "lib/result.hpp"
+#include "test/lifetime_tracker.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+
+using interview::library::createError;
+using interview::library::inPlace;
+using interview::library::inPlaceError;
+using interview::library::Result;
+using interview::library::Status;
+using interview::library::test::lifetimeCounters;
+using interview::library::test::LifetimeCounters;
+using interview::library::test::TrackedError;
+using interview::library::test::TrackedValue;
+
+constexpr std::size_t kSlots = 4U;
+
+/// @brief Expected state of one slot.
+struct Model
+{
+    bool hasValue_;
+    int payload_;
+};
+
+/// @brief Reads the input byte by byte, zeros once it is consumed.
+class Input
+{
+  public:
+    Input(const std::uint8_t* data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+    bool empty() const noexcept { return size_ == 0U; }
+
+    std::uint8_t next() noexcept
+    {
+        if (size_ == 0U)
+        {
+            return 0U;
+        }
+        --size_;
+        return *data_++;
+    }
+
+    std::size_t nextSlot() noexcept { return next() % kSlots; }
+
+  private:  // members
+    const std::uint8_t* data_; /* Next byte. */
+    std::size_t size_;         /* Bytes left. */
+};
+
+[[noreturn]] void fail(const char* what)
+{
+    std::fprintf(stderr, "fuzz_result: %s\n", what);
+    std::abort();
+}
+
+/**
+ * @brief Slots of one result type together with their models.
+ *
+ * @tparam R Result type.
+ * @tparam Codec Maps the payloads of the model to the value and the error of `R` and back, `errorPayload` and
+ *               `movedFrom` give the payload of the model after the error is assigned and after being moved from.
+ */
+template <typename R, typename Codec>
+class Slots
+{
+  public:
+    Slots()
+    {
+        for (std::size_t index = 0U; index < kSlots; ++index)
+        {
+            results_[index] = Codec::value(static_cast<int>(index));
+            models_[index] = Model{true, static_cast<int>(index)};
+        }
+    }
+
+    /// @brief Applies the operation selected by the next byte.
+    void apply(Input& input)
+    {
+        const std::uint8_t operation = input.next();
+        const std::size_t a = input.nextSlot();
+        const std::size_t b = input.nextSlot();
+        const int payload = input.next();
+        switch (operation % 10U)
+        {
+            case 0U:
+                results_[a] = results_[b];
+                models_[a] = models_[b];
+                break;
+            case 1U:
+                results_[a] = std::move(results_[b]);
+                models_[a] = models_[b];
+                if (a != b)
+                {
+                    models_[b].payload_ = Codec::movedFrom(models_[b].payload_);
+                }
+                break;
+            case 2U:
+                results_[a].swap(results_[b]);
+                std::swap(models_[a], models_[b]);
+                break;
+            case 3U:
+                results_[a].emplace(Codec::valueArg(payload));
+                models_[a] = Model{true, payload};
+                break;
+            case 4U:
+                results_[a] = Codec::error(payload);
+                models_[a] = Model{false, Codec::errorPayload(payload)};
+                break;
+            case 5U:
+                results_[a] = Codec::value(payload);
+                models_[a] = Model{true, payload};
+                break;
+            case 6U:
+            {
+                const R copy(results_[a]);
+                expect(copy, models_[a]);
+                break;
+            }
+            case 7U:
+            {
+                const R moved(std::move(results_[a]));
+                expect(moved, models_[a]);
+                models_[a].payload_ = Codec::movedFrom(models_[a].payload_);
+                break;
+            }
+            case 8U:
+                copyThrowing(a, b, payload);
+                break;
+            default:
+                results_[a] = R(results_[b]);
+                models_[a] = models_[b];
+                break;
+        }
+        for (std::size_t index = 0U; index < kSlots; ++index)
+        {
+            expect(results_[index], models_[index]);
+        }
+    }
+
+  private:  // methods
+    /**
+     * @brief Copy constructs or copy assigns with the copy constructions armed to throw.
+     *
+     * A throwing copy construction must not leave anything to destruct, a throwing copy assignment must leave the
+     * target in its state.
+     */
+    void copyThrowing(std::size_t a, std::size_t b, int payload)
+    {
+        lifetimeCounters().copiesUntilThrow_ = payload % 3;
+        try
+        {
+            if ((payload & 0x80) != 0)
+            {
+                const R copy(results_[b]);
+                expect(copy, models_[b]);
+            }
+            else
+            {
+                results_[a] = results_[b];
+                models_[a] = models_[b];
+            }
+        }
+        catch (const std::runtime_error&)
+        {
+        }
+        lifetimeCounters().copiesUntilThrow_ = -1;
+    }
+
+    static void expect(const R& result, const Model& model)
+    {
+        if (result.hasValue() != model.hasValue_)
+        {
+            fail("alternative differs from the model");
+        }
+        const int payload = result.hasValue() ? Codec::payload(result.getValue()) : Codec::payload(result.getError());
+        if (payload != model.payload_)
+        {
+            fail("payload differs from the model");
+        }
+    }
+
+  private:  // members
+    std::array<R, kSlots> results_;    /* Results under test. */
+    std::array<Model, kSlots> models_; /* Expected state of the results. */
+};
+
+/// @brief Codec of the results with tracked payloads, the generic storage.
+struct TrackedCodec
+{
+    using R = Result<TrackedValue, TrackedError>;
+
+    static R value(int payload) { return R(inPlace, payload); }
+    static R error(int payload) { return R(inPlaceError, payload); }
+    static int errorPayload(int payload) noexcept { return payload; }
+    static int valueArg(int payload) noexcept { return payload; }
+    static int movedFrom(int /* payload */) noexcept { return TrackedValue::kMovedFrom; }
+    static int payload(const TrackedValue& value) noexcept { return value.payload(); }
+    static int payload(const TrackedError& error) noexcept { return error.payload(); }
+};
+
+/// @brief Codec of `Result<std::uint16_t>`, the packed storage, the error payload selects the status.
+struct PackedCodec
+{
+    using R = Result<std::uint16_t>;
+
+    static R value(int payload) { return R(valueArg(payload)); }
+    static R error(int payload) { return createError(static_cast<Status>(errorPayload(payload))); }
+    static int errorPayload(int payload) noexcept { return 1 + (payload % 2); }
+    static std::uint16_t valueArg(int payload) noexcept { return static_cast<std::uint16_t>(payload); }
+    static int movedFrom(int payload) noexcept { return payload; }
+    static int payload(std::uint16_t value) noexcept { return value; }
+    static int payload(Status status) noexcept { return static_cast<int>(status); }
+};
+
+/// @brief Codec of `Result<const int*>`, the niche storage, the value payload indexes a table.
+struct NicheCodec
+{
+    using R = Result<const int*>;
+
+    static R value(int payload) { return R(valueArg(payload)); }
+    static R error(int payload) { return createError(static_cast<Status>(errorPayload(payload))); }
+    static int errorPayload(int payload) noexcept { return 1 + (payload % 2); }
+    static const int* valueArg(int payload) noexcept { return &table()[static_cast<std::size_t>(payload)]; }
+    static int movedFrom(int payload) noexcept { return payload; }
+    static int payload(const int* value) noexcept { return *value; }
+    static int payload(Status status) noexcept { return static_cast<int>(status); }
+
+    static const std::array<int, 256U>& table() noexcept
+    {
+        static const std::array<int, 256U> entries = [] {
+            std::array<int, 256U> values{};
+            for (std::size_t index = 0U; index < values.size(); ++index)
+            {
+                values[index] = static_cast<int>(index);
+            }
+            return values;
+        }();
+        return entries;
+    }
+};
+
+}  // namespace
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)
+{
+    lifetimeCounters() = LifetimeCounters{};
+    {
+        Input input(data, size);
+        Slots<TrackedCodec::R, TrackedCodec> tracked;
+        Slots<PackedCodec::R, PackedCodec> packed;
+        Slots<NicheCodec::R, NicheCodec> niche;
+        while (!input.empty())
+        {
+            switch (input.next() % 3U)
+            {
+                case 0U:
+                    tracked.apply(input);
+                    break;
+                case 1U:
+                    packed.apply(input);
+                    break;
+                default:
+                    niche.apply(input);
+                    break;
+            }
+        }
+    }
+    if (!lifetimeCounters().balanced())
+    {
+        fail("tracked objects leaked, destructed twice or used after destruction");
+    }
+    return 0;
+}
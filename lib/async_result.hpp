@@ -0,0 +1,813 @@
+/**
+ * @file async_result.hpp
+ * @brief Definition of the AsyncResult and AsyncPromise classes.
+ *
+ * This file contains the definition of the AsyncResult class, a `Result` which becomes available
+ * later, and of the AsyncPromise class providing it. Unlike `std::future` the shared state is a
+ * single allocation without a mutex: the producer and the consumer complete it with one atomic
+ * operation each. Continuations attached with `then` and `andThen` run inline, in the thread
+ * completing the previous stage, or are scheduled on an `AsyncExecutor`. The state of each stage
+ * holds its continuation and is the task scheduled on the executor, so chaining allocates one
+ * state per stage and scheduling allocates nothing. Errors skip the continuations the same way
+ * they skip the synchronous combinators of `Result`.
+ *
+ * @note This class is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_ASYNC_RESULT_HPP
+#define INTERVIEW_LIBRARY_ASYNC_RESULT_HPP
+
+#include "lib/result.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+
+/**
+ * @brief Unit of work run by an AsyncExecutor.
+ *
+ * Tasks are intrusive: the executor links them through `next_`, so scheduling a task allocates nothing. The task
+ * must stay alive until it ran.
+ */
+class AsyncTask
+{
+  public:
+    /// @brief Runs the task, called exactly once by the executor.
+    virtual void run() noexcept = 0;
+
+    AsyncTask* next_{nullptr}; /* Link of the queue of the executor. */
+
+  protected:
+    ~AsyncTask() = default;
+};
+
+/**
+ * @brief Runs the continuations of AsyncResult objects, e.g. on a thread pool or an event loop.
+ */
+class AsyncExecutor
+{
+  public:
+    /**
+     * @brief Schedules the task.
+     *
+     * @param task task to run, exactly once.
+     */
+    virtual void execute(AsyncTask& task) = 0;
+
+  protected:
+    ~AsyncExecutor() = default;
+};
+
+/**
+ * @brief Executor running the tasks in first in, first out order on a fixed set of threads.
+ */
+class AsyncThreadPool final : public AsyncExecutor
+{
+  public:
+    /**
+     * @brief Starts the threads.
+     *
+     * @param threads number of threads, at least one.
+     */
+    explicit AsyncThreadPool(std::size_t threads = std::thread::hardware_concurrency())
+    {
+        const std::size_t count = (threads == 0U) ? 1U : threads;
+        workers_.reserve(count);
+        for (std::size_t worker = 0U; worker < count; ++worker)
+        {
+            workers_.emplace_back([this]() { work(); });
+        }
+    }
+
+    AsyncThreadPool(const AsyncThreadPool&) = delete;
+    AsyncThreadPool& operator=(const AsyncThreadPool&) = delete;
+
+    /// @brief Runs the tasks scheduled so far and stops the threads.
+    ~AsyncThreadPool()
+    {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        ready_.notify_all();
+        for (std::thread& worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    void execute(AsyncTask& task) override
+    {
+        task.next_ = nullptr;
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            if (tail_ == nullptr)
+            {
+                head_ = &task;
+            }
+            else
+            {
+                tail_->next_ = &task;
+            }
+            tail_ = &task;
+        }
+        ready_.notify_one();
+    }
+
+    /// @brief Get the number of threads.
+    std::size_t size() const noexcept { return workers_.size(); }
+
+  private:  // methods
+    void work()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;)
+        {
+            ready_.wait(lock, [this]() { return (head_ != nullptr) || stopping_; });
+            if (head_ == nullptr)
+            {
+                return;
+            }
+            AsyncTask* task = head_;
+            head_ = task->next_;
+            if (head_ == nullptr)
+            {
+                tail_ = nullptr;
+            }
+            lock.unlock();
+            task->run();
+            lock.lock();
+        }
+    }
+
+  private:  // members
+    std::mutex mutex_;               /* Guards the queue. */
+    std::condition_variable ready_;  /* Notified when a task is queued or the pool stops. */
+    AsyncTask* head_{nullptr};       /* Oldest queued task. */
+    AsyncTask* tail_{nullptr};       /* Newest queued task. */
+    bool stopping_{false};           /* Set when the pool is destructed. */
+    std::vector<std::thread> workers_; /* Threads running the tasks. */
+};
+
+namespace detail
+{
+
+/// @brief Continuation of a shared state, resumed once both the result and the continuation are set.
+class AsyncContinuation
+{
+  public:
+    virtual void resume() noexcept = 0;
+
+  protected:
+    ~AsyncContinuation() = default;
+};
+
+/**
+ * @brief Shared state of an AsyncResult, referenced by its producer and its consumer.
+ *
+ * Completion is lock-free: the producer sets the result and the consumer the continuation, each followed by one
+ * atomic `fetch_or`, and the one of both coming second resumes the continuation.
+ */
+template <typename T, typename E>
+class AsyncState
+{
+  public:
+    AsyncState() noexcept {}
+
+    AsyncState(const AsyncState&) = delete;
+    AsyncState& operator=(const AsyncState&) = delete;
+
+    virtual ~AsyncState()
+    {
+        if ((flags_.load(std::memory_order_relaxed) & kHasResult) != 0U)
+        {
+            // The consumer moves the result out, one left here was abandoned together with the AsyncResult
+            result_.discard();
+            result_.~Result();
+        }
+    }
+
+    /// @brief Sets the result, resumes the continuation when one is attached.
+    void setResult(Result<T, E>&& result) noexcept
+    {
+        static_assert(std::is_nothrow_move_constructible<Result<T, E>>::value,
+                      "The result of an AsyncResult must be nothrow move constructible");
+        new (&result_) Result<T, E>(std::move(result));
+        const std::uint32_t prior = flags_.fetch_or(kHasResult, std::memory_order_acq_rel);
+#if INTERVIEW_RESULT_HAS_ATOMIC_WAIT
+        if ((prior & kWaiting) != 0U)
+        {
+            flags_.notify_all();
+        }
+#endif
+        if ((prior & kHasContinuation) != 0U)
+        {
+            continuation_->resume();
+        }
+    }
+
+    /// @brief Attaches the continuation, resumes it right away when the result is set.
+    void setContinuation(AsyncContinuation& continuation) noexcept
+    {
+        continuation_ = &continuation;
+        const std::uint32_t prior = flags_.fetch_or(kHasContinuation, std::memory_order_acq_rel);
+        if ((prior & kHasResult) != 0U)
+        {
+            continuation.resume();
+        }
+    }
+
+    bool ready() const noexcept { return (flags_.load(std::memory_order_acquire) & kHasResult) != 0U; }
+
+    /// @brief Blocks until the result is set.
+    void wait() noexcept
+    {
+#if INTERVIEW_RESULT_HAS_ATOMIC_WAIT
+        std::uint32_t flags = flags_.fetch_or(kWaiting, std::memory_order_acq_rel) | kWaiting;
+        while ((flags & kHasResult) == 0U)
+        {
+            flags_.wait(flags, std::memory_order_acquire);
+            flags = flags_.load(std::memory_order_acquire);
+        }
+#else
+        for (std::uint32_t spin = 0U; !ready(); ++spin)
+        {
+            if (spin < 64U)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+#endif
+    }
+
+    /// @pre The result is set.
+    Result<T, E>& result() noexcept { return result_; }
+
+    /// @brief Drops one of both references, the last one destructs the state.
+    void release() noexcept
+    {
+        if (references_.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+        {
+            delete this;
+        }
+    }
+
+  private:
+    static constexpr std::uint32_t kHasResult = 1U;
+    static constexpr std::uint32_t kHasContinuation = 2U;
+    static constexpr std::uint32_t kWaiting = 4U;
+
+    std::atomic<std::uint32_t> references_{2U}; /* Producer and consumer. */
+    std::atomic<std::uint32_t> flags_{0U};      /* Completion flags. */
+    AsyncContinuation* continuation_{nullptr};  /* Attached continuation. */
+    union
+    {
+        Result<T, E> result_; /* The result, constructed by the producer. */
+    };
+};
+
+/**
+ * @brief State of a stage computing its result from the result of the previous stage.
+ *
+ * It is the continuation of the previous stage and the task scheduled on the executor.
+ */
+template <typename T, typename E, typename U, typename Transform>
+class TransformState final : public AsyncState<U, E>, private AsyncContinuation, private AsyncTask
+{
+  public:
+    TransformState(AsyncState<T, E>* source, AsyncExecutor* executor, Transform&& transform)
+        : source_(source), executor_(executor), transform_(std::move(transform))
+    {
+    }
+
+    /// @brief Attaches the stage to the previous one.
+    void start() noexcept { source_->setContinuation(*this); }
+
+  private:
+    void resume() noexcept override
+    {
+        if (executor_ != nullptr)
+        {
+            executor_->execute(*this);
+        }
+        else
+        {
+            run();
+        }
+    }
+
+    void run() noexcept override
+    {
+        Result<U, E> result = transform_(std::move(source_->result()));
+        source_->release();
+        this->setResult(std::move(result));
+        this->release();
+    }
+
+    AsyncState<T, E>* source_; /* Previous stage. */
+    AsyncExecutor* executor_;  /* Executor of the transform, `nullptr` to run it inline. */
+    Transform transform_;      /* Computes the result of the stage. */
+};
+
+/**
+ * @brief State of a stage continuing with an AsyncResult returned by its function.
+ */
+template <typename T, typename E, typename U, typename F>
+class FlattenState final : public AsyncState<U, E>, private AsyncContinuation, private AsyncTask
+{
+  public:
+    FlattenState(AsyncState<T, E>* source, AsyncExecutor* executor, F&& function)
+        : source_(source), executor_(executor), function_(std::move(function)), forward_(*this)
+    {
+    }
+
+    void start() noexcept { source_->setContinuation(*this); }
+
+  private:
+    /// @brief Continuation of the inner AsyncResult, forwards its result.
+    class Forward final : public AsyncContinuation
+    {
+      public:
+        explicit Forward(FlattenState& owner) noexcept : owner_(owner) {}
+
+        void resume() noexcept override
+        {
+            Result<U, E> result(std::move(owner_.inner_->result()));
+            owner_.inner_->release();
+            owner_.setResult(std::move(result));
+            owner_.release();
+        }
+
+      private:
+        FlattenState& owner_;
+    };
+
+    void resume() noexcept override
+    {
+        if (executor_ != nullptr)
+        {
+            executor_->execute(*this);
+        }
+        else
+        {
+            run();
+        }
+    }
+
+    void run() noexcept override
+    {
+        Result<T, E>& source = source_->result();
+        if (!source.hasValue())
+        {
+            Result<U, E> result(inPlaceError, std::move(source).errorUnchecked());
+            source_->release();
+            this->setResult(std::move(result));
+            this->release();
+            return;
+        }
+        AsyncResult<U, E> inner = invokeWithValue(function_, std::move(source));
+        source_->release();
+        inner_ = inner.state_;
+        inner.state_ = nullptr;
+        inner_->setContinuation(forward_);
+    }
+
+    friend class Forward;
+
+    AsyncState<T, E>* source_;          /* Previous stage. */
+    AsyncExecutor* executor_;           /* Executor of the function, `nullptr` to run it inline. */
+    F function_;                        /* Returns the inner AsyncResult. */
+    AsyncState<U, E>* inner_{nullptr};  /* State of the inner AsyncResult. */
+    Forward forward_;                   /* Continuation of the inner AsyncResult. */
+};
+
+/**
+ * @brief State collecting the values of AsyncResult objects, see `whenAll`.
+ */
+template <typename T, typename E>
+class WhenAllState final : public AsyncState<std::vector<T>, E>
+{
+  public:
+    explicit WhenAllState(std::vector<AsyncResult<T, E>>&& inputs)
+        : slots_(inputs.size()), remaining_(inputs.size())
+    {
+        for (std::size_t index = 0U; index < inputs.size(); ++index)
+        {
+            slots_[index].owner_ = this;
+            slots_[index].source_ = inputs[index].state_;
+            inputs[index].state_ = nullptr;
+        }
+    }
+
+    void start() noexcept
+    {
+        if (slots_.empty())
+        {
+            finish();
+            return;
+        }
+        for (Slot& slot : slots_)
+        {
+            slot.source_->setContinuation(slot);
+        }
+    }
+
+  private:
+    struct Slot final : AsyncContinuation
+    {
+        void resume() noexcept override { owner_->arrive(); }
+
+        WhenAllState* owner_{nullptr};          /* State collecting the values. */
+        AsyncState<T, E>* source_{nullptr};     /* Collected AsyncResult. */
+    };
+
+    void arrive() noexcept
+    {
+        if (remaining_.fetch_sub(1U, std::memory_order_acq_rel) == 1U)
+        {
+            finish();
+        }
+    }
+
+    /// @brief Collects the values, or takes the error of the first input (by position) holding one.
+    void finish() noexcept
+    {
+        Result<std::vector<T>, E> result(inPlace);
+        result.discard();
+        for (Slot& slot : slots_)
+        {
+            Result<T, E>& input = slot.source_->result();
+            if (!input.hasValue())
+            {
+                result = Result<std::vector<T>, E>(inPlaceError, std::move(input).errorUnchecked());
+                break;
+            }
+            result->push_back(std::move(input).valueUnchecked());
+        }
+        for (Slot& slot : slots_)
+        {
+            slot.source_->release();
+        }
+        this->setResult(std::move(result));
+        this->release();
+    }
+
+    std::vector<Slot> slots_;             /* Continuations of the inputs, in the order of the inputs. */
+    std::atomic<std::size_t> remaining_;  /* Number of inputs without a result. */
+};
+
+/// @brief Checks whether the type is an AsyncResult.
+template <typename R>
+struct IsAsyncResult : std::false_type
+{
+};
+
+template <typename T, typename E>
+struct IsAsyncResult<AsyncResult<T, E>> : std::true_type
+{
+};
+
+/// @brief Error set by an AsyncPromise destructed without a result: `Status::ERROR` if `E` is created from it.
+template <typename E, std::enable_if_t<std::is_constructible<E, Status>::value, int> = 0>
+E brokenPromiseError()
+{
+    return E(Status::ERROR);
+}
+
+template <typename E, std::enable_if_t<!std::is_constructible<E, Status>::value, int> = 0>
+E brokenPromiseError()
+{
+    return E();
+}
+
+}  // namespace detail
+
+/**
+ * @brief Result of an asynchronous operation, available once the operation completes.
+ *
+ * Move-only handle of the state shared with the AsyncPromise of the operation. `get`, `then`, `andThen` and
+ * `whenAll` consume the handle, `valid()` is `false` afterwards. The continuations must not throw.
+ *
+ * @tparam T The type of the value.
+ * @tparam E The type of the error. Defaults to `Status`.
+ */
+template <typename T, typename E>
+class AsyncResult
+{
+  public:
+    using ValueType = T;
+    using ErrorType = E;
+
+    /// @brief Constructs an invalid handle.
+    AsyncResult() noexcept : state_(nullptr) {}
+
+    AsyncResult(AsyncResult&& other) noexcept : state_(other.state_) { other.state_ = nullptr; }
+
+    AsyncResult& operator=(AsyncResult&& other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            state_ = other.state_;
+            other.state_ = nullptr;
+        }
+        return *this;
+    }
+
+    AsyncResult(const AsyncResult&) = delete;
+    AsyncResult& operator=(const AsyncResult&) = delete;
+
+    ~AsyncResult() { reset(); }
+
+    /// @brief Check if the handle refers to a shared state.
+    bool valid() const noexcept { return state_ != nullptr; }
+
+    /**
+     * @brief Check if the result is available.
+     *
+     * @pre `valid()`
+     */
+    bool ready() const noexcept { return state_->ready(); }
+
+    /**
+     * @brief Blocks until the result is available.
+     *
+     * @pre `valid()`
+     */
+    void wait() const noexcept { state_->wait(); }
+
+    /**
+     * @brief Blocks until the result is available and moves it out.
+     *
+     * @pre `valid()`
+     * @post `!valid()`
+     * @return result of the operation.
+     */
+    Result<T, E> get()
+    {
+        state_->wait();
+        Result<T, E> result(std::move(state_->result()));
+        reset();
+        return result;
+    }
+
+    /**
+     * @brief Maps the value once it is available, see `Result::map`.
+     *
+     * The function runs in the thread completing the operation, or right away when it already completed.
+     *
+     * @pre `valid()`
+     * @post `!valid()`
+     * @param f callable taking the value and returning the new value `U`.
+     * @return `AsyncResult<U, E>` with the mapped value or the original error.
+     */
+    template <typename F>
+    auto then(F&& f)
+    {
+        return thenOn(nullptr, std::forward<F>(f));
+    }
+
+    /**
+     * @brief Maps the value once it is available, the function runs on the executor.
+     *
+     * @pre `valid()`
+     * @post `!valid()`
+     * @param executor executor running the function, must outlive the operation.
+     * @param f callable taking the value and returning the new value `U`.
+     * @return `AsyncResult<U, E>` with the mapped value or the original error.
+     */
+    template <typename F>
+    auto then(AsyncExecutor& executor, F&& f)
+    {
+        return thenOn(&executor, std::forward<F>(f));
+    }
+
+    /**
+     * @brief Chains the fallible operation once the value is available, see `Result::andThen`.
+     *
+     * @pre `valid()`
+     * @post `!valid()`
+     * @param f callable taking the value and returning `Result<U, E>` or `AsyncResult<U, E>`.
+     * @return `AsyncResult<U, E>` with the result of the operation or the original error.
+     */
+    template <typename F>
+    auto andThen(F&& f)
+    {
+        return andThenOn(nullptr, std::forward<F>(f));
+    }
+
+    /**
+     * @brief Chains the fallible operation once the value is available, the function runs on the executor.
+     *
+     * @pre `valid()`
+     * @post `!valid()`
+     * @param executor executor running the function, must outlive the operation.
+     * @param f callable taking the value and returning `Result<U, E>` or `AsyncResult<U, E>`.
+     * @return `AsyncResult<U, E>` with the result of the operation or the original error.
+     */
+    template <typename F>
+    auto andThen(AsyncExecutor& executor, F&& f)
+    {
+        return andThenOn(&executor, std::forward<F>(f));
+    }
+
+  private:
+    template <typename, typename>
+    friend class AsyncResult;
+    friend class AsyncPromise<T, E>;
+    template <typename, typename, typename, typename>
+    friend class detail::FlattenState;
+    friend class detail::WhenAllState<T, E>;
+
+    explicit AsyncResult(detail::AsyncState<T, E>* state) noexcept : state_(state) {}
+
+    void reset() noexcept
+    {
+        if (state_ != nullptr)
+        {
+            state_->release();
+            state_ = nullptr;
+        }
+    }
+
+    template <typename F>
+    auto thenOn(AsyncExecutor* executor, F&& f)
+    {
+        using Function = std::decay_t<F>;
+        using Mapped = decltype(std::declval<Result<T, E>>().map(std::declval<Function&>()));
+        auto transform = [function = Function(std::forward<F>(f))](Result<T, E>&& source) mutable {
+            return std::move(source).map(function);
+        };
+        return chain<typename Mapped::ValueType>(executor, std::move(transform));
+    }
+
+    template <typename F>
+    auto andThenOn(AsyncExecutor* executor, F&& f)
+    {
+        using Returned = std::decay_t<decltype(
+            detail::invokeWithValue(std::declval<std::decay_t<F>&>(), std::declval<Result<T, E>>()))>;
+        static_assert(std::is_same<typename Returned::ErrorType, E>::value,
+                      "andThen callable must return a result with the same error type");
+        return andThenImpl(detail::IsAsyncResult<Returned>{}, executor, std::forward<F>(f));
+    }
+
+    template <typename F>
+    auto andThenImpl(std::false_type, AsyncExecutor* executor, F&& f)
+    {
+        using Function = std::decay_t<F>;
+        using Chained = decltype(std::declval<Result<T, E>>().andThen(std::declval<Function&>()));
+        auto transform = [function = Function(std::forward<F>(f))](Result<T, E>&& source) mutable {
+            return std::move(source).andThen(function);
+        };
+        return chain<typename Chained::ValueType>(executor, std::move(transform));
+    }
+
+    template <typename F>
+    auto andThenImpl(std::true_type, AsyncExecutor* executor, F&& f)
+    {
+        using Function = std::decay_t<F>;
+        using U = typename std::decay_t<decltype(
+            detail::invokeWithValue(std::declval<Function&>(), std::declval<Result<T, E>>()))>::ValueType;
+        auto* state = new detail::FlattenState<T, E, U, Function>(state_, executor, Function(std::forward<F>(f)));
+        state_ = nullptr;
+        state->start();
+        return AsyncResult<U, E>(state);
+    }
+
+    template <typename U, typename Transform>
+    AsyncResult<U, E> chain(AsyncExecutor* executor, Transform&& transform)
+    {
+        auto* state = new detail::TransformState<T, E, U, std::decay_t<Transform>>(
+            state_, executor, std::forward<Transform>(transform));
+        state_ = nullptr;
+        state->start();
+        return AsyncResult<U, E>(state);
+    }
+
+    template <typename U, typename G>
+    friend AsyncResult<std::vector<U>, G> whenAll(std::vector<AsyncResult<U, G>>&& inputs);
+
+    detail::AsyncState<T, E>* state_; /* Shared state, `nullptr` for an invalid handle. */
+};
+
+/**
+ * @brief Producer of an AsyncResult, sets the result of the operation once.
+ *
+ * Destructing the promise without setting the result sets `Status::ERROR` (or a default constructed `E` when it
+ * cannot be created from a `Status`).
+ *
+ * @tparam T The type of the value.
+ * @tparam E The type of the error. Defaults to `Status`.
+ */
+template <typename T, typename E>
+class AsyncPromise
+{
+  public:
+    /// @brief Allocates the shared state.
+    AsyncPromise() : state_(new detail::AsyncState<T, E>()), retrieved_(false) {}
+
+    AsyncPromise(AsyncPromise&& other) noexcept : state_(other.state_), retrieved_(other.retrieved_)
+    {
+        other.state_ = nullptr;
+    }
+
+    AsyncPromise(const AsyncPromise&) = delete;
+    AsyncPromise& operator=(const AsyncPromise&) = delete;
+    AsyncPromise& operator=(AsyncPromise&&) = delete;
+
+    ~AsyncPromise()
+    {
+        if (state_ != nullptr)
+        {
+            setResult(Result<T, E>(inPlaceError, detail::brokenPromiseError<E>()));
+        }
+    }
+
+    /**
+     * @brief Get the AsyncResult of the operation.
+     *
+     * @pre Called at most once, before the result is set.
+     */
+    AsyncResult<T, E> getAsyncResult() noexcept
+    {
+        retrieved_ = true;
+        return AsyncResult<T, E>(state_);
+    }
+
+    /**
+     * @brief Sets the result, runs the inline continuations in this thread.
+     *
+     * @pre Called at most once.
+     * @param result value or error of the operation.
+     */
+    void setResult(Result<T, E> result) noexcept
+    {
+        detail::AsyncState<T, E>* state = state_;
+        state_ = nullptr;
+        state->setResult(std::move(result));
+        if (!retrieved_)
+        {
+            state->release();
+        }
+        state->release();
+    }
+
+  private:
+    detail::AsyncState<T, E>* state_; /* Shared state, `nullptr` once the result is set. */
+    bool retrieved_;                  /* Set once the AsyncResult took over the consumer reference. */
+};
+
+/**
+ * @brief Creates an AsyncResult which is already available.
+ *
+ * @param result value or error of the operation.
+ */
+template <typename T, typename E>
+AsyncResult<T, E> makeReadyAsyncResult(Result<T, E> result)
+{
+    AsyncPromise<T, E> promise;
+    AsyncResult<T, E> asyncResult = promise.getAsyncResult();
+    promise.setResult(std::move(result));
+    return asyncResult;
+}
+
+/**
+ * @brief Collects the values of the AsyncResult objects once all of them are available.
+ *
+ * Errors short-circuit like in `Result::andThen`: the result holds the error of the first input (by position)
+ * holding one. It is available only once all the inputs are, the operations are not cancelled.
+ *
+ * @param inputs results to collect, consumed.
+ * @return AsyncResult of the values in the order of the inputs.
+ */
+template <typename T, typename E>
+AsyncResult<std::vector<T>, E> whenAll(std::vector<AsyncResult<T, E>>&& inputs)
+{
+    static_assert(!std::is_void<T>::value && !std::is_reference<T>::value, "whenAll collects object values");
+    auto* state = new detail::WhenAllState<T, E>(std::move(inputs));
+    state->start();
+    return AsyncResult<std::vector<T>, E>(state);
+}
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_ASYNC_RESULT_HPP
@@ -0,0 +1,220 @@
+/**
+ * @file atomic_result_slot.hpp
+ * @brief Definition of the AtomicResultSlot class.
+ *
+ * This file contains the definition of the AtomicResultSlot class, the lock-free hand-off of a `Result` from one
+ * producer thread to one or more consumer threads. The producer constructs the result in the slot and publishes it
+ * with a single release store of the state word; the consumers poll the state wait-free or block on it with
+ * `std::atomic::wait` (a futex on Linux) under C++20, with polling otherwise. The slot holds a plain `Result`
+ * object, so taking it out is a move of the `Result`, a memcpy for trivially copyable values and errors.
+ *
+ * @note This class is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_ATOMIC_RESULT_SLOT_HPP
+#define INTERVIEW_LIBRARY_ATOMIC_RESULT_SLOT_HPP
+
+#include "lib/result.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if !INTERVIEW_RESULT_HAS_ATOMIC_WAIT
+#include <chrono>
+#include <thread>
+#endif
+
+namespace interview
+{
+namespace library
+{
+
+/**
+ * @brief Single producer, multiple consumer slot of a `Result<T, E>`.
+ *
+ * The producer publishes one result at a time. The consumers either read it with `tryGet()` or `wait()`, or take
+ * it out with `take()`, which empties the slot for the next result. Consumers taking concurrently each get another
+ * result. Consumers reading a result must be done before it is taken or reset.
+ *
+ * @tparam T The type of the value.
+ * @tparam E The type of the error. Defaults to `Status`.
+ */
+template <typename T, typename E>
+class AtomicResultSlot
+{
+  public:
+    using ValueType = T;
+    using ErrorType = E;
+
+    /// @brief Constructs an empty slot.
+    AtomicResultSlot() noexcept {}
+
+    AtomicResultSlot(const AtomicResultSlot&) = delete;
+    AtomicResultSlot& operator=(const AtomicResultSlot&) = delete;
+
+    ~AtomicResultSlot()
+    {
+        if (state_.load(std::memory_order_acquire) == kReady)
+        {
+            result_.discard();
+            result_.~Result();
+        }
+    }
+
+    /**
+     * @brief Constructs the result in the slot and publishes it to the consumers.
+     *
+     * @code
+     * slot.publish(42U);
+     * slot.publish(createError(Status::ERROR));
+     * slot.publish(inPlace, "constructed", 11U);
+     * @endcode
+     *
+     * @pre The slot is empty: it was never published, taken or reset. Called by the producer only.
+     * @param args arguments of the constructor of `Result<T, E>`.
+     */
+    template <typename... Args>
+    void publish(Args&&... args) noexcept(std::is_nothrow_constructible<Result<T, E>, Args&&...>::value)
+    {
+        ::new (static_cast<void*>(&result_)) Result<T, E>(std::forward<Args>(args)...);
+        state_.store(kReady, std::memory_order_release);
+#if INTERVIEW_RESULT_HAS_ATOMIC_WAIT
+        state_.notify_all();
+#endif
+    }
+
+    /// @brief Check if the slot is empty, so the producer can publish the next result, wait-free.
+    bool empty() const noexcept { return state_.load(std::memory_order_acquire) == kEmpty; }
+
+    /// @brief Check if a result is published, wait-free.
+    bool ready() const noexcept { return state_.load(std::memory_order_acquire) == kReady; }
+
+    /**
+     * @brief Get the published result without blocking, wait-free.
+     *
+     * @return result, `nullptr` if the slot is empty.
+     */
+    const Result<T, E>* tryGet() const noexcept { return ready() ? &result_ : nullptr; }
+
+    /**
+     * @brief Blocks until a result is published.
+     *
+     * @return result, valid until it is taken or the slot is reset.
+     */
+    const Result<T, E>& wait() const noexcept
+    {
+        awaitPublication();
+        return result_;
+    }
+
+    /**
+     * @brief Blocks until a result is published and moves it out, the slot is empty afterwards.
+     *
+     * When moving the result out throws, the result stays published and another consumer can take it.
+     *
+     * @return result.
+     */
+    Result<T, E> take() noexcept(std::is_nothrow_move_constructible<Result<T, E>>::value)
+    {
+        std::uint32_t ready = kReady;
+        do
+        {
+            awaitPublication();
+            ready = kReady;
+        } while (!state_.compare_exchange_weak(ready, kTaking, std::memory_order_acquire, std::memory_order_relaxed));
+        TakeGuard guard(*this);
+        Result<T, E> result(std::move(result_));
+        guard.release();
+        result_.~Result();
+        state_.store(kEmpty, std::memory_order_release);
+        return result;
+    }
+
+    /**
+     * @brief Discards the published result, the slot is empty afterwards.
+     *
+     * @pre No consumer uses the result. Called by the producer only.
+     */
+    void reset() noexcept
+    {
+        if (state_.load(std::memory_order_acquire) == kReady)
+        {
+            result_.discard();
+            result_.~Result();
+            state_.store(kEmpty, std::memory_order_release);
+        }
+    }
+
+  private:  // methods
+    /// @brief Publishes the result again unless released, so a throwing move does not leave the slot taking.
+    class TakeGuard
+    {
+      public:
+        explicit TakeGuard(AtomicResultSlot& slot) noexcept : slot_(&slot) {}
+
+        TakeGuard(const TakeGuard&) = delete;
+        TakeGuard& operator=(const TakeGuard&) = delete;
+
+        ~TakeGuard()
+        {
+            if (slot_ != nullptr)
+            {
+                slot_->state_.store(kReady, std::memory_order_release);
+#if INTERVIEW_RESULT_HAS_ATOMIC_WAIT
+                slot_->state_.notify_all();
+#endif
+            }
+        }
+
+        /// @brief The result is moved out, the slot is emptied by `take()`.
+        void release() noexcept { slot_ = nullptr; }
+
+      private:  // members
+        AtomicResultSlot* slot_; /* Slot being taken, `nullptr` once released. */
+    };
+
+    /// @brief Blocks until the state is ready.
+    void awaitPublication() const noexcept
+    {
+#if INTERVIEW_RESULT_HAS_ATOMIC_WAIT
+        std::uint32_t state = state_.load(std::memory_order_acquire);
+        while (state != kReady)
+        {
+            state_.wait(state, std::memory_order_acquire);
+            state = state_.load(std::memory_order_acquire);
+        }
+#else
+        for (std::uint32_t spin = 0U; state_.load(std::memory_order_acquire) != kReady; ++spin)
+        {
+            if (spin < 64U)
+            {
+                std::this_thread::yield();
+            }
+            else
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+#endif
+    }
+
+  private:  // members
+    static constexpr std::uint32_t kEmpty = 0U;
+    static constexpr std::uint32_t kReady = 1U;
+    static constexpr std::uint32_t kTaking = 2U;
+
+    std::atomic<std::uint32_t> state_{kEmpty}; /* Empty, ready or being taken. */
+    union
+    {
+        Result<T, E> result_; /* Constructed by publish(), destructed by take() and reset(). */
+    };
+};
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_ATOMIC_RESULT_SLOT_HPP
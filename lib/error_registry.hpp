@@ -0,0 +1,271 @@
+/**
+ * @file error_registry.hpp
+ * @brief Definition of the ErrorRegistry class.
+ *
+ * This file contains the definition of the ErrorRegistry class, a table of error messages
+ * which modules intern for their own error codes at startup. Codes are keyed by their
+ * domain, the enumeration type of the code, so codes of different modules do not clash.
+ * The entries and the message characters are stored in buffers allocated once, when the
+ * registry is constructed, so interning and describing errors never allocates. Lookups
+ * are lock-free and can run concurrently with interning.
+ *
+ * @note This class is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_ERROR_REGISTRY_HPP
+#define INTERVIEW_LIBRARY_ERROR_REGISTRY_HPP
+
+#include "lib/result.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+namespace interview
+{
+namespace library
+{
+
+/**
+ * @brief Identifier of the domain of error codes, unique per tag type.
+ */
+class ErrorDomain
+{
+  public:
+    /**
+     * @brief Get the domain of the tag type, usually the enumeration of the codes.
+     *
+     * @tparam Tag type identifying the domain.
+     * @return domain, equal for all calls with the same tag.
+     */
+    template <typename Tag>
+    static ErrorDomain of() noexcept
+    {
+        static const char anchor = 0;
+        return ErrorDomain(&anchor);
+    }
+
+    bool operator==(const ErrorDomain& other) const noexcept { return id_ == other.id_; }
+    bool operator!=(const ErrorDomain& other) const noexcept { return id_ != other.id_; }
+
+    /// @brief Get the value identifying the domain.
+    std::uintptr_t id() const noexcept { return reinterpret_cast<std::uintptr_t>(id_); }
+
+  private:
+    explicit ErrorDomain(const void* id) noexcept : id_(id) {}
+
+    const void* id_; /* Address of the anchor of the tag type. */
+};
+
+/**
+ * @brief Table of error messages interned per domain and code.
+ */
+class ErrorRegistry
+{
+  public:
+    /// @brief Capacity of the registry returned by `global()`.
+    static constexpr std::size_t kDefaultEntries = 1024U;
+    static constexpr std::size_t kDefaultArenaBytes = 64U * 1024U;
+
+    /**
+     * @brief Constructs a registry, allocates all the storage it will use.
+     *
+     * @param maxEntries maximum number of interned messages.
+     * @param arenaBytes bytes available for the messages, including the terminating nulls.
+     */
+    explicit ErrorRegistry(std::size_t maxEntries = kDefaultEntries, std::size_t arenaBytes = kDefaultArenaBytes)
+        : mask_(slotCountFor(maxEntries) - 1U),
+          maxEntries_(maxEntries),
+          slots_(new Slot[mask_ + 1U]),
+          arena_(new char[arenaBytes]),
+          arenaBytes_(arenaBytes)
+    {
+    }
+
+    ErrorRegistry(const ErrorRegistry&) = delete;
+    ErrorRegistry& operator=(const ErrorRegistry&) = delete;
+
+    /**
+     * @brief Get the registry shared by the modules of the program.
+     */
+    static ErrorRegistry& global()
+    {
+        static ErrorRegistry registry;
+        return registry;
+    }
+
+    /**
+     * @brief Interns the message of the code.
+     *
+     * The message is copied into the registry. The first message interned for the code is kept.
+     *
+     * @param domain domain of the code.
+     * @param code error code.
+     * @param message null terminated message.
+     * @return interned message, `nullptr` if the registry is full.
+     * @throws std::system_error If the mutex of the registry cannot be locked.
+     */
+    const char* intern(ErrorDomain domain, std::uint32_t code, const char* message)
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        Slot* slot = probe(domain, code);
+        if (slot->ready_.load(std::memory_order_relaxed))
+        {
+            return slot->message_;
+        }
+        const std::size_t size = std::strlen(message) + 1U;
+        if ((entries_ == maxEntries_) || (size > (arenaBytes_ - arenaUsed_)))
+        {
+            return nullptr;
+        }
+        char* stored = arena_.get() + arenaUsed_;
+        std::memcpy(stored, message, size);
+        arenaUsed_ += size;
+        ++entries_;
+        slot->domain_ = domain.id();
+        slot->code_ = code;
+        slot->message_ = stored;
+        slot->ready_.store(true, std::memory_order_release);
+        return stored;
+    }
+
+    /**
+     * @brief Interns the message of the enumerated code, the enumeration is the domain.
+     *
+     * @param code error code.
+     * @param message null terminated message.
+     * @return interned message, `nullptr` if the registry is full.
+     * @throws std::system_error If the mutex of the registry cannot be locked.
+     */
+    template <typename Code, typename = std::enable_if_t<std::is_enum<Code>::value>>
+    const char* intern(Code code, const char* message)
+    {
+        return intern(ErrorDomain::of<Code>(), static_cast<std::uint32_t>(code), message);
+    }
+
+    /**
+     * @brief Get the message of the code, lock-free.
+     *
+     * @param domain domain of the code.
+     * @param code error code.
+     * @return interned message, `nullptr` if no message was interned for the code.
+     */
+    const char* lookup(ErrorDomain domain, std::uint32_t code) const noexcept
+    {
+        const Slot* slot = probe(domain, code);
+        // The free slot ending the probe sequence may be taken by another code meanwhile, compare the key again
+        if (!slot->ready_.load(std::memory_order_acquire) || (slot->domain_ != domain.id()) || (slot->code_ != code))
+        {
+            return nullptr;
+        }
+        return slot->message_;
+    }
+
+    /// @copydoc lookup(ErrorDomain, std::uint32_t) const
+    template <typename Code, typename = std::enable_if_t<std::is_enum<Code>::value>>
+    const char* lookup(Code code) const noexcept
+    {
+        return lookup(ErrorDomain::of<Code>(), static_cast<std::uint32_t>(code));
+    }
+
+    /**
+     * @brief Get the description of the code, never fails.
+     *
+     * @param code error code.
+     * @return interned message, the name of the status for `Status` codes without one,
+     *         `"unknown error"` otherwise.
+     */
+    template <typename Code, typename = std::enable_if_t<std::is_enum<Code>::value>>
+    const char* describe(Code code) const noexcept
+    {
+        const char* message = lookup(code);
+        return (message != nullptr) ? message : fallbackDescription(code);
+    }
+
+    /// @brief Get the number of interned messages, throws `std::system_error` if the mutex cannot be locked.
+    std::size_t size() const
+    {
+        const std::lock_guard<std::mutex> lock(mutex_);
+        return entries_;
+    }
+
+  private:  // methods
+    struct Slot
+    {
+        std::atomic<bool> ready_{false}; /* Set once the fields below are published. */
+        std::uintptr_t domain_{0U};      /* Domain of the code. */
+        std::uint32_t code_{0U};         /* Error code. */
+        const char* message_{nullptr};   /* Interned message. */
+    };
+
+    /// @brief Twice as many slots as entries (power of two), so probe sequences stay short.
+    static std::size_t slotCountFor(std::size_t maxEntries) noexcept
+    {
+        std::size_t count = 2U;
+        while (count < (2U * maxEntries))
+        {
+            count *= 2U;
+        }
+        return count;
+    }
+
+    static std::size_t hash(ErrorDomain domain, std::uint32_t code) noexcept
+    {
+        const std::uint64_t key = (static_cast<std::uint64_t>(domain.id()) >> 3U) ^
+                                  (static_cast<std::uint64_t>(code) * 0x9E3779B97F4A7C15ULL);
+        const std::uint64_t mixed = (key ^ (key >> 29U)) * 0xBF58476D1CE4E5B9ULL;
+        return static_cast<std::size_t>(mixed ^ (mixed >> 32U));
+    }
+
+    /**
+     * @brief Find the slot of the code, or the free slot where it is interned.
+     *
+     * Slots are never released, the free slot ends the probe sequence. The table has
+     * more slots than entries, so a free slot always exists.
+     */
+    const Slot* probe(ErrorDomain domain, std::uint32_t code) const noexcept
+    {
+        for (std::size_t index = hash(domain, code);; ++index)
+        {
+            const Slot& slot = slots_[index & mask_];
+            if (!slot.ready_.load(std::memory_order_acquire) ||
+                ((slot.domain_ == domain.id()) && (slot.code_ == code)))
+            {
+                return &slot;
+            }
+        }
+    }
+
+    Slot* probe(ErrorDomain domain, std::uint32_t code) noexcept
+    {
+        return const_cast<Slot*>(static_cast<const ErrorRegistry*>(this)->probe(domain, code));
+    }
+
+    static const char* fallbackDescription(Status code) noexcept { return toString(code); }
+
+    template <typename Code>
+    static const char* fallbackDescription(Code /* code */) noexcept
+    {
+        return "unknown error";
+    }
+
+  private:  // members
+    const std::size_t mask_;         /* Number of slots minus one. */
+    const std::size_t maxEntries_;   /* Maximum number of interned messages. */
+    std::unique_ptr<Slot[]> slots_;  /* Open addressing table of the messages. */
+    std::unique_ptr<char[]> arena_;  /* Characters of the messages. */
+    const std::size_t arenaBytes_;   /* Size of the arena. */
+    std::size_t arenaUsed_{0U};      /* Bytes of the arena used. */
+    std::size_t entries_{0U};        /* Number of interned messages. */
+    mutable std::mutex mutex_;       /* Serializes interning. */
+};
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_ERROR_REGISTRY_HPP
@@ -0,0 +1,128 @@
+/**
+ * @file request_arena.hpp
+ * @brief Definition of the RequestArena class.
+ *
+ * This file contains the definition of the RequestArena class, a monotonic memory arena for the `Result` objects
+ * of one request. Payloads and errors using `std::pmr` allocators (`std::pmr::string`, containers, `RichError`
+ * messages) are constructed in the arena with uses-allocator construction, freeing them is a no-op and `reset()`
+ * releases the memory of the whole request at once. The first block is reused across the requests, so a request
+ * fitting into it does not touch the global heap.
+ *
+ * Requires `std::pmr` (C++17).
+ *
+ * @note This class is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_REQUEST_ARENA_HPP
+#define INTERVIEW_LIBRARY_REQUEST_ARENA_HPP
+
+#include "lib/result.hpp"
+
+#if !INTERVIEW_RESULT_HAS_PMR
+#error "lib/request_arena.hpp requires std::pmr (C++17)"
+#endif
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace interview
+{
+namespace library
+{
+
+/**
+ * @brief Monotonic arena for the results of one request.
+ *
+ * Not thread safe, use an arena per request or per thread. The objects allocated in the arena must be destructed
+ * or abandoned before `reset()`.
+ */
+class RequestArena
+{
+  public:
+    /// @brief Allocator of the arena, converts to any `std::pmr::polymorphic_allocator`.
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+    /// @brief Default size of the first block.
+    static constexpr std::size_t kDefaultCapacity = 4096U;
+
+    /**
+     * @brief Allocates the first block.
+     *
+     * @param capacity size of the first block, reused after every `reset()`.
+     * @param upstream memory resource of the blocks, kept by the arena until it is destructed.
+     */
+    explicit RequestArena(std::size_t capacity = kDefaultCapacity,
+                          std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : upstream_(upstream),
+          capacity_(capacity),
+          buffer_(upstream->allocate(capacity, alignof(std::max_align_t))),
+          resource_(buffer_, capacity, upstream)
+    {
+    }
+
+    RequestArena(const RequestArena&) = delete;
+    RequestArena& operator=(const RequestArena&) = delete;
+
+    ~RequestArena()
+    {
+        resource_.release();
+        upstream_->deallocate(buffer_, capacity_, alignof(std::max_align_t));
+    }
+
+    /// @brief Get the memory resource of the arena.
+    std::pmr::memory_resource* resource() noexcept { return &resource_; }
+
+    /// @brief Get an allocator of the arena.
+    allocator_type allocator() noexcept { return allocator_type(&resource_); }
+
+    /**
+     * @brief Releases the memory of all the objects allocated so far, the first block is reused.
+     *
+     * @pre The objects allocated in the arena are no longer used.
+     */
+    void reset() noexcept { resource_.release(); }
+
+    /**
+     * @brief Constructs a Result with the value in the arena.
+     *
+     * @code
+     * Result<std::pmr::string> greeting = arena.makeResult<std::pmr::string>("Hello, ");
+     * @endcode
+     *
+     * @tparam T The type of the value.
+     * @tparam E The type of the error. Defaults to `Status`.
+     * @param args arguments of the constructor of `T`, the allocator of the arena is passed on when `T` uses it.
+     */
+    template <typename T, typename E = Status, typename... Args>
+    Result<T, E> makeResult(Args&&... args)
+    {
+        return Result<T, E>(std::allocator_arg, allocator(), inPlace, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Constructs a Result with the error in the arena, e.g. the long message of a `RichError`.
+     *
+     * @tparam T The type of the value.
+     * @tparam E The type of the error. Defaults to `Status`.
+     * @param args arguments of the constructor of `E`, the allocator of the arena is passed on when `E` uses it.
+     */
+    template <typename T, typename E = Status, typename... Args>
+    Result<T, E> makeError(Args&&... args)
+    {
+        return Result<T, E>(std::allocator_arg, allocator(), inPlaceError, std::forward<Args>(args)...);
+    }
+
+  private:  // members
+    std::pmr::memory_resource* upstream_;          /* Memory resource of the blocks. */
+    std::size_t capacity_;                         /* Size of the first block. */
+    void* buffer_;                                 /* First block. */
+    std::pmr::monotonic_buffer_resource resource_; /* Arena. */
+};
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_REQUEST_ARENA_HPP
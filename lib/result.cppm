@@ -0,0 +1,64 @@
+/**
+ * @file result.cppm
+ * @brief C++20 module interface of the Result library.
+ *
+ * Exports the declarations of `result.hpp`, so a translation unit can `import interview.result;` instead of
+ * parsing the header and the standard headers behind it. The header is compiled once, in the global module
+ * fragment, with the configuration of this unit: the configuration macros (`INTERVIEW_RESULT_STATUS_TYPE`,
+ * `INTERVIEW_RESULT_AUDIT`, ...) must match in all importers, as with the header. Macros are not exported:
+ * code using `RESULT_TRY` includes `result.hpp` in addition, which costs little once the module is imported.
+ *
+ * The specializations of `std::hash`, `std::uses_allocator` and `std::coroutine_traits` come with the exported
+ * class template `Result`.
+ *
+ * @note This file is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+module;
+
+#include "lib/result.hpp"
+
+export module interview.result;
+
+export namespace interview
+{
+namespace library
+{
+
+using library::createError;
+using library::ErrorCreate;
+using library::InPlace;
+using library::inPlace;
+using library::InPlaceError;
+using library::inPlaceError;
+using library::makeResult;
+using library::Result;
+using library::ResultErrorCodeTraits;
+using library::ResultExceptionTraits;
+using library::ResultNicheTraits;
+using library::ResultTerminateHandler;
+using library::setResultTerminateHandler;
+using library::Status;
+using library::swap;
+using library::toString;
+using library::tryInvoke;
+using library::operator==;
+using library::operator!=;
+using library::operator<;
+using library::operator>;
+using library::operator<=;
+using library::operator>=;
+
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+using library::ResultException;
+#endif
+
+#if INTERVIEW_RESULT_AUDIT
+using library::AuditViolation;
+using library::ResultAuditHandler;
+using library::setResultAuditHandler;
+#endif
+
+}  // namespace library
+}  // namespace interview
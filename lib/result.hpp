@@ -10,7 +10,17 @@
  *
  * The Result class is templated on two types: T (the value type) and E (the
  * error type). The error type is optional and defaults to the enum class
- * Status, which represents different status codes.
+ * Status, which represents different status codes. Any other object type can be
+ * used as an error, see `RichError` from `rich_error.hpp` for a compact error
+ * carrying context.
+ *
+ * Invalid access with `getValue()`/`getError()` throws `std::runtime_error`. When the code is built without
+ * exceptions (`-fno-exceptions`) the handler installed with `setResultTerminateHandler` is called instead and the
+ * program is aborted. The unchecked accessors (`operator*`, `operator->`, `valueUnchecked()`, `errorUnchecked()`)
+ * and the non-throwing ones (`valueOr()`, `getIf()`) never check nor throw.
+ *
+ * Errors are propagated to the caller with `RESULT_TRY(var, expr)`, or with `co_await` in coroutines returning
+ * `Result` when C++20 coroutines are available.
  *
  * @note This class is part of the interview::library namespace.
  * @author Daniel Wieczorek
@@ -19,9 +29,162 @@
 #ifndef INTERVIEW_LIBRARY_RESULT_HPP
 #define INTERVIEW_LIBRARY_RESULT_HPP
 
-#include <functional>
-#include <iostream>
+#include "lib/result_fwd.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <new>
 #include <type_traits>
+#include <utility>
+
+/// @brief Set to 1 when exceptions are enabled, can be predefined to force the behavior.
+#ifndef INTERVIEW_RESULT_HAS_EXCEPTIONS
+#if defined(__cpp_exceptions) || defined(__EXCEPTIONS) || defined(_CPPUNWIND)
+#define INTERVIEW_RESULT_HAS_EXCEPTIONS 1
+#else
+#define INTERVIEW_RESULT_HAS_EXCEPTIONS 0
+#endif
+#endif
+
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+#include <stdexcept>
+#endif
+
+/// @brief Moves a function off the hot path: never inlined and placed together with the rarely executed code.
+#if defined(__GNUC__) || defined(__clang__)
+#define INTERVIEW_RESULT_COLD __attribute__((cold, noinline))
+#elif defined(_MSC_VER)
+#define INTERVIEW_RESULT_COLD __declspec(noinline)
+#else
+#define INTERVIEW_RESULT_COLD
+#endif
+
+/// @brief Branch hints, the condition is converted to `bool`.
+#if defined(__GNUC__) || defined(__clang__)
+#define INTERVIEW_RESULT_LIKELY(condition) __builtin_expect(static_cast<bool>(condition), 1)
+#define INTERVIEW_RESULT_UNLIKELY(condition) __builtin_expect(static_cast<bool>(condition), 0)
+#else
+#define INTERVIEW_RESULT_LIKELY(condition) static_cast<bool>(condition)
+#define INTERVIEW_RESULT_UNLIKELY(condition) static_cast<bool>(condition)
+#endif
+
+/**
+ * @brief Outcome expected by the branch hints of `hasValue()` and `operator bool`: `1` expects values (default),
+ * `-1` expects errors (validators rejecting most of their input), `0` gives no hints.
+ *
+ * The branches of the unexpected outcome are laid out after the hot code. The hints reach the branches of the
+ * caller through the inlined accessors, so they apply to the combinators and `RESULT_TRY` as well. All
+ * translation units of a program must agree on the policy, see `--define result_likelihood=...` in BUILD.
+ */
+#ifndef INTERVIEW_RESULT_LIKELIHOOD
+#define INTERVIEW_RESULT_LIKELIHOOD 1
+#endif
+
+/// @brief Applies the likelihood policy to the test for a value.
+#if INTERVIEW_RESULT_LIKELIHOOD > 0
+#define INTERVIEW_RESULT_PREDICT_VALUE(hasValue) INTERVIEW_RESULT_LIKELY(hasValue)
+#elif INTERVIEW_RESULT_LIKELIHOOD < 0
+#define INTERVIEW_RESULT_PREDICT_VALUE(hasValue) INTERVIEW_RESULT_UNLIKELY(hasValue)
+#else
+#define INTERVIEW_RESULT_PREDICT_VALUE(hasValue) static_cast<bool>(hasValue)
+#endif
+
+/// @brief `constexpr` for the operations which need C++20: non-trivial destructors and changing the active member.
+#if __cplusplus >= 202002L
+#define INTERVIEW_RESULT_CONSTEXPR20 constexpr
+#else
+#define INTERVIEW_RESULT_CONSTEXPR20
+#endif
+
+/// @brief Set to 1 when C++20 coroutines are available, `Result` can then be returned from coroutines.
+#ifndef INTERVIEW_RESULT_HAS_COROUTINES
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define INTERVIEW_RESULT_HAS_COROUTINES 1
+#endif
+#endif
+#endif
+#ifndef INTERVIEW_RESULT_HAS_COROUTINES
+#define INTERVIEW_RESULT_HAS_COROUTINES 0
+#endif
+
+#if INTERVIEW_RESULT_HAS_COROUTINES
+#include <coroutine>
+#endif
+
+/// @brief Set to 1 when `std::pmr` is available, see `lib/request_arena.hpp`.
+#ifndef INTERVIEW_RESULT_HAS_PMR
+#if (__cplusplus >= 201703L) && defined(__has_include)
+#if __has_include(<memory_resource>)
+#define INTERVIEW_RESULT_HAS_PMR 1
+#endif
+#endif
+#endif
+#ifndef INTERVIEW_RESULT_HAS_PMR
+#define INTERVIEW_RESULT_HAS_PMR 0
+#endif
+
+/// @brief Set to 1 when `std::atomic::wait` is available, waiting falls back to polling otherwise.
+#ifndef INTERVIEW_RESULT_HAS_ATOMIC_WAIT
+#if defined(__cpp_lib_atomic_wait) && (__cpp_lib_atomic_wait >= 201907L)
+#define INTERVIEW_RESULT_HAS_ATOMIC_WAIT 1
+#else
+#define INTERVIEW_RESULT_HAS_ATOMIC_WAIT 0
+#endif
+#endif
+
+/// @brief Set to 1 to count the errors created by each `createError()` call site, see `lib/result_stats.hpp`.
+#ifndef INTERVIEW_RESULT_STATS
+#define INTERVIEW_RESULT_STATS 0
+#endif
+
+/**
+ * @brief Set to 1 to audit the use of `Result` in debug and staging builds.
+ *
+ * Each `Result` then records whether its outcome was checked: `hasValue()`, `operator bool`, `valueOr()`,
+ * `getIf()`, `emplace()`, `discard()` and everything built on them (the combinators, `orThrow()`, `RESULT_TRY`,
+ * comparisons). Accessing the value or the error before (`getValue()`, `getError()`, `operator*`, `operator->`,
+ * `valueUnchecked()`, `errorUnchecked()`) and destructing an error that was never checked are reported to the
+ * handler installed with `setResultAuditHandler`. Without the audit the state does not exist and the hooks expand
+ * to nothing. Changes the layout of `Result` and gives it a non-trivial destructor, so all translation units of a
+ * program must agree on it. Before C++20 `Result` is then not usable in constant expressions, see
+ * `INTERVIEW_RESULT_HAS_CONSTEXPR`.
+ */
+#ifndef INTERVIEW_RESULT_AUDIT
+#define INTERVIEW_RESULT_AUDIT 0
+#endif
+
+/// @brief Set to 1 when `Result` of a literal type is a literal type, the audit makes it one from C++20 on only.
+#if INTERVIEW_RESULT_AUDIT && (__cplusplus < 202002L)
+#define INTERVIEW_RESULT_HAS_CONSTEXPR 0
+#else
+#define INTERVIEW_RESULT_HAS_CONSTEXPR 1
+#endif
+
+/// @brief Evaluates the audit hook in audit builds only, see `INTERVIEW_RESULT_AUDIT`.
+#if INTERVIEW_RESULT_AUDIT
+#define INTERVIEW_RESULT_AUDITED(hook) hook
+#else
+#define INTERVIEW_RESULT_AUDITED(hook) static_cast<void>(0)
+#endif
+
+#if INTERVIEW_RESULT_STATS
+#if (__cplusplus >= 202002L) && defined(__has_include)
+#if __has_include(<source_location>)
+#include <source_location>
+#endif
+#endif
+#if defined(__cpp_lib_source_location) && (__cpp_lib_source_location >= 201907L)
+#define INTERVIEW_RESULT_HAS_SOURCE_LOCATION 1
+#else
+#define INTERVIEW_RESULT_HAS_SOURCE_LOCATION 0
+#endif
+#endif
 
 namespace interview
 {
@@ -29,7 +192,7 @@ namespace library
 {
 
 /// @brief Default class as an error type:
-enum class Status : uint32_t
+enum class Status : INTERVIEW_RESULT_STATUS_TYPE
 {
     OK = 0,
     INVALID_ARG,
@@ -37,334 +200,762 @@ enum class Status : uint32_t
 };
 
 /**
- * @brief Error object creator for `createError`
+ * @brief Get the name of the status.
  *
- * @tparam E type of the error object. `Status` by default
+ * The names are string literals, so describing an error neither allocates nor fails.
+ *
+ * @param status status to describe.
+ * @return name of the enumerator, `"UNKNOWN"` for values outside of the enumeration.
  */
-template <typename E = Status>
-class ErrorCreate
+constexpr const char* toString(Status status) noexcept
 {
-    static_assert(
-        std::is_same<E, Status>::value,
-        "Only Status class is supported as error type now");  // Stick to the requirements and Status class as Error
-  public:
-    /// @brief Constructs an Error object with the specified error.
-    ErrorCreate(E&& error) noexcept(std::is_nothrow_constructible<E>::value) : error_(std::forward<E>(error)) {}
+    switch (status)
+    {
+        case Status::OK:
+            return "OK";
+        case Status::INVALID_ARG:
+            return "INVALID_ARG";
+        case Status::ERROR:
+            return "ERROR";
+    }
+    return "UNKNOWN";
+}
 
-    /// @brief Error getters
-    E& getError() & { return error_; }
-    const E& getError() const& { return error_; }
-    E&& getError() && { return std::move(error_); }
-    const E&& getError() const&& { return std::move(error_); }
+/**
+ * @brief Describes error types that are plain codes, so they can be stored inside spare representations of `T`.
+ *
+ * `kCount` is the number of distinct codes, the codes are the values `0 .. kCount - 1` of the enumeration.
+ * Errors stored in a compact storage must be one of these codes, others are asserted in debug builds and
+ * mapped to the last code otherwise (see `errorCodeIndex`). `0` means the error type is not a compact code.
+ * Specialize it for own error enumerations. Up to 255 codes are packed together with the discriminant into one
+ * tag byte next to a trivially copyable `T`.
+ */
+template <typename E, typename>
+struct ResultErrorCodeTraits
+{
+    static constexpr std::size_t kCount = 0U;
+};
 
-  private:
-    E error_;  // error object
+/// @brief `Status` codes are `0 .. 2`, checked against `toString()` below.
+template <>
+struct ResultErrorCodeTraits<Status>
+{
+    static constexpr std::size_t kCount = 3U;
 };
 
-/// @brief Free function to create an error object, can be called without specifying the type to the template
-template <typename E>
-ErrorCreate<E> createError(E&& error) noexcept(std::is_nothrow_constructible<E>::value)
+namespace detail
+{
+
+/// @brief Whether the name is the one `toString()` gives to values outside of the enumeration.
+constexpr bool isUnknownStatusName(const char* name) noexcept
 {
-    return ErrorCreate<E>(std::forward<E>(error));
+    const char* const unknown = "UNKNOWN";
+    std::size_t index = 0U;
+    while ((name[index] != '\0') && (name[index] == unknown[index]))
+    {
+        ++index;
+    }
+    return name[index] == unknown[index];
 }
 
+}  // namespace detail
+
+// The switch of `toString()` names every enumerator (-Wswitch), so a new code fails here until `kCount` counts it
+static_assert(!detail::isUnknownStatusName(toString(static_cast<Status>(ResultErrorCodeTraits<Status>::kCount - 1U))) &&
+                  detail::isUnknownStatusName(toString(static_cast<Status>(ResultErrorCodeTraits<Status>::kCount))),
+              "ResultErrorCodeTraits<Status>::kCount must be the number of Status codes");
+
 /**
- * @brief A class template representing the result of an operation that can
- * either have a value or an error.
+ * @brief Opt-in hook for value types with spare bit patterns (niches) that never represent a valid value.
  *
- * @tparam T The type of the value.
- * @tparam E The type of the error. Defaults to `Status`.
+ * When `T` provides at least as many spare representations as the error type has codes, `Result<T, E>` stores
+ * the error code inside the payload and drops the separate discriminant, so `sizeof(Result<T, E>) == sizeof(T)`.
+ * A specialization must provide:
+ *  - `static constexpr std::size_t kCount` - number of spare representations,
+ *  - `static T fromIndex(std::size_t index) noexcept` - spare representation number `index < kCount`,
+ *  - `static std::size_t toIndex(const T& value) noexcept` - index of the spare representation held by `value`,
+ *    or `kCount` when `value` is a regular value.
+ *
+ * Only the first `ResultErrorCodeTraits<E>::kCount` spare representations encode errors, the others held by a
+ * value (e.g. a sentinel pointer) stay values.
+ *
+ * @note `T` must be trivially copyable.
  */
-template <typename T, typename E = Status>
-class Result
+template <typename T, typename>
+struct ResultNicheTraits
 {
-    // Error type must be a Status. Also Status::OK must be 0:
-    static_assert(
-        std::is_same<E, Status>::value,
-        "Only Status class is supported as error type now");  // Stick to the requirements and Status class as Error
-    static_assert(!std::is_same<T, Status>::value,
-                  "Status indicates error and can be bind only as an error");  // Stick to the requirements and Status
-                                                                               // class as Error
-    static_assert(static_cast<int32_t>(Status::OK) == 0, "Status::OK must be 0");
+    static constexpr std::size_t kCount = 0U;
+};
 
-  public:
-    /**
-     * @brief Default constructor. Constructs a Result object with a
-     * default-constructed value.
-     *
-     * @note Requires `T` to be default constructible.
-     */
-    template <typename U = T, typename = std::enable_if_t<std::is_default_constructible<U>::value>>
-    Result() noexcept(std::is_nothrow_default_constructible<T>::value) : has_value_(true)
-    {
-        new (&value_) T();
-    }
+/**
+ * @brief Object pointers: addresses of the first memory page (`1 .. 4095`) never point to an object.
+ *
+ * `nullptr` stays a regular value, so `Result<T*>` keeps its meaning while having the size of a pointer. The error
+ * codes take the lowest addresses only (`1 .. 3` for `Status`), higher sentinel addresses stay values.
+ */
+template <typename T>
+struct ResultNicheTraits<T*, std::enable_if_t<!std::is_function<T>::value>>
+{
+    static constexpr std::size_t kCount = 4095U;
 
-    /**
-     * @brief Constructor for value.
-     *
-     * @param other universal reference to the value.
-     */
-    template <
-        typename U = T,
-        typename = std::enable_if_t<!std::is_same<std::decay_t<U>, E>::value && std::is_constructible<T, U>::value>>
-    Result(U&& other) noexcept(std::is_nothrow_constructible<T, U>::value) : has_value_(true)
+    static T* fromIndex(std::size_t index) noexcept { return reinterpret_cast<T*>(index + 1U); }
+
+    static std::size_t toIndex(T* const& value) noexcept
     {
-        new (&value_) T(std::forward<U>(other));
+        const std::size_t index = static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(value)) - 1U;
+        return (index < kCount) ? index : kCount;
     }
+};
 
-    /**
-     * @brief Constructor for error.
-     *
-     * @param error universal reference to the error.
-     */
-    template <typename U = E, typename = std::enable_if_t<std::is_constructible<E, U>::value>>
-    Result(E&& error) noexcept(std::is_nothrow_constructible<E, U>::value) : has_value_(false)
+/**
+ * @brief `Status::OK` never describes an error, it is the spare representation of `Status`.
+ *
+ * Used by `Result<void, Status>` which stores the status only, `Status::OK` stands for the success. An error
+ * `Status::OK` passed to `Result<void, Status>` is asserted in debug builds and a success otherwise.
+ */
+template <>
+struct ResultNicheTraits<Status>
+{
+    static constexpr std::size_t kCount = 1U;
+
+    static constexpr Status fromIndex(std::size_t /* index */) noexcept { return Status::OK; }
+
+    static constexpr std::size_t toIndex(const Status& value) noexcept
     {
-        new (&error_) E(std::forward<U>(error));
+        return (value == Status::OK) ? 0U : kCount;
     }
+};
 
-    /**
-     * @brief Constructs a Result object with an error from an ErrorCreate object.
-     *
-     * @param error object containing the error value.
-     */
-    template <typename U>
-    Result(ErrorCreate<U>&& error) : has_value_(false)
+/**
+ * @brief Handler called on invalid access to the value or the error when exceptions are disabled.
+ *
+ * The handler receives the description of the failure. The program is aborted once the handler returns.
+ */
+using ResultTerminateHandler = void (*)(const char* message);
+
+namespace detail
+{
+
+/// @brief Currently installed terminate handler, `nullptr` selects the default one.
+inline std::atomic<ResultTerminateHandler>& terminateHandler() noexcept
+{
+    static std::atomic<ResultTerminateHandler> handler{nullptr};
+    return handler;
+}
+
+/// @brief Kind of the invalid access.
+enum class BadAccess : uint8_t
+{
+    MISSING_VALUE,
+    MISSING_ERROR
+};
+
+/// @brief Get the description of the invalid access passed to the handler or to the exception.
+constexpr const char* badAccessMessage(BadAccess kind) noexcept
+{
+    return (kind == BadAccess::MISSING_VALUE) ? "No value" : "No error";
+}
+
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+/// @brief Exception reported for the invalid access, created once: it is thrown by copy which shares the message.
+inline const std::runtime_error& badAccessException(BadAccess kind)
+{
+    static const std::runtime_error missingValue(badAccessMessage(BadAccess::MISSING_VALUE));
+    static const std::runtime_error missingError(badAccessMessage(BadAccess::MISSING_ERROR));
+    return (kind == BadAccess::MISSING_VALUE) ? missingValue : missingError;
+}
+#endif
+
+/**
+ * @brief Reports invalid access: throws `std::runtime_error` or calls the terminate handler and aborts.
+ *
+ * Outlined, so a checked accessor inlines to the test of the discriminant and a call.
+ */
+[[noreturn]] INTERVIEW_RESULT_COLD inline void reportBadAccess(BadAccess kind)
+{
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+    throw badAccessException(kind);
+#else
+    const char* message = badAccessMessage(kind);
+    const ResultTerminateHandler handler = terminateHandler().load(std::memory_order_acquire);
+    if (handler != nullptr)
     {
-        new (&error_) E(std::forward<E>(error.getError()));
+        handler(message);
     }
-
-    /**
-     * @brief Copy constructor.
-     *
-     * @param other Result object to copy from.
-     */
-    Result(const Result& other) noexcept(
-        std::is_nothrow_copy_constructible<T>::value&& std::is_nothrow_copy_constructible<E>::value)
-        : has_value_(other.has_value_)
+    else
     {
-        if (has_value_)
-        {
-            new (&value_) T(other.value_);
-        }
-        else
-        {
-            new (&error_) E(other.error_);
-        }
+        std::fprintf(stderr, "interview::library::Result: %s\n", message);
     }
+    std::abort();
+#endif
+}
 
-    /**
-     * @brief Move constructor.
-     *
-     * @param other Result object to move from.
-     */
-    Result(Result&& other) noexcept(
-        std::is_nothrow_move_constructible<T>::value&& std::is_nothrow_move_constructible<E>::value)
-        : has_value_(other.has_value_)
+}  // namespace detail
+
+/**
+ * @brief Installs the handler called on invalid access when exceptions are disabled.
+ *
+ * @param handler new handler, `nullptr` restores the default one printing the message to `stderr`.
+ * @return previously installed handler.
+ */
+inline ResultTerminateHandler setResultTerminateHandler(ResultTerminateHandler handler) noexcept
+{
+    return detail::terminateHandler().exchange(handler, std::memory_order_acq_rel);
+}
+
+#if INTERVIEW_RESULT_AUDIT
+/// @brief Misuse reported by the audit, see `INTERVIEW_RESULT_AUDIT`.
+enum class AuditViolation : std::uint8_t
+{
+    UNCHECKED_ACCESS, /* The value or the error was accessed before the outcome was checked. */
+    UNCHECKED_ERROR   /* An error was destructed without anybody checking the outcome. */
+};
+
+/**
+ * @brief Handler called on misuse found by the audit.
+ *
+ * The handler receives the kind and the description of the misuse. The program continues once it returns.
+ */
+using ResultAuditHandler = void (*)(AuditViolation violation, const char* message);
+
+namespace detail
+{
+
+/// @brief Currently installed audit handler, `nullptr` selects the default one.
+inline std::atomic<ResultAuditHandler>& auditHandler() noexcept
+{
+    static std::atomic<ResultAuditHandler> handler{nullptr};
+    return handler;
+}
+
+/// @brief Get the description of the misuse passed to the handler.
+constexpr const char* auditMessage(AuditViolation violation) noexcept
+{
+    return (violation == AuditViolation::UNCHECKED_ACCESS) ? "Accessed before checking the outcome"
+                                                            : "Error destructed without checking the outcome";
+}
+
+/// @brief Reports the misuse to the handler, or prints it to `stderr` and aborts when none is installed.
+INTERVIEW_RESULT_COLD inline void reportAuditViolation(AuditViolation violation) noexcept
+{
+    const char* message = auditMessage(violation);
+    const ResultAuditHandler handler = auditHandler().load(std::memory_order_acquire);
+    if (handler != nullptr)
     {
-        if (has_value_)
-        {
-            new (&value_) T(std::move(other.value_));
-        }
-        else
-        {
-            new (&error_) E(std::move(other.error_));
-        }
+        handler(violation, message);
+        return;
     }
+    std::fprintf(stderr, "interview::library::Result: %s\n", message);
+    std::abort();
+}
 
-    /**
-     * @brief Copy assignment operator.
-     *
-     * @param other Result object to copy from.
-     * @return reference to the Result object.
-     */
-    Result& operator=(const Result& other) noexcept(
-        std::is_nothrow_copy_constructible<T>::value&& std::is_nothrow_copy_constructible<E>::value)
-    {
-        if (this != &other)
-        {
-            destruct();
-            has_value_ = other.has_value();
-            if (has_value_)
-            {
-                new (&value_) T(other.value_);
-            }
-            else
-            {
-                new (&error_) E(other.error_);
-            }
-        }
+/**
+ * @brief Audit state of one `Result`: whether its outcome was checked and whether its error must be.
+ *
+ * A copy is an outcome of its own, it takes over the state and an unchecked error must be checked in both. A
+ * move takes over the state and releases the moved-from object. Nothing is recorded during constant evaluation.
+ */
+class ResultAudit
+{
+  public:
+    // The state is never written during constant evaluation, so it is not read there either: GCC 12 rejects
+    // reading the mutable member in constant expressions even when the object was created in them.
+    constexpr ResultAudit() noexcept = default;
 
-        return *this;
+    constexpr ResultAudit(const ResultAudit& other) noexcept
+        : checked_(!__builtin_is_constant_evaluated() && other.checked_),
+          released_(!__builtin_is_constant_evaluated() && other.released_)
+    {
     }
 
-    /**
-     * @brief Move assignment operator.
-     *
-     * @param other Result object to move from.
-     * @return reference to the Result object.
-     */
-    Result& operator=(Result&& other) noexcept(
-        std::is_nothrow_move_constructible<T>::value&& std::is_nothrow_move_constructible<E>::value)
+    constexpr ResultAudit& operator=(const ResultAudit& other) noexcept
     {
-        if (this != &other)
+        if (!__builtin_is_constant_evaluated())
         {
-            destruct();
-            has_value_ = other.has_value();
-            if (has_value_)
-            {
-                new (&value_) T(std::move(other.value_));
-            }
-            else
-            {
-                new (&error_) E(std::move(other.error_));
-            }
+            checked_ = other.checked_;
+            released_ = other.released_;
         }
-
         return *this;
     }
 
-    /**
-     * @brief Get the value
-     *
-     * @return value
-     * @throws std::runtime_error If the Result object does not have a value.
-     */
-    const T& getValue() const&
-    {
-        if (!has_value_)
-        {
-            throw std::runtime_error("No value");
-        }
-        return value_;
-    }
+    constexpr ResultAudit(ResultAudit&& other) noexcept : ResultAudit(other) { other.release(); }
 
-    /**
-     * @brief Get the value
-     *
-     * @return value
-     * @throws std::runtime_error If the Result object does not have a value.
-     */
-    T& getValue() &
+    constexpr ResultAudit& operator=(ResultAudit&& other) noexcept
     {
-        if (!has_value_)
-        {
-            throw std::runtime_error("No value");
-        }
-        return value_;
+        *this = other;
+        other.release();
+        return *this;
     }
 
-    /**
-     * @brief Get the value
-     *
-     * @return value
-     * @throws std::runtime_error If the Result object does not have a value.
-     */
-    T&& getValue() &&
+    /// @brief Records that the outcome was checked.
+    constexpr void check() const noexcept
     {
-        if (!has_value_)
+        if (!__builtin_is_constant_evaluated())
         {
-            throw std::runtime_error("No value");
+            checked_ = true;
         }
-        return std::move(value_);
     }
 
-    /**
-     * @brief Get the value
-     *
-     * @return value
-     * @throws std::runtime_error If the Result object does not have a value.
-     */
-    const T&& getValue() const&&
+    /// @brief Reports access to the value or the error when the outcome was not checked before.
+    constexpr void verifyAccess() const noexcept
     {
-        if (!has_value_)
+        if (!__builtin_is_constant_evaluated() && !checked_)
         {
-            throw std::runtime_error("No value");
+            reportAuditViolation(AuditViolation::UNCHECKED_ACCESS);
         }
-        return std::move(value_);
     }
 
-    /**
-     * @brief Get the error
-     *
-     * @return error.
-     * @throws std::runtime_error if the Result object does not have an error.
-     */
-    E& getError() &
+    /// @brief Reports destruction of an error when nobody checked the outcome.
+    constexpr void verifyDestruction(bool holdsValue) const noexcept
     {
-        if (has_value_)
+        if (!__builtin_is_constant_evaluated() && !holdsValue && !checked_ && !released_)
         {
-            throw std::runtime_error("No error");
+            reportAuditViolation(AuditViolation::UNCHECKED_ERROR);
         }
-        return error_;
     }
 
-    /**
-     * @brief Get the error
-     *
-     * @return error.
-     * @throws std::runtime_error if the Result object does not have an error.
-     */
-    const E& getError() const&
+    constexpr void swap(ResultAudit& other) noexcept
     {
-        if (has_value_)
+        if (__builtin_is_constant_evaluated())
         {
-            throw std::runtime_error("No error");
+            return;
         }
-        return error_;
+        const bool checked = checked_;
+        const bool released = released_;
+        checked_ = other.checked_;
+        released_ = other.released_;
+        other.checked_ = checked;
+        other.released_ = released;
     }
 
-    /**
-     * @brief Get the error
-     *
-     * @return error.
-     * @throws std::runtime_error if the Result object does not have an error.
-     */
-    E&& getError() &&
+  private:  // methods
+    constexpr void release() noexcept
     {
-        if (has_value_)
+        if (!__builtin_is_constant_evaluated())
         {
-            throw std::runtime_error("No error");
+            released_ = true;
         }
-        return std::move(error_);
     }
 
-    /**
-     * @brief Get the error
-     *
-     * @return error.
-     * @throws std::runtime_error if the Result object does not have an error.
-     */
-    const E&& getError() const&&
+  private:  // members
+    mutable bool checked_{false}; /* The outcome was checked, the value and the error may be accessed. */
+    bool released_{false};        /* The error need not be checked, the object was moved from. */
+};
+
+}  // namespace detail
+
+/**
+ * @brief Installs the handler called on misuse found by the audit.
+ *
+ * @param handler new handler, `nullptr` restores the default one printing the message to `stderr` and aborting.
+ * @return previously installed handler.
+ */
+inline ResultAuditHandler setResultAuditHandler(ResultAuditHandler handler) noexcept
+{
+    return detail::auditHandler().exchange(handler, std::memory_order_acq_rel);
+}
+#endif  // INTERVIEW_RESULT_AUDIT
+
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+/**
+ * @brief Exception thrown by `orThrow()`, carries the error of the `Result`.
+ *
+ * @tparam E The type of the error.
+ */
+template <typename E>
+class ResultException : public std::runtime_error
+{
+  public:
+    ResultException(const char* message, E error) : std::runtime_error(message), error_(std::move(error)) {}
+
+    /// @brief Get the error of the `Result`.
+    const E& error() const noexcept { return error_; }
+
+  private:  // members
+    E error_; /* The error. */
+};
+#endif
+
+/**
+ * @brief Maps exceptions to errors of type `E` and back, the boundary between throwing code and `Result`.
+ *
+ * A specialization used by `tryInvoke<E>` must provide `static E fromCurrentException() noexcept`, called inside
+ * of a handler: it may rethrow the exception to inspect its type. `raise(E)`, used by `orThrow()`, throws
+ * `ResultException<E>` unless specialized. Both are called from outlined cold functions only.
+ */
+template <typename E, typename>
+struct ResultExceptionTraits
+{
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+    [[noreturn]] static void raise(E error) { throw ResultException<E>("Result holds an error", std::move(error)); }
+#endif
+};
+
+/**
+ * @brief `Status` of an exception: `ResultException<Status>` gives back its status, `std::logic_error` (invalid
+ * argument, out of range, ...) is `Status::INVALID_ARG`, any other exception is `Status::ERROR`.
+ */
+template <>
+struct ResultExceptionTraits<Status>
+{
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+    static Status fromCurrentException() noexcept
+    {
+        try
+        {
+            throw;
+        }
+        catch (const ResultException<Status>& exception)
+        {
+            return exception.error();
+        }
+        catch (const std::logic_error&)
+        {
+            return Status::INVALID_ARG;
+        }
+        catch (...)
+        {
+            return Status::ERROR;
+        }
+    }
+
+    [[noreturn]] static void raise(Status status) { throw ResultException<Status>(toString(status), status); }
+#endif
+};
+
+namespace detail
+{
+
+/// @brief Throws the error of `orThrow()`, outlined so the success path stays inlined and compact.
+template <typename E, typename Error>
+[[noreturn]] INTERVIEW_RESULT_COLD void raiseError(Error&& error)
+{
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+    ResultExceptionTraits<E>::raise(E(std::forward<Error>(error)));
+#else
+    static_cast<void>(error);
+    reportBadAccess(BadAccess::MISSING_VALUE);
+#endif
+}
+
+}  // namespace detail
+
+#if INTERVIEW_RESULT_STATS
+
+namespace detail
+{
+
+/// @brief Number of codes counted per call site, the last counter collects the higher codes and non-enum errors.
+constexpr std::size_t kStatsCodeCount = 8U;
+
+/// @brief Number of call sites counted per thread, the errors of further call sites are only counted as dropped.
+constexpr std::size_t kStatsCallSiteCount = 256U;
+
+/**
+ * @brief Source location of a `createError()` call.
+ */
+struct CallSite
+{
+#if INTERVIEW_RESULT_HAS_SOURCE_LOCATION
+    /// @brief Get the location of the caller.
+    static constexpr CallSite current(std::source_location location = std::source_location::current()) noexcept
+    {
+        return CallSite{location.file_name(), location.function_name(), static_cast<std::uint32_t>(location.line())};
+    }
+#else
+    /// @brief Get the location of the caller.
+    static constexpr CallSite current(const char* file = __builtin_FILE(),
+                                      const char* function = __builtin_FUNCTION(),
+                                      std::uint32_t line = __builtin_LINE()) noexcept
+    {
+        return CallSite{file, function, line};
+    }
+#endif
+
+    const char* file_;     /* Source file. */
+    const char* function_; /* Enclosing function. */
+    std::uint32_t line_;   /* Source line. */
+};
+
+/**
+ * @brief Counters of one call site, written by the owning thread only and read by the snapshots.
+ */
+struct StatsSlot
+{
+    std::atomic<const char*> file_{nullptr};               /* Source file, published last, `nullptr` if unused. */
+    const char* function_{nullptr};                        /* Enclosing function. */
+    std::uint32_t line_{0U};                               /* Source line. */
+    std::atomic<std::uint64_t> counts_[kStatsCodeCount]{}; /* Number of errors per code. */
+};
+
+/**
+ * @brief Counters of one thread, linked into the list of all counters.
+ *
+ * The counters are never released: once the thread exits they are kept for the snapshots and
+ * reused by a new thread, so the number of counters is bounded by the peak number of threads.
+ */
+struct ThreadStats
+{
+    StatsSlot slots_[kStatsCallSiteCount];  /* Counters per call site, open addressing. */
+    std::atomic<std::uint64_t> dropped_{0U}; /* Errors of call sites which did not fit. */
+    std::atomic<bool> inUse_{true};          /* Set while a thread owns the counters. */
+    ThreadStats* next_{nullptr};             /* Next counters of the list, immutable once linked. */
+};
+
+/// @brief Head of the list of the counters of all threads.
+inline std::atomic<ThreadStats*>& threadStatsList() noexcept
+{
+    static std::atomic<ThreadStats*> head{nullptr};
+    return head;
+}
+
+/// @brief Takes over the counters of an exited thread, or links new ones.
+inline ThreadStats* acquireThreadStats()
+{
+    std::atomic<ThreadStats*>& head = threadStatsList();
+    for (ThreadStats* stats = head.load(std::memory_order_acquire); stats != nullptr; stats = stats->next_)
+    {
+        bool inUse = false;
+        if (stats->inUse_.compare_exchange_strong(inUse, true, std::memory_order_acquire))
+        {
+            return stats;
+        }
+    }
+    ThreadStats* stats = new ThreadStats();
+    stats->next_ = head.load(std::memory_order_relaxed);
+    while (!head.compare_exchange_weak(stats->next_, stats, std::memory_order_release, std::memory_order_relaxed))
+    {
+    }
+    return stats;
+}
+
+/// @brief Owns the counters of the thread, releases them for reuse when the thread exits.
+class ThreadStatsHandle
+{
+  public:
+    ThreadStatsHandle() : stats_(acquireThreadStats()) {}
+    ThreadStatsHandle(const ThreadStatsHandle&) = delete;
+    ThreadStatsHandle& operator=(const ThreadStatsHandle&) = delete;
+    ~ThreadStatsHandle() { stats_->inUse_.store(false, std::memory_order_release); }
+
+    ThreadStats& get() const noexcept { return *stats_; }
+
+  private:
+    ThreadStats* stats_; /* Counters of the thread. */
+};
+
+/// @brief Counts an error of the call site in the counters of the calling thread, lock-free.
+inline void recordError(const CallSite& site, std::uint32_t code)
+{
+    thread_local ThreadStatsHandle handle;
+    ThreadStats& stats = handle.get();
+    const std::size_t bucket = (code < (kStatsCodeCount - 1U)) ? code : (kStatsCodeCount - 1U);
+    const std::size_t hash = (reinterpret_cast<std::uintptr_t>(site.file_) >> 3U) ^ (site.line_ * 0x9E3779B9U);
+    for (std::size_t probe = 0U; probe < kStatsCallSiteCount; ++probe)
+    {
+        StatsSlot& slot = stats.slots_[(hash + probe) % kStatsCallSiteCount];
+        const char* file = slot.file_.load(std::memory_order_relaxed);
+        if (file == nullptr)
+        {
+            slot.function_ = site.function_;
+            slot.line_ = site.line_;
+            slot.file_.store(site.file_, std::memory_order_release);
+        }
+        else if ((file != site.file_) || (slot.line_ != site.line_))
+        {
+            continue;
+        }
+        // Single writer: a plain increment, readers see either the old or the new count
+        std::atomic<std::uint64_t>& count = slot.counts_[bucket];
+        count.store(count.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+        return;
+    }
+    stats.dropped_.fetch_add(1U, std::memory_order_relaxed);
+}
+
+/// @brief Get the counted code of the error, enumerations are counted by their value.
+template <typename E, std::enable_if_t<std::is_enum<E>::value, int> = 0>
+constexpr std::uint32_t statsCode(const E& error) noexcept
+{
+    return static_cast<std::uint32_t>(error);
+}
+
+template <typename E, std::enable_if_t<!std::is_enum<E>::value, int> = 0>
+constexpr std::uint32_t statsCode(const E& /* error */) noexcept
+{
+    return static_cast<std::uint32_t>(kStatsCodeCount - 1U);
+}
+
+}  // namespace detail
+
+#endif  // INTERVIEW_RESULT_STATS
+
+/// @brief Tag selecting construction of the value inside the Result object, see `inPlace`.
+struct InPlace
+{
+    explicit InPlace() = default;
+};
+
+/// @brief Tag selecting construction of the error inside the Result object, see `inPlaceError`.
+struct InPlaceError
+{
+    explicit InPlaceError() = default;
+};
+
+/// @brief `Result<T, E>(inPlace, args...)` constructs `T` from `args` directly in the storage, without a temporary.
+constexpr InPlace inPlace{};
+
+/// @brief `Result<T, E>(inPlaceError, args...)` constructs `E` from `args` directly in the storage.
+constexpr InPlaceError inPlaceError{};
+
+/**
+ * @brief Error object creator for `createError`
+ *
+ * @tparam E type of the error object. `Status` by default
+ */
+template <typename E>
+class ErrorCreate
+{
+    static_assert(!std::is_reference<E>::value, "Error type must not be a reference");
+
+  public:
+    /// @brief Constructs an Error object with the specified error.
+    constexpr ErrorCreate(E&& error) noexcept(std::is_nothrow_move_constructible<E>::value)
+        : error_(std::move(error))
+    {
+    }
+
+    /// @brief Constructs an Error object with a copy of the specified error.
+    constexpr ErrorCreate(const E& error) noexcept(std::is_nothrow_copy_constructible<E>::value) : error_(error) {}
+
+    /// @brief Error getters
+    constexpr E& getError() & { return error_; }
+    constexpr const E& getError() const& { return error_; }
+    constexpr E&& getError() && { return std::move(error_); }
+    constexpr const E&& getError() const&& { return std::move(error_); }
+
+  private:
+    E error_;  // error object
+};
+
+#if INTERVIEW_RESULT_STATS
+/**
+ * @brief Free function to create an error object, can be called without specifying the type to the template
+ *
+ * Counts the error for the call site, the location is captured by the default argument. The errors created
+ * during constant evaluation are not counted.
+ */
+template <typename E>
+constexpr ErrorCreate<std::decay_t<E>> createError(E&& error, detail::CallSite site = detail::CallSite::current())
+{
+    if (!__builtin_is_constant_evaluated())
+    {
+        detail::recordError(site, detail::statsCode(error));
+    }
+    return ErrorCreate<std::decay_t<E>>(std::forward<E>(error));
+}
+#else
+/// @brief Free function to create an error object, can be called without specifying the type to the template
+template <typename E>
+constexpr ErrorCreate<std::decay_t<E>> createError(E&& error) noexcept(
+    std::is_nothrow_constructible<std::decay_t<E>, E>::value)
+{
+    return ErrorCreate<std::decay_t<E>>(std::forward<E>(error));
+}
+#endif
+
+namespace detail
+{
+
+/// @brief Tag selecting construction of the value alternative.
+struct ValueTag
+{
+};
+
+/// @brief Tag selecting construction of the error alternative.
+struct ErrorTag
+{
+};
+
+/// @brief Tag constructing the object returned from a coroutine, filled in once the coroutine body completes.
+struct CoroutineTag
+{
+};
+
+/// @brief Tag constructing the alternative held by another storage, used by the copy and move constructors.
+struct AlternativeOfTag
+{
+};
+
+/// @brief Constructs the object in place, usable in constant expressions under C++20.
+template <typename T, typename... Args>
+INTERVIEW_RESULT_CONSTEXPR20 void constructAt(T* location, Args&&... args) noexcept(
+    std::is_nothrow_constructible<T, Args...>::value)
+{
+#if __cplusplus >= 202002L
+    std::construct_at(location, std::forward<Args>(args)...);
+#else
+    new (location) T(std::forward<Args>(args)...);
+#endif
+}
+
+/// @brief Destructs the object in place, usable in constant expressions under C++20.
+template <typename T>
+INTERVIEW_RESULT_CONSTEXPR20 void destroyAt(T* location) noexcept
+{
+    location->~T();
+}
+
+/**
+ * @brief Storage of the `Result` object: union of the value and the error together with the discriminant.
+ *
+ * The special member functions of `Result` are layered on top of this class (the approach used by
+ * `std::optional`), so each of them stays trivial whenever the corresponding one of both `T` and `E` is trivial.
+ * This keeps `Result` of trivial payloads trivially copyable and destructible.
+ */
+template <typename T,
+          typename E,
+          bool = std::is_trivially_destructible<T>::value && std::is_trivially_destructible<E>::value>
+struct ResultStorage
+{
+    /// @brief Constructs the alternative held by `other`, if that throws there is no alternative to destruct.
+    template <typename Other>
+    INTERVIEW_RESULT_CONSTEXPR20 explicit ResultStorage(AlternativeOfTag, Other&& other) : has_value_(other.has_value_)
     {
         if (has_value_)
         {
-            throw std::runtime_error("No error");
+            constructAt(std::addressof(value_), std::forward<Other>(other).value_);
+        }
+        else
+        {
+            constructAt(std::addressof(error_), std::forward<Other>(other).error_);
         }
-        return std::move(error_);
     }
 
-    /// @brief Destructor. Destructs the value or the error.
-    ~Result() { destruct(); }
+    template <typename... Args>
+    constexpr explicit ResultStorage(ValueTag, Args&&... args) noexcept(
+        std::is_nothrow_constructible<T, Args...>::value)
+        : value_(std::forward<Args>(args)...), has_value_(true)
+    {
+    }
 
-    /**
-     * @brief Conversion operator to bool.
-     *
-     * @return `true` if the Result object has a value, `false` otherwise.
-     */
-    explicit operator bool() const noexcept { return has_value_; }
+    template <typename... Args>
+    constexpr explicit ResultStorage(ErrorTag, Args&&... args) noexcept(
+        std::is_nothrow_constructible<E, Args...>::value)
+        : error_(std::forward<Args>(args)...), has_value_(false)
+    {
+    }
 
-    /**
-     * @brief Check if the Result object has a value.
-     *
-     * @return `true` if the Result object has a value, `false` otherwise.
-     */
-    bool hasValue() const noexcept { return has_value_; }
+    ResultStorage(const ResultStorage&) = default;
+    ResultStorage(ResultStorage&&) = default;
+    ResultStorage& operator=(const ResultStorage&) = default;
+    ResultStorage& operator=(ResultStorage&&) = default;
+
+    /// @brief Destructor. Destructs the value or the error.
+    INTERVIEW_RESULT_CONSTEXPR20 ~ResultStorage() { destroy(); }
 
-  private:  // methods
     /// @brief Destructs the value or the error.
-    void destruct(void) const noexcept(std::is_nothrow_destructible<T>::value)
+    INTERVIEW_RESULT_CONSTEXPR20 void destroy() noexcept
     {
         if (has_value_)
         {
@@ -376,7 +967,6 @@ class Result
         }
     }
 
-  private:  // members
     union
     {
         T value_; /* The value. */
@@ -385,7 +975,2670 @@ class Result
     bool has_value_; /* Flag indicating whether the Result object has a value or an error. */
 };
 
-}  // namespace library
-}  // namespace interview
+/// @brief Storage for trivially destructible `T` and `E`, the destructor stays trivial.
+template <typename T, typename E>
+struct ResultStorage<T, E, true>
+{
+    /// @brief Constructs the alternative held by `other`, if that throws there is no alternative to destruct.
+    template <typename Other>
+    INTERVIEW_RESULT_CONSTEXPR20 explicit ResultStorage(AlternativeOfTag, Other&& other) : has_value_(other.has_value_)
+    {
+        if (has_value_)
+        {
+            constructAt(std::addressof(value_), std::forward<Other>(other).value_);
+        }
+        else
+        {
+            constructAt(std::addressof(error_), std::forward<Other>(other).error_);
+        }
+    }
+
+    template <typename... Args>
+    constexpr explicit ResultStorage(ValueTag, Args&&... args) noexcept(
+        std::is_nothrow_constructible<T, Args...>::value)
+        : value_(std::forward<Args>(args)...), has_value_(true)
+    {
+    }
+
+    template <typename... Args>
+    constexpr explicit ResultStorage(ErrorTag, Args&&... args) noexcept(
+        std::is_nothrow_constructible<E, Args...>::value)
+        : error_(std::forward<Args>(args)...), has_value_(false)
+    {
+    }
+
+    /// @brief Nothing to destruct for trivially destructible alternatives.
+    constexpr void destroy() noexcept {}
+
+    union
+    {
+        T value_; /* The value. */
+        E error_; /* The error. */
+    };
+    bool has_value_; /* Flag indicating whether the Result object has a value or an error. */
+};
+
+/// @brief How `reinitialize` keeps the strong exception guarantee, the cheapest applicable one is selected.
+enum class Reinitialization : std::uint8_t
+{
+    DIRECT,    /* Constructing `New` does not throw: destruct `Old` and construct `New`. */
+    TEMPORARY, /* Moving `New` does not throw: construct `New` aside, destruct `Old` and move `New` in. */
+    BACKUP     /* Move `Old` aside, destruct it and construct `New`, move `Old` back if that throws. */
+};
+
+template <typename New, typename Arg>
+using ReinitializationOf = std::integral_constant<Reinitialization,
+                                                  std::is_nothrow_constructible<New, Arg>::value
+                                                      ? Reinitialization::DIRECT
+                                                      : (std::is_nothrow_move_constructible<New>::value
+                                                             ? Reinitialization::TEMPORARY
+                                                             : Reinitialization::BACKUP)>;
+
+template <typename New, typename Old, typename Arg>
+INTERVIEW_RESULT_CONSTEXPR20 void reinitialize(std::integral_constant<Reinitialization, Reinitialization::DIRECT>,
+                                               New* target,
+                                               Old* current,
+                                               Arg&& arg) noexcept
+{
+    destroyAt(current);
+    constructAt(target, std::forward<Arg>(arg));
+}
+
+template <typename New, typename Old, typename Arg>
+INTERVIEW_RESULT_CONSTEXPR20 void reinitialize(std::integral_constant<Reinitialization, Reinitialization::TEMPORARY>,
+                                               New* target,
+                                               Old* current,
+                                               Arg&& arg)
+{
+    New temporary(std::forward<Arg>(arg));
+    destroyAt(current);
+    constructAt(target, std::move(temporary));
+}
+
+template <typename New, typename Old, typename Arg>
+INTERVIEW_RESULT_CONSTEXPR20 void reinitialize(std::integral_constant<Reinitialization, Reinitialization::BACKUP>,
+                                               New* target,
+                                               Old* current,
+                                               Arg&& arg)
+{
+    static_assert(std::is_nothrow_move_constructible<Old>::value,
+                  "Changing the alternative requires one of both alternatives to be nothrow move constructible");
+    Old backup(std::move(*current));
+    destroyAt(current);
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+    try
+    {
+        constructAt(target, std::forward<Arg>(arg));
+    }
+    catch (...)
+    {
+        constructAt(current, std::move(backup));
+        throw;
+    }
+#else
+    constructAt(target, std::forward<Arg>(arg));
+#endif
+}
+
+/**
+ * @brief Replaces the object `current` by `New` constructed from `arg` at the same location, `current` is kept
+ * when the construction throws.
+ */
+template <typename New, typename Old, typename Arg>
+INTERVIEW_RESULT_CONSTEXPR20 void reinitialize(New* target, Old* current, Arg&& arg)
+{
+    reinitialize(ReinitializationOf<New, Arg>{}, target, current, std::forward<Arg>(arg));
+}
+
+/// @brief Assigns to the held alternative of the same type, alternatives which are not assignable are replaced.
+template <typename T, typename Arg>
+INTERVIEW_RESULT_CONSTEXPR20 void assignAlternative(std::true_type, T* target, Arg&& arg)
+{
+    *target = std::forward<Arg>(arg);
+}
+
+template <typename T, typename Arg>
+INTERVIEW_RESULT_CONSTEXPR20 void assignAlternative(std::false_type, T* target, Arg&& arg)
+{
+    reinitialize(target, target, std::forward<Arg>(arg));
+}
+
+namespace swappable
+{
+using std::swap;
+
+/// @brief Checks whether swapping `T` found by argument dependent lookup or `std::swap` does not throw.
+template <typename T>
+using IsNothrowSwappable = std::integral_constant<bool, noexcept(swap(std::declval<T&>(), std::declval<T&>()))>;
+}  // namespace swappable
+
+/// @brief Checks whether swapping `Result<T, E>` does not throw.
+template <typename T, typename E>
+using IsNothrowResultSwap = std::integral_constant<bool,
+                                                   std::is_nothrow_move_constructible<T>::value &&
+                                                       std::is_nothrow_move_constructible<E>::value &&
+                                                       swappable::IsNothrowSwappable<T>::value &&
+                                                       swappable::IsNothrowSwappable<E>::value>;
+
+/// @brief Accessors common for all storages and operations used by the non-trivial special members.
+template <typename T, typename E>
+struct ResultOperations : ResultStorage<T, E>
+{
+    using ResultStorage<T, E>::ResultStorage;
+
+    using ErrorRef = E&;
+    using ConstErrorRef = const E&;
+    using ErrorRvalueRef = E&&;
+    using ConstErrorRvalueRef = const E&&;
+
+    constexpr bool holdsValue() const noexcept { return this->has_value_; }
+    constexpr T& storedValue() noexcept { return this->value_; }
+    constexpr const T& storedValue() const noexcept { return this->value_; }
+    constexpr E& storedError() noexcept { return this->error_; }
+    constexpr const E& storedError() const noexcept { return this->error_; }
+
+    /// @brief Destructs the held alternative and constructs the value from `args`, which must not throw.
+    template <typename... Args>
+    INTERVIEW_RESULT_CONSTEXPR20 T& emplaceValue(std::true_type, Args&&... args) noexcept
+    {
+        this->destroy();
+        constructAt(std::addressof(this->value_), std::forward<Args>(args)...);
+        this->has_value_ = true;
+        return this->value_;
+    }
+
+    /// @brief Constructs the value aside and moves it in, so an exception leaves the held alternative intact.
+    template <typename... Args>
+    INTERVIEW_RESULT_CONSTEXPR20 T& emplaceValue(std::false_type, Args&&... args)
+    {
+        T value(std::forward<Args>(args)...);
+        return emplaceValue(std::true_type{}, std::move(value));
+    }
+
+    /**
+     * @brief Assigns the alternative held by `other`.
+     *
+     * When both hold the same alternative it is assigned, so e.g. the buffer of a `std::string` value is reused.
+     * Otherwise the held alternative is replaced, keeping it when constructing the new one throws.
+     */
+    template <typename Other>
+    INTERVIEW_RESULT_CONSTEXPR20 void assignFrom(Other&& other)
+    {
+        using ValueArg = decltype((std::forward<Other>(other).value_));
+        using ErrorArg = decltype((std::forward<Other>(other).error_));
+        if (this->has_value_ && other.has_value_)
+        {
+            assignAlternative(std::is_assignable<T&, ValueArg>{}, std::addressof(this->value_),
+                              std::forward<Other>(other).value_);
+        }
+        else if (!this->has_value_ && !other.has_value_)
+        {
+            assignAlternative(std::is_assignable<E&, ErrorArg>{}, std::addressof(this->error_),
+                              std::forward<Other>(other).error_);
+        }
+        else if (other.has_value_)
+        {
+            reinitialize(std::addressof(this->value_), std::addressof(this->error_), std::forward<Other>(other).value_);
+            this->has_value_ = true;
+        }
+        else
+        {
+            reinitialize(std::addressof(this->error_), std::addressof(this->value_), std::forward<Other>(other).error_);
+            this->has_value_ = false;
+        }
+    }
+
+    /**
+     * @brief Swaps the alternatives with `other`.
+     *
+     * Equal alternatives are swapped in place. Otherwise one of both payloads is moved aside, preferring the one
+     * whose move cannot throw, and moved back if moving the other one throws.
+     */
+    INTERVIEW_RESULT_CONSTEXPR20 void swapWith(ResultOperations& other) noexcept(IsNothrowResultSwap<T, E>::value)
+    {
+        using std::swap;
+        if (this->has_value_ && other.has_value_)
+        {
+            swap(this->value_, other.value_);
+        }
+        else if (!this->has_value_ && !other.has_value_)
+        {
+            swap(this->error_, other.error_);
+        }
+        else if (this->has_value_)
+        {
+            swapAlternatives(std::is_nothrow_move_constructible<E>{}, *this, other);
+        }
+        else
+        {
+            swapAlternatives(std::is_nothrow_move_constructible<E>{}, other, *this);
+        }
+    }
+
+    /// @brief Swaps the value of `valued` with the error of `errored`, the error is moved aside.
+    static INTERVIEW_RESULT_CONSTEXPR20 void swapAlternatives(std::true_type,
+                                                              ResultOperations& valued,
+                                                              ResultOperations& errored)
+    {
+        E error(std::move(errored.error_));
+        destroyAt(std::addressof(errored.error_));
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+        try
+        {
+            constructAt(std::addressof(errored.value_), std::move(valued.value_));
+        }
+        catch (...)
+        {
+            constructAt(std::addressof(errored.error_), std::move(error));
+            throw;
+        }
+#else
+        constructAt(std::addressof(errored.value_), std::move(valued.value_));
+#endif
+        errored.has_value_ = true;
+        destroyAt(std::addressof(valued.value_));
+        constructAt(std::addressof(valued.error_), std::move(error));
+        valued.has_value_ = false;
+    }
+
+    /// @brief Swaps the value of `valued` with the error of `errored`, the value is moved aside.
+    static INTERVIEW_RESULT_CONSTEXPR20 void swapAlternatives(std::false_type,
+                                                              ResultOperations& valued,
+                                                              ResultOperations& errored)
+    {
+        static_assert(std::is_nothrow_move_constructible<T>::value,
+                      "Swapping requires the value or the error to be nothrow move constructible");
+        T value(std::move(valued.value_));
+        destroyAt(std::addressof(valued.value_));
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+        try
+        {
+            constructAt(std::addressof(valued.error_), std::move(errored.error_));
+        }
+        catch (...)
+        {
+            constructAt(std::addressof(valued.value_), std::move(value));
+            throw;
+        }
+#else
+        constructAt(std::addressof(valued.error_), std::move(errored.error_));
+#endif
+        valued.has_value_ = false;
+        destroyAt(std::addressof(errored.error_));
+        constructAt(std::addressof(errored.value_), std::move(value));
+        errored.has_value_ = true;
+    }
+};
+
+/// @brief Copy constructor layer, trivial when both `T` and `E` are trivially copy constructible.
+template <typename T,
+          typename E,
+          bool = std::is_trivially_copy_constructible<T>::value && std::is_trivially_copy_constructible<E>::value>
+struct ResultCopyBase : ResultOperations<T, E>
+{
+    using ResultOperations<T, E>::ResultOperations;
+};
+
+template <typename T, typename E>
+struct ResultCopyBase<T, E, false> : ResultOperations<T, E>
+{
+    using ResultOperations<T, E>::ResultOperations;
+
+    INTERVIEW_RESULT_CONSTEXPR20 ResultCopyBase(const ResultCopyBase& other) noexcept(
+        std::is_nothrow_copy_constructible<T>::value&& std::is_nothrow_copy_constructible<E>::value)
+        : ResultOperations<T, E>(AlternativeOfTag{}, other)
+    {
+    }
+
+    ResultCopyBase(ResultCopyBase&&) = default;
+    ResultCopyBase& operator=(const ResultCopyBase&) = default;
+    ResultCopyBase& operator=(ResultCopyBase&&) = default;
+};
+
+/// @brief Move constructor layer, trivial when both `T` and `E` are trivially move constructible.
+template <typename T,
+          typename E,
+          bool = std::is_trivially_move_constructible<T>::value && std::is_trivially_move_constructible<E>::value>
+struct ResultMoveBase : ResultCopyBase<T, E>
+{
+    using ResultCopyBase<T, E>::ResultCopyBase;
+};
+
+template <typename T, typename E>
+struct ResultMoveBase<T, E, false> : ResultCopyBase<T, E>
+{
+    using ResultCopyBase<T, E>::ResultCopyBase;
+
+    ResultMoveBase(const ResultMoveBase&) = default;
+
+    INTERVIEW_RESULT_CONSTEXPR20 ResultMoveBase(ResultMoveBase&& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value&& std::is_nothrow_move_constructible<E>::value)
+        : ResultCopyBase<T, E>(AlternativeOfTag{}, std::move(other))
+    {
+    }
+
+    ResultMoveBase& operator=(const ResultMoveBase&) = default;
+    ResultMoveBase& operator=(ResultMoveBase&&) = default;
+};
+
+/// @brief Copy assignment layer, trivial when both `T` and `E` are trivially copyable in all respects.
+template <typename T,
+          typename E,
+          bool = std::is_trivially_copy_constructible<T>::value && std::is_trivially_copy_assignable<T>::value &&
+                 std::is_trivially_destructible<T>::value && std::is_trivially_copy_constructible<E>::value &&
+                 std::is_trivially_copy_assignable<E>::value && std::is_trivially_destructible<E>::value>
+struct ResultCopyAssignBase : ResultMoveBase<T, E>
+{
+    using ResultMoveBase<T, E>::ResultMoveBase;
+};
+
+template <typename T, typename E>
+struct ResultCopyAssignBase<T, E, false> : ResultMoveBase<T, E>
+{
+    using ResultMoveBase<T, E>::ResultMoveBase;
+
+    ResultCopyAssignBase(const ResultCopyAssignBase&) = default;
+    ResultCopyAssignBase(ResultCopyAssignBase&&) = default;
+
+    INTERVIEW_RESULT_CONSTEXPR20 ResultCopyAssignBase& operator=(const ResultCopyAssignBase& other) noexcept(
+        std::is_nothrow_copy_constructible<T>::value&& std::is_nothrow_copy_assignable<T>::value&&
+            std::is_nothrow_copy_constructible<E>::value&& std::is_nothrow_copy_assignable<E>::value)
+    {
+        if (this != &other)
+        {
+            this->assignFrom(other);
+        }
+        return *this;
+    }
+
+    ResultCopyAssignBase& operator=(ResultCopyAssignBase&&) = default;
+};
+
+/// @brief Move assignment layer, trivial when both `T` and `E` are trivially movable in all respects.
+template <typename T,
+          typename E,
+          bool = std::is_trivially_move_constructible<T>::value && std::is_trivially_move_assignable<T>::value &&
+                 std::is_trivially_destructible<T>::value && std::is_trivially_move_constructible<E>::value &&
+                 std::is_trivially_move_assignable<E>::value && std::is_trivially_destructible<E>::value>
+struct ResultMoveAssignBase : ResultCopyAssignBase<T, E>
+{
+    using ResultCopyAssignBase<T, E>::ResultCopyAssignBase;
+};
+
+template <typename T, typename E>
+struct ResultMoveAssignBase<T, E, false> : ResultCopyAssignBase<T, E>
+{
+    using ResultCopyAssignBase<T, E>::ResultCopyAssignBase;
+
+    ResultMoveAssignBase(const ResultMoveAssignBase&) = default;
+    ResultMoveAssignBase(ResultMoveAssignBase&&) = default;
+    ResultMoveAssignBase& operator=(const ResultMoveAssignBase&) = default;
+
+    INTERVIEW_RESULT_CONSTEXPR20 ResultMoveAssignBase& operator=(ResultMoveAssignBase&& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value&& std::is_nothrow_move_assignable<T>::value&&
+            std::is_nothrow_move_constructible<E>::value&& std::is_nothrow_move_assignable<E>::value)
+    {
+        if (this != &other)
+        {
+            this->assignFrom(std::move(other));
+        }
+        return *this;
+    }
+};
+
+/**
+ * @brief Index of the code of `error` in `0 .. kCount - 1` of `ResultErrorCodeTraits<E>`.
+ *
+ * A code outside of the range (e.g. cast from a wire frame or a C API) is asserted in debug builds and mapped to
+ * the last code otherwise, so it never reads as a value of the compact storages.
+ */
+template <typename E>
+constexpr std::size_t errorCodeIndex(E error) noexcept
+{
+    const std::size_t code = static_cast<std::size_t>(error);
+    assert((code < ResultErrorCodeTraits<E>::kCount) && "Error code out of the range of ResultErrorCodeTraits");
+    return (code < ResultErrorCodeTraits<E>::kCount) ? code : (ResultErrorCodeTraits<E>::kCount - 1U);
+}
+
+/**
+ * @brief Compact storage: the error code is kept inside a spare representation of `T` (see `ResultNicheTraits`).
+ *
+ * There is no separate discriminant, so the error is decoded on access and returned by value. Codes out of the
+ * range of `ResultErrorCodeTraits<E>` are mapped by `errorCodeIndex`, they could name a regular value of `T`.
+ */
+template <typename T, typename E>
+struct ResultNicheStorage
+{
+    using Niche = ResultNicheTraits<T>;
+
+    using ErrorRef = E;
+    using ConstErrorRef = E;
+    using ErrorRvalueRef = E;
+    using ConstErrorRvalueRef = E;
+
+    template <typename... Args>
+    constexpr explicit ResultNicheStorage(ValueTag, Args&&... args) noexcept(
+        std::is_nothrow_constructible<T, Args...>::value)
+        : slot_(std::forward<Args>(args)...)
+    {
+    }
+
+    template <typename... Args>
+    constexpr explicit ResultNicheStorage(ErrorTag, Args&&... args) noexcept
+        : slot_(Niche::fromIndex(errorCodeIndex(E(std::forward<Args>(args)...))))
+    {
+    }
+
+    /// @brief Swaps the slots, both alternatives are trivially copyable.
+    constexpr void swapWith(ResultNicheStorage& other) noexcept
+    {
+        const T slot = slot_;
+        slot_ = other.slot_;
+        other.slot_ = slot;
+    }
+
+    /// @brief Replaces the held alternative with the value, `T` is trivially copyable so nothing is destructed.
+    template <typename Nothrow, typename... Args>
+    constexpr T& emplaceValue(Nothrow, Args&&... args) noexcept(std::is_nothrow_constructible<T, Args...>::value)
+    {
+        slot_ = T(std::forward<Args>(args)...);
+        return slot_;
+    }
+
+    /// @brief Spare representations past the error codes are never stored by an error, so they are values.
+    constexpr bool holdsValue() const noexcept
+    {
+        return Niche::toIndex(slot_) >= ResultErrorCodeTraits<E>::kCount;
+    }
+
+    constexpr T& storedValue() noexcept { return slot_; }
+    constexpr const T& storedValue() const noexcept { return slot_; }
+    constexpr E storedError() const noexcept { return static_cast<E>(Niche::toIndex(slot_)); }
+
+    T slot_; /* The value or the spare representation encoding the error. */
+};
+
+/// @brief Value alternative of the storage of `Result<void, E>`.
+struct Unit
+{
+};
+
+/// @brief Error types whose codes fit into one tag byte together with the discriminant of the packed storage.
+template <typename E>
+using IsPackedErrorCode = std::integral_constant<bool,
+                                                 (ResultErrorCodeTraits<E>::kCount > 0U) &&
+                                                     (ResultErrorCodeTraits<E>::kCount < 256U) &&
+                                                     std::is_trivially_copyable<E>::value>;
+
+/**
+ * @brief Packed storage: the discriminant and the error code share one tag byte next to the value.
+ *
+ * The tag is `0` for the value and `code + 1` for an error, so neither `E` nor a separate flag is stored and
+ * e.g. `sizeof(Result<std::uint16_t>) == 4`. The error is decoded on access and returned by value. Codes out of
+ * the range of `ResultErrorCodeTraits<E>` are mapped by `errorCodeIndex`, they would wrap into the value tag.
+ */
+template <typename T, typename E>
+struct ResultPackedStorage
+{
+    using ErrorRef = E;
+    using ConstErrorRef = E;
+    using ErrorRvalueRef = E;
+    using ConstErrorRvalueRef = E;
+
+    template <typename... Args>
+    constexpr explicit ResultPackedStorage(ValueTag, Args&&... args) noexcept(
+        std::is_nothrow_constructible<T, Args...>::value)
+        : value_(std::forward<Args>(args)...), tag_(0U)
+    {
+    }
+
+    template <typename... Args>
+    constexpr explicit ResultPackedStorage(ErrorTag, Args&&... args) noexcept(
+        std::is_nothrow_constructible<E, Args...>::value)
+        : none_(), tag_(static_cast<std::uint8_t>(errorCodeIndex(E(std::forward<Args>(args)...)) + 1U))
+    {
+    }
+
+    /// @brief Swaps the storages, both alternatives are trivially copyable.
+    constexpr void swapWith(ResultPackedStorage& other) noexcept
+    {
+        const ResultPackedStorage slot = *this;
+        *this = other;
+        other = slot;
+    }
+
+    /// @brief Replaces the held alternative with the value, `T` is trivially copyable so nothing is destructed.
+    template <typename Nothrow, typename... Args>
+    constexpr T& emplaceValue(Nothrow, Args&&... args) noexcept(std::is_nothrow_constructible<T, Args...>::value)
+    {
+        *this = ResultPackedStorage(ValueTag{}, std::forward<Args>(args)...);
+        return value_;
+    }
+
+    constexpr bool holdsValue() const noexcept { return tag_ == 0U; }
+    constexpr T& storedValue() noexcept { return value_; }
+    constexpr const T& storedValue() const noexcept { return value_; }
+    constexpr E storedError() const noexcept { return static_cast<E>(tag_ - 1U); }
+
+    union
+    {
+        Unit none_; /* Placeholder alternative of an error. */
+        T value_;   /* The value. */
+    };
+    std::uint8_t tag_; /* `0` for the value, error code + 1 for an error. */
+};
+
+/**
+ * @brief Selects the storage of `Result<T, E>`, the smallest one applicable.
+ *
+ * The compact storage when `T` has enough spare representations for all codes of `E`, the packed storage when
+ * the codes of `E` fit into a tag byte, the union of both alternatives with a flag otherwise.
+ */
+template <typename T, typename E>
+using ResultBase = std::conditional_t<
+    (ResultErrorCodeTraits<E>::kCount > 0U) && (ResultNicheTraits<T>::kCount >= ResultErrorCodeTraits<E>::kCount) &&
+        std::is_trivially_copyable<T>::value,
+    ResultNicheStorage<T, E>,
+    std::conditional_t<IsPackedErrorCode<E>::value && std::is_trivially_copyable<T>::value,
+                       ResultPackedStorage<T, E>,
+                       ResultMoveAssignBase<T, E>>>;
+
+/**
+ * @brief Compact storage of `Result<void, E>`: the error only, the success is its spare representation.
+ */
+template <typename E>
+struct ResultErrorNicheStorage
+{
+    using Niche = ResultNicheTraits<E>;
+
+    using ErrorRef = E&;
+    using ConstErrorRef = const E&;
+    using ErrorRvalueRef = E&&;
+    using ConstErrorRvalueRef = const E&&;
+
+    constexpr explicit ResultErrorNicheStorage(ValueTag) noexcept : slot_(Niche::fromIndex(0U)) {}
+
+    template <typename... Args>
+    constexpr explicit ResultErrorNicheStorage(ErrorTag, Args&&... args) noexcept(
+        std::is_nothrow_constructible<E, Args...>::value)
+        : slot_(std::forward<Args>(args)...)
+    {
+        // Like the codes out of range in `errorCodeIndex`, the spare representation would silently read as the success
+        assert((Niche::toIndex(slot_) != 0U) && "Error is the spare representation encoding the success");
+    }
+
+    /// @brief Swaps the slots, the error is trivially copyable.
+    constexpr void swapWith(ResultErrorNicheStorage& other) noexcept
+    {
+        const E slot = slot_;
+        slot_ = other.slot_;
+        other.slot_ = slot;
+    }
+
+    /// @brief Replaces the error with the success.
+    constexpr void emplaceValue(std::true_type) noexcept { slot_ = Niche::fromIndex(0U); }
+
+    constexpr bool holdsValue() const noexcept { return Niche::toIndex(slot_) == 0U; }
+    constexpr E& storedError() noexcept { return slot_; }
+    constexpr const E& storedError() const noexcept { return slot_; }
+
+    E slot_; /* The error or the spare representation encoding the success. */
+};
+
+/// @brief Selects the compact storage of `Result<void, E>` when `E` has a spare representation.
+template <typename E>
+using ResultVoidBase = std::conditional_t<(ResultNicheTraits<E>::kCount > 0U) && std::is_trivially_copyable<E>::value,
+                                          ResultErrorNicheStorage<E>,
+                                          ResultMoveAssignBase<Unit, E>>;
+
+/// @brief Value alternative of the storage of `Result<T&, E>`: address of the referenced object.
+template <typename T>
+struct ReferenceSlot
+{
+    T* pointer_; /* Referenced object. */
+};
+
+}  // namespace detail
+
+/**
+ * @brief Addresses `0 .. 4095` never refer to an object, so `Result<T&, E>` has the size of a pointer.
+ *
+ * Unlike `Result<T*>`, `nullptr` is free and encodes the first error code.
+ */
+template <typename T>
+struct ResultNicheTraits<detail::ReferenceSlot<T>>
+{
+    static constexpr std::size_t kCount = 4096U;
+
+    static detail::ReferenceSlot<T> fromIndex(std::size_t index) noexcept
+    {
+        return detail::ReferenceSlot<T>{reinterpret_cast<T*>(index)};
+    }
+
+    static std::size_t toIndex(const detail::ReferenceSlot<T>& value) noexcept
+    {
+        const std::size_t index = static_cast<std::size_t>(reinterpret_cast<std::uintptr_t>(value.pointer_));
+        return (index < kCount) ? index : kCount;
+    }
+};
+
+namespace detail
+{
+
+/// @brief Grants the combinators access to the tagged constructors of `Result`.
+struct ResultAccess
+{
+    template <typename R, typename... Args>
+    static constexpr R makeValue(Args&&... args)
+    {
+        return R(ValueTag{}, std::forward<Args>(args)...);
+    }
+
+    template <typename R, typename... Args>
+    static constexpr R makeError(Args&&... args)
+    {
+        return R(ErrorTag{}, std::forward<Args>(args)...);
+    }
+
+#if INTERVIEW_RESULT_HAS_COROUTINES
+    template <typename R, typename Promise>
+    static R makeBound(Promise& promise)
+    {
+        return R(CoroutineTag{}, promise);
+    }
+#endif
+};
+
+/// @brief Checks whether the type is a `Result`.
+template <typename R>
+struct IsResult : std::false_type
+{
+};
+
+template <typename T, typename E>
+struct IsResult<Result<T, E>> : std::true_type
+{
+};
+
+/// @brief Checks whether the value type of the `Result` (possibly a reference to it) is `void`.
+template <typename Self>
+using HasVoidValue = std::is_void<typename std::decay_t<Self>::ValueType>;
+
+/// @brief Invokes `f` with the value of `self`, or without arguments for `Result<void, E>`.
+template <typename Self, typename F, std::enable_if_t<!HasVoidValue<Self>::value, int> = 0>
+constexpr decltype(auto) invokeWithValue(F&& f, Self&& self)
+{
+    return std::forward<F>(f)(std::forward<Self>(self).valueUnchecked());
+}
+
+template <typename Self, typename F, std::enable_if_t<HasVoidValue<Self>::value, int> = 0>
+constexpr decltype(auto) invokeWithValue(F&& f, Self&& /* self */)
+{
+    return std::forward<F>(f)();
+}
+
+/// @brief Constructs `R` holding the value of `self`.
+template <typename R, typename Self, std::enable_if_t<!HasVoidValue<Self>::value, int> = 0>
+constexpr R makeValueFrom(Self&& self)
+{
+    return ResultAccess::makeValue<R>(std::forward<Self>(self).valueUnchecked());
+}
+
+template <typename R, typename Self, std::enable_if_t<HasVoidValue<Self>::value, int> = 0>
+constexpr R makeValueFrom(Self&& /* self */)
+{
+    return ResultAccess::makeValue<R>();
+}
+
+/// @brief Forwards the value of `self`, nothing for `Result<void, E>`.
+template <typename Self, std::enable_if_t<!HasVoidValue<Self>::value, int> = 0>
+constexpr decltype(auto) forwardValue(Self&& self)
+{
+    return std::forward<Self>(self).valueUnchecked();
+}
+
+template <typename Self, std::enable_if_t<HasVoidValue<Self>::value, int> = 0>
+constexpr void forwardValue(Self&& /* self */)
+{
+}
+
+/// @brief Constructs `R` holding the value returned by `f`, invoking `f` only for `Result<void, E>`.
+template <typename R, typename Self, typename F, std::enable_if_t<!std::is_void<typename R::ValueType>::value, int> = 0>
+constexpr R makeMappedValue(F&& f, Self&& self)
+{
+    return ResultAccess::makeValue<R>(invokeWithValue(std::forward<F>(f), std::forward<Self>(self)));
+}
+
+template <typename R, typename Self, typename F, std::enable_if_t<std::is_void<typename R::ValueType>::value, int> = 0>
+constexpr R makeMappedValue(F&& f, Self&& self)
+{
+    invokeWithValue(std::forward<F>(f), std::forward<Self>(self));
+    return ResultAccess::makeValue<R>();
+}
+
+/**
+ * @brief Monadic combinators of `Result`, implemented on top of its public accessors.
+ *
+ * Every combinator tests the discriminant once and either invokes the callable or forwards the error. The
+ * rvalue overloads move the payload out, so a chain of temporaries inlines to straight-line code.
+ *
+ * @tparam Derived `Result` type providing the combinators.
+ */
+template <typename Derived>
+class ResultCombinators
+{
+  public:
+    /**
+     * @brief Maps the value with `f`, the error is forwarded.
+     *
+     * @param f callable taking the value (nothing for `Result<void, E>`) and returning the new value `U`,
+     *          possibly `void`.
+     * @return `Result<U, E>` with the mapped value or the original error.
+     */
+    template <typename F>
+    constexpr auto map(F&& f) &
+    {
+        return mapImpl(self(), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto map(F&& f) const&
+    {
+        return mapImpl(self(), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto map(F&& f) &&
+    {
+        return mapImpl(std::move(self()), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto map(F&& f) const&&
+    {
+        return mapImpl(std::move(self()), std::forward<F>(f));
+    }
+
+    /// @brief Same as `map`, named after `std::expected::transform`.
+    template <typename F>
+    constexpr auto transform(F&& f) &
+    {
+        return mapImpl(self(), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto transform(F&& f) const&
+    {
+        return mapImpl(self(), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto transform(F&& f) &&
+    {
+        return mapImpl(std::move(self()), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto transform(F&& f) const&&
+    {
+        return mapImpl(std::move(self()), std::forward<F>(f));
+    }
+
+    /**
+     * @brief Chains the next fallible operation `f`, the error is forwarded.
+     *
+     * @param f callable taking the value (nothing for `Result<void, E>`) and returning `Result<U, E>`.
+     * @return result of `f` or the original error.
+     */
+    template <typename F>
+    constexpr auto andThen(F&& f) &
+    {
+        return andThenImpl(self(), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto andThen(F&& f) const&
+    {
+        return andThenImpl(self(), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto andThen(F&& f) &&
+    {
+        return andThenImpl(std::move(self()), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto andThen(F&& f) const&&
+    {
+        return andThenImpl(std::move(self()), std::forward<F>(f));
+    }
+
+    /**
+     * @brief Maps the error with `f`, the value is forwarded.
+     *
+     * @param f callable taking the error and returning the new error `G`.
+     * @return `Result<T, G>` with the original value or the mapped error.
+     */
+    template <typename F>
+    constexpr auto mapError(F&& f) &
+    {
+        return mapErrorImpl(self(), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto mapError(F&& f) const&
+    {
+        return mapErrorImpl(self(), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto mapError(F&& f) &&
+    {
+        return mapErrorImpl(std::move(self()), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto mapError(F&& f) const&&
+    {
+        return mapErrorImpl(std::move(self()), std::forward<F>(f));
+    }
+
+    /**
+     * @brief Recovers from the error with `f`, the value is forwarded.
+     *
+     * @param f callable taking the error and returning `Result<T, G>`.
+     * @return the original value or result of `f`.
+     */
+    template <typename F>
+    constexpr auto orElse(F&& f) &
+    {
+        return orElseImpl(self(), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto orElse(F&& f) const&
+    {
+        return orElseImpl(self(), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto orElse(F&& f) &&
+    {
+        return orElseImpl(std::move(self()), std::forward<F>(f));
+    }
+    template <typename F>
+    constexpr auto orElse(F&& f) const&&
+    {
+        return orElseImpl(std::move(self()), std::forward<F>(f));
+    }
+
+    /**
+     * @brief Get the value, the error is thrown by `ResultExceptionTraits<E>::raise` (`ResultException<E>`).
+     *
+     * The reverse of `tryInvoke`, for callers which report failures as exceptions. The throw is outlined, so
+     * only the test of the discriminant is inlined. Without exceptions the terminate handler is called.
+     *
+     * @return the value, the same reference as `getValue()`, nothing for `Result<void, E>`.
+     */
+    constexpr decltype(auto) orThrow() & { return orThrowImpl(self()); }
+    constexpr decltype(auto) orThrow() const& { return orThrowImpl(self()); }
+    constexpr decltype(auto) orThrow() && { return orThrowImpl(std::move(self())); }
+    constexpr decltype(auto) orThrow() const&& { return orThrowImpl(std::move(self())); }
+
+  private:
+    constexpr Derived& self() noexcept { return static_cast<Derived&>(*this); }
+    constexpr const Derived& self() const noexcept { return static_cast<const Derived&>(*this); }
+
+    template <typename Self, typename F>
+    static constexpr auto mapImpl(Self&& self, F&& f)
+    {
+        using U = std::decay_t<decltype(invokeWithValue(std::forward<F>(f), std::forward<Self>(self)))>;
+        using R = Result<U, typename Derived::ErrorType>;
+        if (self.hasValue())
+        {
+            return makeMappedValue<R>(std::forward<F>(f), std::forward<Self>(self));
+        }
+        return ResultAccess::makeError<R>(std::forward<Self>(self).errorUnchecked());
+    }
+
+    template <typename Self, typename F>
+    static constexpr auto andThenImpl(Self&& self, F&& f)
+    {
+        using R = std::decay_t<decltype(invokeWithValue(std::forward<F>(f), std::forward<Self>(self)))>;
+        static_assert(IsResult<R>::value, "andThen callable must return a Result");
+        static_assert(std::is_same<typename R::ErrorType, typename Derived::ErrorType>::value,
+                      "andThen callable must return a Result with the same error type");
+        if (self.hasValue())
+        {
+            return invokeWithValue(std::forward<F>(f), std::forward<Self>(self));
+        }
+        return ResultAccess::makeError<R>(std::forward<Self>(self).errorUnchecked());
+    }
+
+    template <typename Self>
+    static constexpr decltype(auto) orThrowImpl(Self&& self)
+    {
+        if (INTERVIEW_RESULT_UNLIKELY(!self.hasValue()))
+        {
+            raiseError<typename Derived::ErrorType>(std::forward<Self>(self).errorUnchecked());
+        }
+        return forwardValue(std::forward<Self>(self));
+    }
+
+    template <typename Self, typename F>
+    static constexpr auto mapErrorImpl(Self&& self, F&& f)
+    {
+        using G = std::decay_t<decltype(std::forward<F>(f)(std::forward<Self>(self).errorUnchecked()))>;
+        using R = Result<typename Derived::ValueType, G>;
+        if (self.hasValue())
+        {
+            return makeValueFrom<R>(std::forward<Self>(self));
+        }
+        return ResultAccess::makeError<R>(std::forward<F>(f)(std::forward<Self>(self).errorUnchecked()));
+    }
+
+    template <typename Self, typename F>
+    static constexpr auto orElseImpl(Self&& self, F&& f)
+    {
+        using R = std::decay_t<decltype(std::forward<F>(f)(std::forward<Self>(self).errorUnchecked()))>;
+        static_assert(IsResult<R>::value, "orElse callable must return a Result");
+        static_assert(std::is_same<typename R::ValueType, typename Derived::ValueType>::value,
+                      "orElse callable must return a Result with the same value type");
+        if (self.hasValue())
+        {
+            return makeValueFrom<R>(std::forward<Self>(self));
+        }
+        return std::forward<F>(f)(std::forward<Self>(self).errorUnchecked());
+    }
+};
+
+/// @brief Uses-allocator construction conventions: allocator passed first, last, or not at all.
+struct AllocatorLeading
+{
+};
+
+struct AllocatorTrailing
+{
+};
+
+struct AllocatorIgnored
+{
+};
+
+/// @brief Selects how `U` is constructed from `args` with the allocator, as `std::make_obj_using_allocator` does.
+template <typename U, typename Alloc, typename... Args>
+using AllocatorConventionOf = std::conditional_t<
+    !std::uses_allocator<U, Alloc>::value,
+    AllocatorIgnored,
+    std::conditional_t<std::is_constructible<U, std::allocator_arg_t, const Alloc&, Args...>::value,
+                       AllocatorLeading,
+                       AllocatorTrailing>>;
+
+}  // namespace detail
+
+/**
+ * @brief A class template representing the result of an operation that can
+ * either have a value or an error.
+ *
+ * @tparam T The type of the value.
+ * @tparam E The type of the error. Defaults to `Status`.
+ */
+template <typename T, typename E>
+class Result : private detail::ResultBase<T, E>, public detail::ResultCombinators<Result<T, E>>
+{
+    using Base = detail::ResultBase<T, E>;
+    friend struct detail::ResultAccess;
+
+    // Value and error must be distinguishable. Also Status::OK must be 0:
+    static_assert(!std::is_reference<E>::value && !std::is_void<E>::value, "Error type must be an object type");
+    static_assert(!std::is_same<T, E>::value, "Value and error types must differ");
+    static_assert(!std::is_same<T, Status>::value,
+                  "Status indicates error and can be bind only as an error");  // Stick to the requirements and Status
+                                                                               // class as Error
+    static_assert(static_cast<int32_t>(Status::OK) == 0, "Status::OK must be 0");
+
+  public:
+    using ValueType = T;
+    using ErrorType = E;
+
+    /// @brief Reference types returned by the error accessors, plain `E` for the compact and packed storages.
+    using ErrorReference = typename Base::ErrorRef;
+    using ConstErrorReference = typename Base::ConstErrorRef;
+    using ErrorRvalueReference = typename Base::ErrorRvalueRef;
+    using ConstErrorRvalueReference = typename Base::ConstErrorRvalueRef;
+
+    /**
+     * @brief Default constructor. Constructs a Result object with a
+     * default-constructed value.
+     *
+     * @note Requires `T` to be default constructible.
+     */
+    template <typename U = T, typename = std::enable_if_t<std::is_default_constructible<U>::value>>
+    constexpr Result() noexcept(std::is_nothrow_default_constructible<T>::value) : Base(detail::ValueTag{})
+    {
+    }
+
+    /**
+     * @brief Constructor for value.
+     *
+     * @param other universal reference to the value.
+     */
+    template <typename U = T,
+              typename = std::enable_if_t<!std::is_same<std::decay_t<U>, E>::value &&
+                                          !std::is_same<std::decay_t<U>, Result>::value &&
+                                          std::is_constructible<T, U>::value>>
+    constexpr Result(U&& other) noexcept(std::is_nothrow_constructible<T, U>::value)
+        : Base(detail::ValueTag{}, std::forward<U>(other))
+    {
+    }
+
+    /**
+     * @brief Constructor for error.
+     *
+     * @param error universal reference to the error.
+     */
+    template <typename U = E, typename = std::enable_if_t<std::is_constructible<E, U>::value>>
+    constexpr Result(E&& error) noexcept(std::is_nothrow_constructible<E, U>::value)
+        : Base(detail::ErrorTag{}, std::forward<U>(error))
+    {
+    }
+
+    /**
+     * @brief Constructor for error.
+     *
+     * @param error error to copy.
+     */
+    constexpr Result(const E& error) noexcept(std::is_nothrow_copy_constructible<E>::value)
+        : Base(detail::ErrorTag{}, error)
+    {
+    }
+
+    /**
+     * @brief Constructs a Result object with an error from an ErrorCreate object.
+     *
+     * The error of the creator has to be convertible to `E`, e.g. `createError(Status::ERROR)` initializes
+     * `Result<T, RichError>`.
+     *
+     * @param error object containing the error value.
+     */
+    template <typename U, typename = std::enable_if_t<std::is_constructible<E, U&&>::value>>
+    constexpr Result(ErrorCreate<U>&& error) noexcept(std::is_nothrow_constructible<E, U&&>::value)
+        : Base(detail::ErrorTag{}, std::move(error).getError())
+    {
+    }
+
+    /**
+     * @brief Constructs the value in place, without a temporary `T`.
+     *
+     * @param args arguments of the constructor of `T`.
+     */
+    template <typename... Args, typename = std::enable_if_t<std::is_constructible<T, Args...>::value>>
+    constexpr explicit Result(InPlace, Args&&... args) noexcept(std::is_nothrow_constructible<T, Args...>::value)
+        : Base(detail::ValueTag{}, std::forward<Args>(args)...)
+    {
+    }
+
+    /**
+     * @brief Constructs the error in place, without a temporary `E`.
+     *
+     * @param args arguments of the constructor of `E`.
+     */
+    template <typename... Args, typename = std::enable_if_t<std::is_constructible<E, Args...>::value>>
+    constexpr explicit Result(InPlaceError, Args&&... args) noexcept(std::is_nothrow_constructible<E, Args...>::value)
+        : Base(detail::ErrorTag{}, std::forward<Args>(args)...)
+    {
+    }
+
+    /**
+     * @brief Constructs the value in place with uses-allocator construction.
+     *
+     * The allocator is passed to the constructor of `T` (first after `std::allocator_arg`, or last) when `T` uses
+     * it, e.g. `Result<std::pmr::string>(std::allocator_arg, arena.allocator(), inPlace, "text")`.
+     *
+     * @param alloc allocator of the value.
+     * @param args arguments of the constructor of `T`.
+     */
+    template <typename Alloc, typename... Args>
+    constexpr Result(std::allocator_arg_t, const Alloc& alloc, InPlace, Args&&... args)
+        : Result(detail::AllocatorConventionOf<T, Alloc, Args...>{}, inPlace, alloc, std::forward<Args>(args)...)
+    {
+    }
+
+    /**
+     * @brief Constructs the error in place with uses-allocator construction.
+     *
+     * @param alloc allocator of the error.
+     * @param args arguments of the constructor of `E`.
+     */
+    template <typename Alloc, typename... Args>
+    constexpr Result(std::allocator_arg_t, const Alloc& alloc, InPlaceError, Args&&... args)
+        : Result(detail::AllocatorConventionOf<E, Alloc, Args...>{}, inPlaceError, alloc, std::forward<Args>(args)...)
+    {
+    }
+
+    /**
+     * @brief Copies the value or the error with uses-allocator construction, used by allocator-aware containers.
+     *
+     * @param alloc allocator of the copy.
+     * @param other Result object to copy.
+     */
+    template <typename Alloc>
+    constexpr Result(std::allocator_arg_t, const Alloc& alloc, const Result& other)
+        : Result(other.holdsValue() ? Result(std::allocator_arg, alloc, inPlace, other.storedValue())
+                                    : Result(std::allocator_arg, alloc, inPlaceError, other.storedError()))
+    {
+        INTERVIEW_RESULT_AUDITED(audit_ = other.audit_);
+    }
+
+    /**
+     * @brief Moves the value or the error with uses-allocator construction, used by allocator-aware containers.
+     *
+     * @param alloc allocator of the new object.
+     * @param other Result object to move from.
+     */
+    template <typename Alloc>
+    constexpr Result(std::allocator_arg_t, const Alloc& alloc, Result&& other)
+        : Result(other.holdsValue()
+                     ? Result(std::allocator_arg, alloc, inPlace, std::move(other.storedValue()))
+                     : Result(std::allocator_arg, alloc, inPlaceError, std::move(other.storedError())))
+    {
+        INTERVIEW_RESULT_AUDITED(audit_ = std::move(other.audit_));
+    }
+
+    /// @brief Copy and move operations, trivial whenever the respective operations of `T` and `E` are trivial.
+    Result(const Result&) = default;
+    Result(Result&&) = default;
+    Result& operator=(const Result&) = default;
+    Result& operator=(Result&&) = default;
+
+#if INTERVIEW_RESULT_AUDIT
+    /// @brief Destructor, reports an error nobody checked, see `INTERVIEW_RESULT_AUDIT`.
+    INTERVIEW_RESULT_CONSTEXPR20 ~Result() { audit_.verifyDestruction(this->holdsValue()); }
+#endif
+
+    /**
+     * @brief Destructs the value or the error and constructs the value in place.
+     *
+     * When constructing `T` may throw, the value is constructed aside and moved in, so an exception leaves the
+     * Result object unchanged.
+     *
+     * @param args arguments of the constructor of `T`.
+     * @return the new value.
+     */
+    template <typename... Args, typename = std::enable_if_t<std::is_constructible<T, Args...>::value>>
+    INTERVIEW_RESULT_CONSTEXPR20 T& emplace(Args&&... args) noexcept(std::is_nothrow_constructible<T, Args...>::value)
+    {
+        using Nothrow = std::is_nothrow_constructible<T, Args...>;
+        static_assert(Nothrow::value || std::is_nothrow_move_constructible<T>::value,
+                      "emplace requires a non-throwing constructor or a non-throwing move constructor of T");
+        INTERVIEW_RESULT_AUDITED(audit_.check());
+        return this->emplaceValue(Nothrow{}, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Swaps the value or the error with `other`.
+     *
+     * Results holding the same alternative swap their payloads in place.
+     *
+     * @param other Result object to swap with.
+     */
+    INTERVIEW_RESULT_CONSTEXPR20 void swap(Result& other) noexcept(detail::IsNothrowResultSwap<T, E>::value)
+    {
+        this->swapWith(other);
+        INTERVIEW_RESULT_AUDITED(audit_.swap(other.audit_));
+    }
+
+    /**
+     * @brief Get the value
+     *
+     * @return value
+     * @throws std::runtime_error If the Result object does not have a value.
+     */
+    constexpr const T& getValue() const&
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        if (INTERVIEW_RESULT_UNLIKELY(!this->holdsValue()))
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_VALUE);
+        }
+        return this->storedValue();
+    }
+
+    /**
+     * @brief Get the value
+     *
+     * @return value
+     * @throws std::runtime_error If the Result object does not have a value.
+     */
+    constexpr T& getValue() &
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        if (INTERVIEW_RESULT_UNLIKELY(!this->holdsValue()))
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_VALUE);
+        }
+        return this->storedValue();
+    }
+
+    /**
+     * @brief Get the value
+     *
+     * @return value
+     * @throws std::runtime_error If the Result object does not have a value.
+     */
+    constexpr T&& getValue() &&
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        if (INTERVIEW_RESULT_UNLIKELY(!this->holdsValue()))
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_VALUE);
+        }
+        return std::move(this->storedValue());
+    }
+
+    /**
+     * @brief Get the value
+     *
+     * @return value
+     * @throws std::runtime_error If the Result object does not have a value.
+     */
+    constexpr const T&& getValue() const&&
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        if (INTERVIEW_RESULT_UNLIKELY(!this->holdsValue()))
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_VALUE);
+        }
+        return std::move(this->storedValue());
+    }
+
+    /**
+     * @brief Get the error
+     *
+     * @return error.
+     * @throws std::runtime_error if the Result object does not have an error.
+     */
+    constexpr ErrorReference getError() &
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        if (INTERVIEW_RESULT_UNLIKELY(this->holdsValue()))
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_ERROR);
+        }
+        return this->storedError();
+    }
+
+    /**
+     * @brief Get the error
+     *
+     * @return error.
+     * @throws std::runtime_error if the Result object does not have an error.
+     */
+    constexpr ConstErrorReference getError() const&
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        if (INTERVIEW_RESULT_UNLIKELY(this->holdsValue()))
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_ERROR);
+        }
+        return this->storedError();
+    }
+
+    /**
+     * @brief Get the error
+     *
+     * @return error.
+     * @throws std::runtime_error if the Result object does not have an error.
+     */
+    constexpr ErrorRvalueReference getError() &&
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        if (INTERVIEW_RESULT_UNLIKELY(this->holdsValue()))
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_ERROR);
+        }
+        return static_cast<ErrorRvalueReference>(this->storedError());
+    }
+
+    /**
+     * @brief Get the error
+     *
+     * @return error.
+     * @throws std::runtime_error if the Result object does not have an error.
+     */
+    constexpr ConstErrorRvalueReference getError() const&&
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        if (INTERVIEW_RESULT_UNLIKELY(this->holdsValue()))
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_ERROR);
+        }
+        return static_cast<ConstErrorRvalueReference>(this->storedError());
+    }
+
+    /**
+     * @brief Get the value without checking.
+     *
+     * @pre The Result object has a value.
+     * @return value
+     */
+    constexpr const T& valueUnchecked() const& noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return this->storedValue();
+    }
+
+    /**
+     * @brief Get the value without checking.
+     *
+     * @pre The Result object has a value.
+     * @return value
+     */
+    constexpr T& valueUnchecked() & noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return this->storedValue();
+    }
+
+    /**
+     * @brief Get the value without checking.
+     *
+     * @pre The Result object has a value.
+     * @return value
+     */
+    constexpr T&& valueUnchecked() && noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return std::move(this->storedValue());
+    }
+
+    /**
+     * @brief Get the value without checking.
+     *
+     * @pre The Result object has a value.
+     * @return value
+     */
+    constexpr const T&& valueUnchecked() const&& noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return std::move(this->storedValue());
+    }
+
+    /**
+     * @brief Get the error without checking.
+     *
+     * @pre The Result object has an error.
+     * @return error.
+     */
+    constexpr ConstErrorReference errorUnchecked() const& noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return this->storedError();
+    }
+
+    /**
+     * @brief Get the error without checking.
+     *
+     * @pre The Result object has an error.
+     * @return error.
+     */
+    constexpr ErrorReference errorUnchecked() & noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return this->storedError();
+    }
+
+    /**
+     * @brief Get the error without checking.
+     *
+     * @pre The Result object has an error.
+     * @return error.
+     */
+    constexpr ErrorRvalueReference errorUnchecked() && noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return static_cast<ErrorRvalueReference>(this->storedError());
+    }
+
+    /**
+     * @brief Get the error without checking.
+     *
+     * @pre The Result object has an error.
+     * @return error.
+     */
+    constexpr ConstErrorRvalueReference errorUnchecked() const&& noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return static_cast<ConstErrorRvalueReference>(this->storedError());
+    }
+
+    /// @brief Unchecked access to the value, same as `valueUnchecked()`.
+    constexpr const T& operator*() const& noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return this->storedValue();
+    }
+    constexpr T& operator*() & noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return this->storedValue();
+    }
+    constexpr T&& operator*() && noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return std::move(this->storedValue());
+    }
+    constexpr const T&& operator*() const&& noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return std::move(this->storedValue());
+    }
+
+    /// @brief Unchecked member access to the value.
+    INTERVIEW_RESULT_CONSTEXPR20 const T* operator->() const noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return std::addressof(this->storedValue());
+    }
+    INTERVIEW_RESULT_CONSTEXPR20 T* operator->() noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return std::addressof(this->storedValue());
+    }
+
+    /**
+     * @brief Get the value or the given default when the Result object has an error.
+     *
+     * @param defaultValue value returned when the Result object has an error.
+     * @return copy of the value or `defaultValue`.
+     */
+    template <typename U>
+    constexpr T valueOr(U&& defaultValue) const&
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.check());
+        return this->holdsValue() ? this->storedValue() : static_cast<T>(std::forward<U>(defaultValue));
+    }
+
+    /**
+     * @brief Get the value or the given default when the Result object has an error.
+     *
+     * @param defaultValue value returned when the Result object has an error.
+     * @return value moved out of the Result object or `defaultValue`.
+     */
+    template <typename U>
+    constexpr T valueOr(U&& defaultValue) &&
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.check());
+        return this->holdsValue() ? std::move(this->storedValue()) : static_cast<T>(std::forward<U>(defaultValue));
+    }
+
+    /**
+     * @brief Get the pointer to the value.
+     *
+     * @return pointer to the value or `nullptr` when the Result object has an error.
+     */
+    INTERVIEW_RESULT_CONSTEXPR20 const T* getIf() const noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.check());
+        return this->holdsValue() ? std::addressof(this->storedValue()) : nullptr;
+    }
+
+    /**
+     * @brief Get the pointer to the value.
+     *
+     * @return pointer to the value or `nullptr` when the Result object has an error.
+     */
+    INTERVIEW_RESULT_CONSTEXPR20 T* getIf() noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.check());
+        return this->holdsValue() ? std::addressof(this->storedValue()) : nullptr;
+    }
+
+    /**
+     * @brief Conversion operator to bool.
+     *
+     * @return `true` if the Result object has a value, `false` otherwise.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.check());
+        return INTERVIEW_RESULT_PREDICT_VALUE(this->holdsValue());
+    }
+
+    /**
+     * @brief Check if the Result object has a value.
+     *
+     * @return `true` if the Result object has a value, `false` otherwise.
+     */
+    constexpr bool hasValue() const noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.check());
+        return INTERVIEW_RESULT_PREDICT_VALUE(this->holdsValue());
+    }
+
+    /**
+     * @brief Marks the outcome as checked without inspecting it.
+     *
+     * Documents dropping the result deliberately, e.g. an error superseded by a later one. Does nothing unless
+     * `INTERVIEW_RESULT_AUDIT` is set.
+     */
+    constexpr void discard() const noexcept { INTERVIEW_RESULT_AUDITED(audit_.check()); }
+
+  private:
+    /// @brief Uses-allocator construction of the value (`Tag` is `InPlace`) or of the error (`InPlaceError`).
+    template <typename Tag, typename Alloc, typename... Args>
+    constexpr Result(detail::AllocatorLeading, Tag tag, const Alloc& alloc, Args&&... args)
+        : Result(tag, std::allocator_arg, alloc, std::forward<Args>(args)...)
+    {
+    }
+
+    template <typename Tag, typename Alloc, typename... Args>
+    constexpr Result(detail::AllocatorTrailing, Tag tag, const Alloc& alloc, Args&&... args)
+        : Result(tag, std::forward<Args>(args)..., alloc)
+    {
+    }
+
+    template <typename Tag, typename Alloc, typename... Args>
+    constexpr Result(detail::AllocatorIgnored, Tag tag, const Alloc& /* alloc */, Args&&... args)
+        : Result(tag, std::forward<Args>(args)...)
+    {
+    }
+
+    /// @brief Tagged constructors used by the combinators.
+    template <typename... Args>
+    constexpr explicit Result(detail::ValueTag tag, Args&&... args) : Base(tag, std::forward<Args>(args)...)
+    {
+    }
+
+    template <typename... Args>
+    constexpr explicit Result(detail::ErrorTag tag, Args&&... args) : Base(tag, std::forward<Args>(args)...)
+    {
+    }
+
+#if INTERVIEW_RESULT_HAS_COROUTINES
+    /// @brief Constructs the object returned from a coroutine, the promise assigns the final result to it.
+    template <typename Promise>
+    Result(detail::CoroutineTag, Promise& promise) : Base(detail::ErrorTag{})
+    {
+        static_assert(std::is_default_constructible<E>::value,
+                      "Error type must be default constructible to return Result from a coroutine");
+        promise.bindResult(this);
+    }
+#endif
+
+#if INTERVIEW_RESULT_AUDIT
+  private:  // members
+    detail::ResultAudit audit_; /* Whether the outcome was checked, see `INTERVIEW_RESULT_AUDIT`. */
+#endif
+};
+
+/**
+ * @brief Result of an operation which either succeeds without a value or fails with an error.
+ *
+ * Nothing is stored for the success. When `E` has a spare representation (`ResultNicheTraits<E>`, e.g.
+ * `Status::OK`) the object stores the error only and has the size of `E`, otherwise the error is stored with a
+ * discriminant. The combinators invoke the callables on the value without arguments.
+ *
+ * @tparam E The type of the error.
+ */
+template <typename E>
+class Result<void, E> : private detail::ResultVoidBase<E>, public detail::ResultCombinators<Result<void, E>>
+{
+    using Base = detail::ResultVoidBase<E>;
+    friend struct detail::ResultAccess;
+
+    static_assert(!std::is_reference<E>::value && !std::is_void<E>::value, "Error type must be an object type");
+
+  public:
+    using ValueType = void;
+    using ErrorType = E;
+
+    /// @brief Reference types returned by the error accessors.
+    using ErrorReference = typename Base::ErrorRef;
+    using ConstErrorReference = typename Base::ConstErrorRef;
+    using ErrorRvalueReference = typename Base::ErrorRvalueRef;
+    using ConstErrorRvalueReference = typename Base::ConstErrorRvalueRef;
+
+    /// @brief Default constructor. Constructs a successful Result object.
+    constexpr Result() noexcept : Base(detail::ValueTag{}) {}
+
+    /**
+     * @brief Constructor for error.
+     *
+     * @param error universal reference to the error.
+     */
+    template <typename U = E, typename = std::enable_if_t<std::is_constructible<E, U>::value>>
+    constexpr Result(E&& error) noexcept(std::is_nothrow_constructible<E, U>::value)
+        : Base(detail::ErrorTag{}, std::forward<U>(error))
+    {
+    }
+
+    /**
+     * @brief Constructor for error.
+     *
+     * @param error error to copy.
+     */
+    constexpr Result(const E& error) noexcept(std::is_nothrow_copy_constructible<E>::value)
+        : Base(detail::ErrorTag{}, error)
+    {
+    }
+
+    /**
+     * @brief Constructs a Result object with an error from an ErrorCreate object.
+     *
+     * @param error object containing the error value.
+     */
+    template <typename U, typename = std::enable_if_t<std::is_constructible<E, U&&>::value>>
+    constexpr Result(ErrorCreate<U>&& error) noexcept(std::is_nothrow_constructible<E, U&&>::value)
+        : Base(detail::ErrorTag{}, std::move(error).getError())
+    {
+    }
+
+    /// @brief Constructs a successful Result object, same as the default constructor.
+    constexpr explicit Result(InPlace) noexcept : Base(detail::ValueTag{}) {}
+
+    /**
+     * @brief Constructs the error in place, without a temporary `E`.
+     *
+     * @param args arguments of the constructor of `E`.
+     */
+    template <typename... Args, typename = std::enable_if_t<std::is_constructible<E, Args...>::value>>
+    constexpr explicit Result(InPlaceError, Args&&... args) noexcept(std::is_nothrow_constructible<E, Args...>::value)
+        : Base(detail::ErrorTag{}, std::forward<Args>(args)...)
+    {
+    }
+
+    /// @brief Copy and move operations, trivial whenever the respective operations of `E` are trivial.
+    Result(const Result&) = default;
+    Result(Result&&) = default;
+    Result& operator=(const Result&) = default;
+    Result& operator=(Result&&) = default;
+
+#if INTERVIEW_RESULT_AUDIT
+    /// @brief Destructor, reports an error nobody checked, see `INTERVIEW_RESULT_AUDIT`.
+    INTERVIEW_RESULT_CONSTEXPR20 ~Result() { audit_.verifyDestruction(this->holdsValue()); }
+#endif
+
+    /// @brief Destructs the error, if any, and makes the Result object successful.
+    INTERVIEW_RESULT_CONSTEXPR20 void emplace() noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.check());
+        this->emplaceValue(std::true_type{});
+    }
+
+    /**
+     * @brief Swaps the state and the error with `other`.
+     *
+     * @param other Result object to swap with.
+     */
+    INTERVIEW_RESULT_CONSTEXPR20 void swap(Result& other) noexcept(detail::IsNothrowResultSwap<detail::Unit, E>::value)
+    {
+        this->swapWith(other);
+        INTERVIEW_RESULT_AUDITED(audit_.swap(other.audit_));
+    }
+
+    /**
+     * @brief Check the success.
+     *
+     * @throws std::runtime_error If the Result object has an error.
+     */
+    constexpr void getValue() const
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.check());
+        if (INTERVIEW_RESULT_UNLIKELY(!this->holdsValue()))
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_VALUE);
+        }
+    }
+
+    /**
+     * @brief Get the error
+     *
+     * @return error.
+     * @throws std::runtime_error if the Result object does not have an error.
+     */
+    constexpr ErrorReference getError() &
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        if (INTERVIEW_RESULT_UNLIKELY(this->holdsValue()))
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_ERROR);
+        }
+        return this->storedError();
+    }
+
+    /**
+     * @brief Get the error
+     *
+     * @return error.
+     * @throws std::runtime_error if the Result object does not have an error.
+     */
+    constexpr ConstErrorReference getError() const&
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        if (INTERVIEW_RESULT_UNLIKELY(this->holdsValue()))
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_ERROR);
+        }
+        return this->storedError();
+    }
+
+    /**
+     * @brief Get the error
+     *
+     * @return error.
+     * @throws std::runtime_error if the Result object does not have an error.
+     */
+    constexpr ErrorRvalueReference getError() &&
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        if (INTERVIEW_RESULT_UNLIKELY(this->holdsValue()))
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_ERROR);
+        }
+        return static_cast<ErrorRvalueReference>(this->storedError());
+    }
+
+    /**
+     * @brief Get the error
+     *
+     * @return error.
+     * @throws std::runtime_error if the Result object does not have an error.
+     */
+    constexpr ConstErrorRvalueReference getError() const&&
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        if (INTERVIEW_RESULT_UNLIKELY(this->holdsValue()))
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_ERROR);
+        }
+        return static_cast<ConstErrorRvalueReference>(this->storedError());
+    }
+
+    /// @brief Unchecked access to the value, does nothing. Allows generic code to treat all results alike.
+    constexpr void valueUnchecked() const noexcept {}
+    constexpr void operator*() const noexcept {}
+
+    /**
+     * @brief Get the error without checking.
+     *
+     * @pre The Result object has an error.
+     * @return error.
+     */
+    constexpr ConstErrorReference errorUnchecked() const& noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return this->storedError();
+    }
+
+    /**
+     * @brief Get the error without checking.
+     *
+     * @pre The Result object has an error.
+     * @return error.
+     */
+    constexpr ErrorReference errorUnchecked() & noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return this->storedError();
+    }
+
+    /**
+     * @brief Get the error without checking.
+     *
+     * @pre The Result object has an error.
+     * @return error.
+     */
+    constexpr ErrorRvalueReference errorUnchecked() && noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return static_cast<ErrorRvalueReference>(this->storedError());
+    }
+
+    /**
+     * @brief Get the error without checking.
+     *
+     * @pre The Result object has an error.
+     * @return error.
+     */
+    constexpr ConstErrorRvalueReference errorUnchecked() const&& noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.verifyAccess());
+        return static_cast<ConstErrorRvalueReference>(this->storedError());
+    }
+
+    /**
+     * @brief Conversion operator to bool.
+     *
+     * @return `true` if the Result object succeeded, `false` otherwise.
+     */
+    constexpr explicit operator bool() const noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.check());
+        return INTERVIEW_RESULT_PREDICT_VALUE(this->holdsValue());
+    }
+
+    /**
+     * @brief Check if the Result object succeeded.
+     *
+     * @return `true` if the Result object succeeded, `false` otherwise.
+     */
+    constexpr bool hasValue() const noexcept
+    {
+        INTERVIEW_RESULT_AUDITED(audit_.check());
+        return INTERVIEW_RESULT_PREDICT_VALUE(this->holdsValue());
+    }
+
+    /**
+     * @brief Marks the outcome as checked without inspecting it.
+     *
+     * Documents dropping the result deliberately, e.g. an error superseded by a later one. Does nothing unless
+     * `INTERVIEW_RESULT_AUDIT` is set.
+     */
+    constexpr void discard() const noexcept { INTERVIEW_RESULT_AUDITED(audit_.check()); }
+
+  private:
+    /// @brief Tagged constructors used by the combinators.
+    constexpr explicit Result(detail::ValueTag tag) noexcept : Base(tag) {}
+
+    template <typename... Args>
+    constexpr explicit Result(detail::ErrorTag tag, Args&&... args) : Base(tag, std::forward<Args>(args)...)
+    {
+    }
+
+#if INTERVIEW_RESULT_HAS_COROUTINES
+    /// @brief Constructs the object returned from a coroutine, the promise assigns the final result to it.
+    template <typename Promise>
+    Result(detail::CoroutineTag, Promise& promise) : Base(detail::ErrorTag{})
+    {
+        static_assert(std::is_default_constructible<E>::value,
+                      "Error type must be default constructible to return Result from a coroutine");
+        promise.bindResult(this);
+    }
+#endif
+
+#if INTERVIEW_RESULT_AUDIT
+  private:  // members
+    detail::ResultAudit audit_; /* Whether the outcome was checked, see `INTERVIEW_RESULT_AUDIT`. */
+#endif
+};
+
+/**
+ * @brief Result of an operation which either refers to an existing object or fails with an error.
+ *
+ * Stores the address of the object. Addresses which never refer to an object, `nullptr` included, encode the
+ * error codes, so e.g. `Result<T&>` has the size of a pointer. Like a pointer the reference is shallow: a const
+ * Result object refers to a mutable object, and assignment rebinds the reference. Binding a temporary is not
+ * allowed.
+ *
+ * @tparam T The type of the referenced object.
+ * @tparam E The type of the error.
+ */
+template <typename T, typename E>
+class Result<T&, E> : public detail::ResultCombinators<Result<T&, E>>
+{
+    using Storage = Result<detail::ReferenceSlot<T>, E>;
+    friend struct detail::ResultAccess;
+
+    static_assert(!std::is_reference<E>::value && !std::is_void<E>::value, "Error type must be an object type");
+    static_assert(!std::is_same<std::remove_cv_t<T>, E>::value, "Value and error types must differ");
+
+    /// @brief Checks whether `U` refers to an object which can be bound.
+    template <typename U>
+    using IsBindable = std::integral_constant<bool, !std::is_same<std::decay_t<U>, E>::value &&
+                                                        !std::is_same<std::decay_t<U>, Result>::value &&
+                                                        std::is_convertible<std::remove_reference_t<U>*, T*>::value>;
+
+  public:
+    using ValueType = T&;
+    using ErrorType = E;
+
+    /// @brief Reference types returned by the error accessors.
+    using ErrorReference = typename Storage::ErrorReference;
+    using ConstErrorReference = typename Storage::ConstErrorReference;
+    using ErrorRvalueReference = typename Storage::ErrorRvalueReference;
+    using ConstErrorRvalueReference = typename Storage::ConstErrorRvalueReference;
+
+    /**
+     * @brief Constructor for value.
+     *
+     * @param value object to refer to.
+     */
+    template <typename U, typename = std::enable_if_t<IsBindable<U>::value>>
+    INTERVIEW_RESULT_CONSTEXPR20 Result(U& value) noexcept
+        : storage_(detail::ReferenceSlot<T>{std::addressof(value)})
+    {
+    }
+
+    /// @brief Temporaries are not bound, the reference would dangle.
+    template <typename U,
+              typename = std::enable_if_t<!std::is_lvalue_reference<U>::value && IsBindable<U>::value>>
+    Result(U&& value) = delete;
+
+    /**
+     * @brief Constructor for error.
+     *
+     * @param error universal reference to the error.
+     */
+    template <typename U = E, typename = std::enable_if_t<std::is_constructible<E, U>::value>>
+    constexpr Result(E&& error) noexcept(std::is_nothrow_constructible<E, U>::value)
+        : storage_(std::forward<U>(error))
+    {
+    }
+
+    /**
+     * @brief Constructor for error.
+     *
+     * @param error error to copy.
+     */
+    constexpr Result(const E& error) noexcept(std::is_nothrow_copy_constructible<E>::value) : storage_(error) {}
+
+    /**
+     * @brief Constructs a Result object with an error from an ErrorCreate object.
+     *
+     * @param error object containing the error value.
+     */
+    template <typename U, typename = std::enable_if_t<std::is_constructible<E, U&&>::value>>
+    constexpr Result(ErrorCreate<U>&& error) noexcept(std::is_nothrow_constructible<E, U&&>::value)
+        : storage_(std::move(error))
+    {
+    }
+
+    /**
+     * @brief Constructs the error in place, without a temporary `E`.
+     *
+     * @param args arguments of the constructor of `E`.
+     */
+    template <typename... Args, typename = std::enable_if_t<std::is_constructible<E, Args...>::value>>
+    constexpr explicit Result(InPlaceError, Args&&... args) noexcept(std::is_nothrow_constructible<E, Args...>::value)
+        : storage_(inPlaceError, std::forward<Args>(args)...)
+    {
+    }
+
+    /// @brief Copy and move operations, trivial whenever the respective operations of `E` are trivial.
+    Result(const Result&) = default;
+    Result(Result&&) = default;
+    Result& operator=(const Result&) = default;
+    Result& operator=(Result&&) = default;
+
+    /**
+     * @brief Swaps the reference or the error with `other`, the referenced objects are not swapped.
+     *
+     * @param other Result object to swap with.
+     */
+    INTERVIEW_RESULT_CONSTEXPR20 void swap(Result& other) noexcept(
+        detail::IsNothrowResultSwap<detail::ReferenceSlot<T>, E>::value)
+    {
+        storage_.swap(other.storage_);
+    }
+
+    /**
+     * @brief Get the referenced object
+     *
+     * @return referenced object.
+     * @throws std::runtime_error If the Result object does not have a value.
+     */
+    constexpr T& getValue() const { return *storage_.getValue().pointer_; }
+
+    /**
+     * @brief Get the error
+     *
+     * @return error.
+     * @throws std::runtime_error if the Result object does not have an error.
+     */
+    constexpr ErrorReference getError() & { return storage_.getError(); }
+    constexpr ConstErrorReference getError() const& { return storage_.getError(); }
+    constexpr ErrorRvalueReference getError() && { return std::move(storage_).getError(); }
+    constexpr ConstErrorRvalueReference getError() const&& { return std::move(storage_).getError(); }
+
+    /**
+     * @brief Get the referenced object without checking.
+     *
+     * @pre The Result object has a value.
+     * @return referenced object.
+     */
+    constexpr T& valueUnchecked() const noexcept { return *storage_.valueUnchecked().pointer_; }
+
+    /**
+     * @brief Get the error without checking.
+     *
+     * @pre The Result object has an error.
+     * @return error.
+     */
+    constexpr ConstErrorReference errorUnchecked() const& noexcept { return storage_.errorUnchecked(); }
+    constexpr ErrorReference errorUnchecked() & noexcept { return storage_.errorUnchecked(); }
+    constexpr ErrorRvalueReference errorUnchecked() && noexcept { return std::move(storage_).errorUnchecked(); }
+    constexpr ConstErrorRvalueReference errorUnchecked() const&& noexcept
+    {
+        return std::move(storage_).errorUnchecked();
+    }
+
+    /// @brief Unchecked access to the referenced object, same as `valueUnchecked()`.
+    constexpr T& operator*() const noexcept { return valueUnchecked(); }
+    constexpr T* operator->() const noexcept { return storage_.valueUnchecked().pointer_; }
+
+    /**
+     * @brief Get the referenced object or the given default when the Result object has an error.
+     *
+     * @param defaultValue object returned when the Result object has an error.
+     * @return referenced object or `defaultValue`.
+     */
+    constexpr T& valueOr(T& defaultValue) const noexcept
+    {
+        return storage_.hasValue() ? valueUnchecked() : defaultValue;
+    }
+
+    /**
+     * @brief Get the pointer to the referenced object.
+     *
+     * @return pointer to the referenced object or `nullptr` when the Result object has an error.
+     */
+    constexpr T* getIf() const noexcept { return storage_.hasValue() ? storage_.valueUnchecked().pointer_ : nullptr; }
+
+    /**
+     * @brief Conversion operator to bool.
+     *
+     * @return `true` if the Result object has a value, `false` otherwise.
+     */
+    constexpr explicit operator bool() const noexcept { return storage_.hasValue(); }
+
+    /**
+     * @brief Check if the Result object has a value.
+     *
+     * @return `true` if the Result object has a value, `false` otherwise.
+     */
+    constexpr bool hasValue() const noexcept { return storage_.hasValue(); }
+
+    /// @brief Marks the outcome as checked without inspecting it, see `Result<T, E>::discard()`.
+    constexpr void discard() const noexcept { storage_.discard(); }
+
+  private:
+    /// @brief Tagged constructors used by the combinators.
+    INTERVIEW_RESULT_CONSTEXPR20 explicit Result(detail::ValueTag, T& value) noexcept
+        : storage_(detail::ReferenceSlot<T>{std::addressof(value)})
+    {
+    }
+
+    template <typename... Args>
+    constexpr explicit Result(detail::ErrorTag, Args&&... args)
+        : storage_(detail::ResultAccess::makeError<Storage>(std::forward<Args>(args)...))
+    {
+    }
+
+#if INTERVIEW_RESULT_HAS_COROUTINES
+    /// @brief Constructs the object returned from a coroutine, the promise assigns the final result to it.
+    template <typename Promise>
+    Result(detail::CoroutineTag, Promise& promise) : storage_(detail::ResultAccess::makeError<Storage>())
+    {
+        static_assert(std::is_default_constructible<E>::value,
+                      "Error type must be default constructible to return Result from a coroutine");
+        promise.bindResult(this);
+    }
+#endif
+
+    Storage storage_; /* Address of the referenced object or the error. */
+};
+
+#if !INTERVIEW_RESULT_AUDIT
+// Without the audit its state must not cost a byte, the compact storages stay the size of their payload:
+static_assert(sizeof(Result<int*>) == sizeof(int*), "Result<T*> must have the size of a pointer");
+static_assert(sizeof(Result<int&>) == sizeof(int*), "Result<T&> must have the size of a pointer");
+static_assert(sizeof(Result<void>) == sizeof(Status), "Result<void> must have the size of Status");
+#endif
+
+/**
+ * @brief Creates the Result object holding the value constructed in place from `args`.
+ *
+ * The Result object is returned as a prvalue, so from C++17 on it initializes the object of the caller directly:
+ * the value is constructed once, without a temporary and without a move, and `T` need not be movable.
+ *
+ * @code
+ * return makeResult<Message>(header, payload);
+ * @endcode
+ *
+ * @tparam T The type of the value.
+ * @tparam E The type of the error. Defaults to `Status`.
+ * @param args arguments of the constructor of `T`.
+ */
+template <typename T, typename E = Status, typename... Args>
+constexpr Result<T, E> makeResult(Args&&... args) noexcept(
+    std::is_nothrow_constructible<Result<T, E>, InPlace, Args...>::value)
+{
+    return Result<T, E>(inPlace, std::forward<Args>(args)...);
+}
+
+namespace detail
+{
+
+/// @brief Value type of the `Result` returned by `tryInvoke(f, args...)`.
+template <typename F, typename... Args>
+using InvokeValue = std::decay_t<decltype(std::declval<F>()(std::declval<Args>()...))>;
+
+/// @brief Constructs `R` holding the value returned by `f`.
+template <typename R,
+          typename F,
+          typename... Args,
+          std::enable_if_t<!std::is_void<typename R::ValueType>::value, int> = 0>
+R invokeInto(F&& f, Args&&... args)
+{
+    return ResultAccess::makeValue<R>(std::forward<F>(f)(std::forward<Args>(args)...));
+}
+
+template <typename R,
+          typename F,
+          typename... Args,
+          std::enable_if_t<std::is_void<typename R::ValueType>::value, int> = 0>
+R invokeInto(F&& f, Args&&... args)
+{
+    std::forward<F>(f)(std::forward<Args>(args)...);
+    return ResultAccess::makeValue<R>();
+}
+
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+/// @brief Maps the exception being handled to the error of `R`, outlined so the caller keeps the success path only.
+template <typename R>
+INTERVIEW_RESULT_COLD R currentExceptionError() noexcept(
+    std::is_nothrow_move_constructible<typename R::ErrorType>::value)
+{
+    return ResultAccess::makeError<R>(ResultExceptionTraits<typename R::ErrorType>::fromCurrentException());
+}
+#endif
+
+}  // namespace detail
+
+/**
+ * @brief Invokes a throwing callable and returns its outcome as a `Result`, the boundary to throwing APIs.
+ *
+ * An exception is caught and mapped to `E` by `ResultExceptionTraits<E>::fromCurrentException()` in an outlined
+ * cold function, so the call site keeps the success path inlined. Without exceptions `f` is invoked directly.
+ *
+ * @code
+ * const Result<int> port = tryInvoke([&text]() { return std::stoi(text); });
+ * @endcode
+ *
+ * @tparam E The type of the error. Defaults to `Status`.
+ * @param f callable returning the value, possibly `void`.
+ * @param args arguments of `f`.
+ * @return `Result<U, E>` with the value returned by `f` or the error of the exception.
+ */
+template <typename E = Status, typename F, typename... Args>
+Result<detail::InvokeValue<F, Args...>, E> tryInvoke(F&& f, Args&&... args) noexcept(
+    std::is_nothrow_move_constructible<E>::value)
+{
+    using R = Result<detail::InvokeValue<F, Args...>, E>;
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+    try
+    {
+        return detail::invokeInto<R>(std::forward<F>(f), std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        return detail::currentExceptionError<R>();
+    }
+#else
+    return detail::invokeInto<R>(std::forward<F>(f), std::forward<Args>(args)...);
+#endif
+}
+
+/// @brief Swaps the Result objects, found by argument dependent lookup (`using std::swap; swap(a, b);`).
+template <typename T, typename E>
+INTERVIEW_RESULT_CONSTEXPR20 void swap(Result<T, E>& a, Result<T, E>& b) noexcept(noexcept(a.swap(b)))
+{
+    a.swap(b);
+}
+
+namespace detail
+{
+
+/// @brief Compares the values of results holding one, there is nothing to compare for `Result<void, E>`.
+template <typename R, std::enable_if_t<!HasVoidValue<R>::value, int> = 0>
+constexpr bool valuesEqual(const R& a, const R& b)
+{
+    return static_cast<bool>(a.valueUnchecked() == b.valueUnchecked());
+}
+
+template <typename R, std::enable_if_t<HasVoidValue<R>::value, int> = 0>
+constexpr bool valuesEqual(const R& /* a */, const R& /* b */)
+{
+    return true;
+}
+
+template <typename R, std::enable_if_t<!HasVoidValue<R>::value, int> = 0>
+constexpr bool valuesLess(const R& a, const R& b)
+{
+    return static_cast<bool>(a.valueUnchecked() < b.valueUnchecked());
+}
+
+template <typename R, std::enable_if_t<HasVoidValue<R>::value, int> = 0>
+constexpr bool valuesLess(const R& /* a */, const R& /* b */)
+{
+    return false;
+}
+
+/// @brief Hashes the value, `std::hash` of the referenced object for `Result<T&, E>`.
+template <typename R, std::enable_if_t<!HasVoidValue<R>::value, int> = 0>
+std::size_t hashValue(const R& result)
+{
+    using Value = std::remove_cv_t<std::remove_reference_t<typename R::ValueType>>;
+    return std::hash<Value>{}(result.valueUnchecked());
+}
+
+template <typename R, std::enable_if_t<HasVoidValue<R>::value, int> = 0>
+std::size_t hashValue(const R& /* result */)
+{
+    return 0U;
+}
+
+/// @brief Whether `std::hash` of the payload is enabled, of the referenced object for references.
+template <typename T>
+struct IsHashEnabled : std::is_default_constructible<std::hash<std::remove_cv_t<std::remove_reference_t<T>>>>
+{
+};
+
+template <>
+struct IsHashEnabled<void> : std::true_type
+{
+};
+
+/// @brief `std::hash` of `Result<T, E>`, disabled like `std::hash` of `std::optional` unless the payloads hash.
+template <typename T, typename E, bool = IsHashEnabled<T>::value && IsHashEnabled<E>::value>
+struct ResultHash
+{
+    std::size_t operator()(const Result<T, E>& result) const
+    {
+        return result.hasValue() ? hashValue(result) : ~std::hash<E>{}(result.errorUnchecked());
+    }
+};
+
+template <typename T, typename E>
+struct ResultHash<T, E, false>
+{
+    ResultHash() = delete;
+    ResultHash(const ResultHash&) = delete;
+    ResultHash& operator=(const ResultHash&) = delete;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Results are equal when they hold the same alternative with equal payloads.
+ *
+ * `Result<T&, E>` compares the referenced objects, `Result<void, E>` the errors only.
+ */
+template <typename T, typename E>
+constexpr bool operator==(const Result<T, E>& a, const Result<T, E>& b)
+{
+    if (a.hasValue() != b.hasValue())
+    {
+        return false;
+    }
+    return a.hasValue() ? detail::valuesEqual(a, b) : static_cast<bool>(a.errorUnchecked() == b.errorUnchecked());
+}
+
+template <typename T, typename E>
+constexpr bool operator!=(const Result<T, E>& a, const Result<T, E>& b)
+{
+    return !(a == b);
+}
+
+/**
+ * @brief Orders errors before values, results holding the same alternative by their payloads.
+ *
+ * Sorting a batch of results therefore groups the failures at its beginning.
+ */
+template <typename T, typename E>
+constexpr bool operator<(const Result<T, E>& a, const Result<T, E>& b)
+{
+    if (a.hasValue() != b.hasValue())
+    {
+        return b.hasValue();
+    }
+    return a.hasValue() ? detail::valuesLess(a, b) : static_cast<bool>(a.errorUnchecked() < b.errorUnchecked());
+}
+
+template <typename T, typename E>
+constexpr bool operator>(const Result<T, E>& a, const Result<T, E>& b)
+{
+    return b < a;
+}
+
+template <typename T, typename E>
+constexpr bool operator<=(const Result<T, E>& a, const Result<T, E>& b)
+{
+    return !(b < a);
+}
+
+template <typename T, typename E>
+constexpr bool operator>=(const Result<T, E>& a, const Result<T, E>& b)
+{
+    return !(a < b);
+}
+
+/// @brief Concatenates the tokens after expanding them.
+#define INTERVIEW_RESULT_CONCAT_IMPL(a, b) a##b
+#define INTERVIEW_RESULT_CONCAT(a, b) INTERVIEW_RESULT_CONCAT_IMPL(a, b)
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(INTERVIEW_RESULT_NO_STATEMENT_EXPRESSIONS)
+#define INTERVIEW_RESULT_TRY_IMPL(var, expr, tmp)                                                                  \
+    var = __extension__({                                                                                          \
+        auto&& tmp = (expr);                                                                                       \
+        if (!tmp.hasValue())                                                                                       \
+        {                                                                                                          \
+            return ::interview::library::createError(std::forward<decltype(tmp)>(tmp).errorUnchecked());          \
+        }                                                                                                          \
+        std::forward<decltype(tmp)>(tmp).valueUnchecked();                                                         \
+    })
+#else
+#define INTERVIEW_RESULT_TRY_IMPL(var, expr, tmp)                                                                  \
+    auto&& tmp = (expr);                                                                                           \
+    if (!tmp.hasValue())                                                                                           \
+    {                                                                                                              \
+        return ::interview::library::createError(std::forward<decltype(tmp)>(tmp).errorUnchecked());              \
+    }                                                                                                              \
+    var = std::forward<decltype(tmp)>(tmp).valueUnchecked()
+#endif
+
+/**
+ * @brief Evaluates `expr` returning a `Result`. On error returns the error from the enclosing function, otherwise
+ * initializes `var` with the value (moved out when `expr` is an rvalue).
+ *
+ * The enclosing function has to return a `Result` whose error is constructible from the propagated error.
+ * On GCC and Clang it expands to a single statement expression.
+ *
+ * @code
+ * RESULT_TRY(auto quotient, divideNumbers(a, b));
+ * @endcode
+ */
+#define RESULT_TRY(var, expr) INTERVIEW_RESULT_TRY_IMPL(var, expr, INTERVIEW_RESULT_CONCAT(result_try_, __COUNTER__))
+
+#if INTERVIEW_RESULT_HAS_COROUTINES
+namespace detail
+{
+
+template <typename T, typename E>
+class ResultPromise;
+
+/// @brief `co_return` of the promise: with the value, or without it for `Result<void, E>`.
+template <typename T, typename E>
+class ResultPromiseReturn
+{
+  public:
+    template <typename U>
+    void return_value(U&& value)
+    {
+        static_cast<ResultPromise<T, E>*>(this)->setResult(Result<T, E>(std::forward<U>(value)));
+    }
+};
+
+template <typename E>
+class ResultPromiseReturn<void, E>
+{
+  public:
+    void return_void() { static_cast<ResultPromise<void, E>*>(this)->setResult(Result<void, E>()); }
+};
+
+/**
+ * @brief Object returned by `get_return_object` of the coroutine promise, converted to the returned `Result`.
+ *
+ * Compilers convert it either before the coroutine body runs (then the `Result` is bound to the promise and
+ * assigned on completion), or after the body completed (then the result kept here is moved out). The body of a
+ * `Result` coroutine never suspends without completing, so the state tells which of both happened.
+ */
+template <typename T, typename E>
+class ResultReturnObject
+{
+  public:
+    explicit ResultReturnObject(ResultPromise<T, E>& promise) noexcept : promise_(&promise), engaged_(false)
+    {
+        promise_->bindReturnObject(this);
+    }
+
+    ResultReturnObject(ResultReturnObject&& other) noexcept(std::is_nothrow_move_constructible<Result<T, E>>::value)
+        : promise_(other.promise_), engaged_(false)
+    {
+        promise_->bindReturnObject(this);
+        if (other.engaged_)
+        {
+            emplace(std::move(other.result_));
+        }
+    }
+
+    ResultReturnObject(const ResultReturnObject&) = delete;
+    ResultReturnObject& operator=(const ResultReturnObject&) = delete;
+    ResultReturnObject& operator=(ResultReturnObject&&) = delete;
+
+    ~ResultReturnObject()
+    {
+        if (engaged_)
+        {
+            result_.~Result();
+        }
+    }
+
+    operator Result<T, E>()
+    {
+        if (engaged_)
+        {
+            return std::move(result_);
+        }
+        return ResultAccess::makeBound<Result<T, E>>(*promise_);
+    }
+
+    void emplace(Result<T, E>&& result)
+    {
+        new (&result_) Result<T, E>(std::move(result));
+        engaged_ = true;
+    }
+
+  private:
+    ResultPromise<T, E>* promise_;
+    union
+    {
+        Result<T, E> result_;
+    };
+    bool engaged_;
+};
+
+/**
+ * @brief Per thread cache of the frames of `Result` coroutines.
+ *
+ * The frame handle of a `Result` coroutine never escapes, yet GCC (12, `-O2`) still allocates every frame with
+ * `operator new`. A released frame is kept for the next coroutine of at most its size, so a thread calling
+ * coroutines repeatedly, on the value and on the error path, allocates each nesting level of frames once. The
+ * frames are released on the thread which allocated them: `Result` coroutines complete before returning.
+ */
+class ResultFramePool
+{
+  public:
+    /// @brief Number of frames kept per thread, covers coroutines awaiting coroutines a few levels deep.
+    static constexpr std::size_t kCapacity = 8U;
+
+    /// @brief Allocates a frame of `size` bytes, reusing a cached frame at least as large.
+    static void* allocate(std::size_t size)
+    {
+        Cache& cache = local();
+        for (std::size_t index = cache.count_; index > 0U; --index)
+        {
+            Header* block = cache.blocks_[index - 1U];
+            if (block->capacity_ >= size)
+            {
+                cache.blocks_[index - 1U] = cache.blocks_[--cache.count_];
+                return block + 1;
+            }
+        }
+        Header* block = static_cast<Header*>(::operator new(sizeof(Header) + size));
+        block->capacity_ = size;
+        return block + 1;
+    }
+
+    /// @brief Releases a frame allocated on this thread, it is cached unless the cache is full.
+    static void deallocate(void* frame) noexcept
+    {
+        Header* block = static_cast<Header*>(frame) - 1;
+        Cache& cache = local();
+        if (cache.count_ < kCapacity)
+        {
+            cache.blocks_[cache.count_++] = block;
+        }
+        else
+        {
+            ::operator delete(block);
+        }
+    }
+
+  private:  // methods
+    /// @brief Size of the frame following it, padded so the frame keeps the alignment of `operator new`.
+    struct alignas(std::max_align_t) Header
+    {
+        std::size_t capacity_; /* Bytes available to the frame. */
+    };
+
+    /// @brief Frames released on the thread, freed when it exits.
+    struct Cache
+    {
+        Cache() noexcept = default;
+        Cache(const Cache&) = delete;
+        Cache& operator=(const Cache&) = delete;
+
+        ~Cache()
+        {
+            for (std::size_t index = 0U; index < count_; ++index)
+            {
+                ::operator delete(blocks_[index]);
+            }
+        }
+
+        Header* blocks_[kCapacity]{}; /* Cached frames. */
+        std::size_t count_{0U};       /* Number of cached frames. */
+    };
+
+    static Cache& local() noexcept
+    {
+        static thread_local Cache cache;
+        return cache;
+    }
+};
+
+/**
+ * @brief Promise of a coroutine returning `Result<T, E>`.
+ *
+ * `co_await` on a `Result` with a value resumes with the value, on error the error is stored and the coroutine
+ * frame is destroyed immediately. The frame handle never escapes, so compilers performing heap allocation
+ * elision drop the frame allocation. Otherwise the frame comes from the `ResultFramePool` of the thread.
+ */
+template <typename T, typename E>
+class ResultPromise : public ResultPromiseReturn<T, E>
+{
+    friend class ResultPromiseReturn<T, E>;
+
+  public:
+    /// @brief Awaiter of a `Result` inside the coroutine.
+    template <typename R>
+    class Awaiter
+    {
+      public:
+        explicit Awaiter(R&& result) noexcept : result_(std::forward<R>(result)) {}
+
+        bool await_ready() const noexcept { return result_.hasValue(); }
+
+        decltype(auto) await_resume() { return std::forward<R>(result_).valueUnchecked(); }
+
+        void await_suspend(std::coroutine_handle<ResultPromise> handle)
+        {
+            handle.promise().setResult(
+                ResultAccess::makeError<Result<T, E>>(std::forward<R>(result_).errorUnchecked()));
+            handle.destroy();
+        }
+
+      private:
+        R&& result_;
+    };
+
+    ResultPromise() noexcept : returnObject_(nullptr), result_(nullptr) {}
+
+    static void* operator new(std::size_t size) { return ResultFramePool::allocate(size); }
+    static void operator delete(void* frame, std::size_t /* size */) noexcept { ResultFramePool::deallocate(frame); }
+
+    ResultReturnObject<T, E> get_return_object() noexcept { return ResultReturnObject<T, E>(*this); }
+    std::suspend_never initial_suspend() const noexcept { return {}; }
+    std::suspend_never final_suspend() const noexcept { return {}; }
+
+    void unhandled_exception()
+    {
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+        throw;
+#else
+        std::abort();
+#endif
+    }
+
+    template <typename R, typename = std::enable_if_t<IsResult<std::decay_t<R>>::value>>
+    Awaiter<R> await_transform(R&& result) noexcept
+    {
+        return Awaiter<R>(std::forward<R>(result));
+    }
+
+    void bindReturnObject(ResultReturnObject<T, E>* returnObject) noexcept { returnObject_ = returnObject; }
+
+    // `result` is the prvalue returned by the conversion of the return object, guaranteed copy elision constructs
+    // it directly in the caller's object, so the pointer stays valid until the coroutine completes. GCC cannot see
+    // the elision through the conversion and reports a dangling pointer.
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdangling-pointer"
+#endif
+    void bindResult(Result<T, E>* result) noexcept { result_ = result; }
+#if defined(__GNUC__) && !defined(__clang__) && (__GNUC__ >= 12)
+#pragma GCC diagnostic pop
+#endif
+
+  private:
+    void setResult(Result<T, E>&& result)
+    {
+        if (result_ != nullptr)
+        {
+            *result_ = std::move(result);
+        }
+        else
+        {
+            returnObject_->emplace(std::move(result));
+        }
+    }
+
+  private:
+    ResultReturnObject<T, E>* returnObject_; /* Holds the result when converted after the body completed. */
+    Result<T, E>* result_;                   /* Returned object when converted before the body runs. */
+};
+
+}  // namespace detail
+#endif
+
+}  // namespace library
+}  // namespace interview
+
+namespace std
+{
+
+/**
+ * @brief Result objects holding an object value use the allocator when their value or their error does, so
+ * allocator-aware containers (e.g. `std::pmr::vector<Result<std::pmr::string>>`) pass their allocator on.
+ */
+template <typename T, typename E, typename Alloc>
+struct uses_allocator<interview::library::Result<T, E>, Alloc>
+    : integral_constant<bool,
+                        !is_void<T>::value && !is_reference<T>::value &&
+                            (uses_allocator<T, Alloc>::value || uses_allocator<E, Alloc>::value)>
+{
+};
+
+/**
+ * @brief Hash of the held alternative, so Result objects can be keys of unordered containers.
+ *
+ * A value hashes as `std::hash<T>` (a constant for `Result<void, E>`), an error as the complement of
+ * `std::hash<E>`, so a value and an error with equal hashes do not collide. Disabled unless `std::hash` of the value
+ * and of the error are enabled.
+ */
+template <typename T, typename E>
+struct hash<interview::library::Result<T, E>> : interview::library::detail::ResultHash<T, E>
+{
+};
+
+}  // namespace std
+
+#if INTERVIEW_RESULT_HAS_COROUTINES
+/// @brief Makes functions returning `Result` coroutines which can `co_await` other `Result` objects.
+template <typename T, typename E, typename... Args>
+struct std::coroutine_traits<interview::library::Result<T, E>, Args...>
+{
+    using promise_type = interview::library::detail::ResultPromise<T, E>;
+};
+#endif
 
 #endif  // INTERVIEW_LIBRARY_RESULT_HPP
\ No newline at end of file
@@ -0,0 +1,419 @@
+/**
+ * @file result_cache.hpp
+ * @brief Definition of the ResultCache class.
+ *
+ * This file contains the definition of the ResultCache class, a concurrent memoizing cache of
+ * functions returning `Result`. The entries are `Result<T, E>` objects, so failures are cached
+ * as well as successes, with their own (usually shorter) time to live. The keys are spread over
+ * shards, each guarded by its own mutex and evicting its least recently used entries. Concurrent
+ * misses of the same key are coalesced: one caller computes the result, the others wait for it.
+ *
+ * @note This class is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_RESULT_CACHE_HPP
+#define INTERVIEW_LIBRARY_RESULT_CACHE_HPP
+
+#include "lib/result.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+
+/**
+ * @brief Counters of a ResultCache, updated without synchronization between each other.
+ */
+struct ResultCacheStats
+{
+    std::uint64_t hits_{0U};         /* Lookups answered by a cached entry, values or errors. */
+    std::uint64_t errorHits_{0U};    /* Lookups answered by a cached error. */
+    std::uint64_t misses_{0U};       /* Lookups without a valid cached entry. */
+    std::uint64_t computations_{0U}; /* Invocations of the computing functions. */
+    std::uint64_t coalesced_{0U};    /* Misses which waited for the computation of another caller. */
+    std::uint64_t evictions_{0U};    /* Entries evicted to respect the capacity. */
+};
+
+/**
+ * @brief Sharded concurrent cache of `Result<T, E>` entries with negative caching and single-flight misses.
+ *
+ * @tparam K The type of the key, hashed by `Hash` and compared with `operator==`.
+ * @tparam T The type of the cached value.
+ * @tparam E The type of the cached error. Defaults to `Status`.
+ * @tparam Hash The hash of the key.
+ * @tparam Clock The clock measuring the time to live, e.g. a manual clock in tests.
+ */
+template <typename K,
+          typename T,
+          typename E = Status,
+          typename Hash = std::hash<K>,
+          typename Clock = std::chrono::steady_clock>
+class ResultCache
+{
+  public:
+    using Entry = Result<T, E>;
+    using Duration = typename Clock::duration;
+    using TimePoint = typename Clock::time_point;
+
+    /// @brief Default capacity and number of shards.
+    static constexpr std::size_t kDefaultCapacity = 4096U;
+    static constexpr std::size_t kDefaultShards = 16U;
+
+    /**
+     * @brief Constructs an empty cache.
+     *
+     * @param valueTtl time to live of the cached values.
+     * @param errorTtl time to live of the cached errors, zero disables caching of errors.
+     * @param capacity maximum number of entries, split evenly over the shards.
+     * @param shards number of shards, each guarded by its own mutex.
+     */
+    explicit ResultCache(Duration valueTtl,
+                         Duration errorTtl,
+                         std::size_t capacity = kDefaultCapacity,
+                         std::size_t shards = kDefaultShards)
+        : valueTtl_(valueTtl),
+          errorTtl_(errorTtl),
+          shardCapacity_(std::max<std::size_t>(1U, (capacity + shards - 1U) / std::max<std::size_t>(1U, shards))),
+          shards_(std::max<std::size_t>(1U, shards))
+    {
+    }
+
+    ResultCache(const ResultCache&) = delete;
+    ResultCache& operator=(const ResultCache&) = delete;
+
+    /**
+     * @brief Get the cached result of the key or compute it.
+     *
+     * On a miss `compute(key)` is invoked without holding any lock; concurrent misses of the same key wait for
+     * this single computation and share its result, also when it is not cached (zero time to live). When it
+     * throws, the exception is rethrown to all of them and nothing is cached.
+     *
+     * @param key key of the result.
+     * @param compute function taking the key and returning `Result<T, E>`. It must not look up the same key.
+     * @return copy of the cached or the computed result.
+     */
+    template <typename F>
+    Entry getOrCompute(const K& key, F&& compute)
+    {
+        static_assert(std::is_same<std::decay_t<decltype(compute(key))>, Entry>::value,
+                      "compute must return the entry type of the cache");
+        Shard& shard = shardOf(key);
+        std::unique_lock<std::mutex> lock(shard.mutex_);
+        const Node* node = findValid(shard, key);
+        if (node != nullptr)
+        {
+            return node->entry_;
+        }
+
+        auto flight = shard.flights_.find(key);
+        if (flight != shard.flights_.end())
+        {
+            // Another caller computes the entry, wait for it
+            const std::shared_ptr<Flight> pending = flight->second;
+            stats_.coalesced_.fetch_add(1U, std::memory_order_relaxed);
+            pending->done_.wait(lock, [&pending]() { return pending->completed_; });
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+            if (pending->exception_ != nullptr)
+            {
+                std::rethrow_exception(pending->exception_);
+            }
+#endif
+            return *pending->entry_;
+        }
+
+        const std::shared_ptr<Flight> own = std::make_shared<Flight>();
+        shard.flights_.emplace(key, own);
+        const FlightCompletion completion(shard, key, *own, lock);
+        lock.unlock();
+        stats_.computations_.fetch_add(1U, std::memory_order_relaxed);
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+        try
+        {
+            own->entry_.reset(new Entry(std::forward<F>(compute)(key)));
+        }
+        catch (...)
+        {
+            own->exception_ = std::current_exception();
+            throw;
+        }
+#else
+        own->entry_.reset(new Entry(std::forward<F>(compute)(key)));
+#endif
+        lock.lock();
+        own->entry_->discard();  // Each caller checks its own copy
+        store(shard, key, Entry(*own->entry_));
+        return *own->entry_;
+    }
+
+    /**
+     * @brief Get the cached result of the key.
+     *
+     * @param key key of the result.
+     * @param entry set to a copy of the cached result when there is one.
+     * @return `true` if a valid result is cached for the key, `false` otherwise.
+     */
+    bool tryGet(const K& key, Entry& entry)
+    {
+        Shard& shard = shardOf(key);
+        const std::lock_guard<std::mutex> lock(shard.mutex_);
+        const Node* node = findValid(shard, key);
+        if (node == nullptr)
+        {
+            return false;
+        }
+        entry = node->entry_;
+        return true;
+    }
+
+    /**
+     * @brief Caches the result of the key, replacing the cached one.
+     *
+     * @param key key of the result.
+     * @param entry result to cache, errors are not cached when their time to live is zero.
+     */
+    void put(const K& key, Entry entry)
+    {
+        Shard& shard = shardOf(key);
+        const std::lock_guard<std::mutex> lock(shard.mutex_);
+        store(shard, key, std::move(entry));
+    }
+
+    /**
+     * @brief Removes the cached result of the key, a pending computation still completes.
+     *
+     * @return `true` if a result was cached for the key, `false` otherwise.
+     */
+    bool invalidate(const K& key)
+    {
+        Shard& shard = shardOf(key);
+        const std::lock_guard<std::mutex> lock(shard.mutex_);
+        auto node = shard.nodes_.find(key);
+        if (node == shard.nodes_.end())
+        {
+            return false;
+        }
+        erase(shard, node);
+        return true;
+    }
+
+    /// @brief Removes all cached results.
+    void clear()
+    {
+        for (Shard& shard : shards_)
+        {
+            const std::lock_guard<std::mutex> lock(shard.mutex_);
+            shard.nodes_.clear();
+            shard.order_.clear();
+        }
+    }
+
+    /// @brief Get the number of cached results, including the expired ones not removed yet.
+    std::size_t size() const
+    {
+        std::size_t count = 0U;
+        for (const Shard& shard : shards_)
+        {
+            const std::lock_guard<std::mutex> lock(shard.mutex_);
+            count += shard.nodes_.size();
+        }
+        return count;
+    }
+
+    /// @brief Get the counters of the cache.
+    ResultCacheStats stats() const noexcept
+    {
+        ResultCacheStats stats;
+        stats.hits_ = stats_.hits_.load(std::memory_order_relaxed);
+        stats.errorHits_ = stats_.errorHits_.load(std::memory_order_relaxed);
+        stats.misses_ = stats_.misses_.load(std::memory_order_relaxed);
+        stats.computations_ = stats_.computations_.load(std::memory_order_relaxed);
+        stats.coalesced_ = stats_.coalesced_.load(std::memory_order_relaxed);
+        stats.evictions_ = stats_.evictions_.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+  private:  // types
+    using Order = std::list<K>;
+
+    struct Node
+    {
+        Entry entry_;                      /* Cached result. */
+        TimePoint expiry_;                 /* End of the time to live. */
+        typename Order::iterator recency_; /* Position in the recency order of the shard. */
+    };
+
+    /// @brief Computation of a missing entry, shared by the callers waiting for it.
+    struct Flight
+    {
+        std::condition_variable done_; /* Notified once the computation completed. */
+        bool completed_{false};        /* Set once the computation completed. */
+        std::unique_ptr<Entry> entry_; /* Computed result. */
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+        std::exception_ptr exception_; /* Exception thrown by the computation. */
+#endif
+    };
+
+    struct Shard
+    {
+        mutable std::mutex mutex_;                                     /* Guards the members below. */
+        std::unordered_map<K, Node, Hash> nodes_;                      /* Cached results. */
+        Order order_;                                                  /* Keys, most recently used first. */
+        std::unordered_map<K, std::shared_ptr<Flight>, Hash> flights_; /* Pending computations. */
+    };
+
+    /**
+     * @brief Completes the flight when the computing caller leaves `getOrCompute`, also by an exception.
+     *
+     * Otherwise the flight stays registered and all waiters and later callers of the key wait for it forever.
+     * Waiters get the computed entry when only caching it failed, the exception when the computation threw.
+     */
+    class FlightCompletion
+    {
+      public:
+        FlightCompletion(Shard& shard, const K& key, Flight& flight, std::unique_lock<std::mutex>& lock) noexcept
+            : shard_(shard), key_(key), flight_(flight), lock_(lock)
+        {
+        }
+
+        FlightCompletion(const FlightCompletion&) = delete;
+        FlightCompletion& operator=(const FlightCompletion&) = delete;
+
+        ~FlightCompletion()
+        {
+            if (!lock_.owns_lock())
+            {
+                lock_.lock();
+            }
+            complete(shard_, key_, flight_);
+        }
+
+      private:  // members
+        Shard& shard_;                       /* Shard registering the flight. */
+        const K& key_;                       /* Key computed by the flight. */
+        Flight& flight_;                     /* Flight to complete. */
+        std::unique_lock<std::mutex>& lock_; /* Lock of the shard, held while completing. */
+    };
+
+    struct Counters
+    {
+        std::atomic<std::uint64_t> hits_{0U};
+        std::atomic<std::uint64_t> errorHits_{0U};
+        std::atomic<std::uint64_t> misses_{0U};
+        std::atomic<std::uint64_t> computations_{0U};
+        std::atomic<std::uint64_t> coalesced_{0U};
+        std::atomic<std::uint64_t> evictions_{0U};
+    };
+
+  private:  // methods
+    Shard& shardOf(const K& key) noexcept
+    {
+        // Mix the hash, the low bits of which also select the bucket inside the shard
+        const std::uint64_t hash = static_cast<std::uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ULL;
+        return shards_[static_cast<std::size_t>(hash >> 32U) % shards_.size()];
+    }
+
+    /// @brief Find the valid entry of the key and mark it as recently used, expired entries are removed.
+    const Node* findValid(Shard& shard, const K& key)
+    {
+        auto node = shard.nodes_.find(key);
+        if (node == shard.nodes_.end())
+        {
+            stats_.misses_.fetch_add(1U, std::memory_order_relaxed);
+            return nullptr;
+        }
+        if (Clock::now() >= node->second.expiry_)
+        {
+            erase(shard, node);
+            stats_.misses_.fetch_add(1U, std::memory_order_relaxed);
+            return nullptr;
+        }
+        shard.order_.splice(shard.order_.begin(), shard.order_, node->second.recency_);
+        stats_.hits_.fetch_add(1U, std::memory_order_relaxed);
+        if (!node->second.entry_.hasValue())
+        {
+            stats_.errorHits_.fetch_add(1U, std::memory_order_relaxed);
+        }
+        return &node->second;
+    }
+
+    /// @brief Caches the entry, evicting the least recently used one of a full shard.
+    void store(Shard& shard, const K& key, Entry&& entry)
+    {
+        const Duration ttl = entry.hasValue() ? valueTtl_ : errorTtl_;
+        if (ttl <= Duration::zero())
+        {
+            return;
+        }
+        const TimePoint expiry = Clock::now() + ttl;
+        auto node = shard.nodes_.find(key);
+        if (node != shard.nodes_.end())
+        {
+            node->second.entry_ = std::move(entry);
+            node->second.expiry_ = expiry;
+            shard.order_.splice(shard.order_.begin(), shard.order_, node->second.recency_);
+            return;
+        }
+        if (shard.nodes_.size() >= shardCapacity_)
+        {
+            erase(shard, shard.nodes_.find(shard.order_.back()));
+            stats_.evictions_.fetch_add(1U, std::memory_order_relaxed);
+        }
+        shard.order_.push_front(key);
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+        try
+        {
+            shard.nodes_.emplace(key, Node{std::move(entry), expiry, shard.order_.begin()});
+        }
+        catch (...)
+        {
+            shard.order_.pop_front();  // An evicted key without its node would be erased from nodes_ again
+            throw;
+        }
+#else
+        shard.nodes_.emplace(key, Node{std::move(entry), expiry, shard.order_.begin()});
+#endif
+    }
+
+    void erase(Shard& shard, typename std::unordered_map<K, Node, Hash>::iterator node)
+    {
+        shard.order_.erase(node->second.recency_);
+        shard.nodes_.erase(node);
+    }
+
+    /// @brief Wakes the callers waiting for the computation.
+    static void complete(Shard& shard, const K& key, Flight& flight)
+    {
+        flight.completed_ = true;
+        shard.flights_.erase(key);
+        flight.done_.notify_all();
+    }
+
+  private:  // members
+    const Duration valueTtl_;         /* Time to live of the cached values. */
+    const Duration errorTtl_;         /* Time to live of the cached errors. */
+    const std::size_t shardCapacity_; /* Maximum number of entries per shard. */
+    std::vector<Shard> shards_;       /* Shards of the keys. */
+    Counters stats_;                  /* Counters of the cache. */
+};
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_RESULT_CACHE_HPP
@@ -0,0 +1,241 @@
+/**
+ * @file result_collect.hpp
+ * @brief Combination of many `Result` objects into one.
+ *
+ * `collect(r1, r2, ...)` combines independent results into a `Result` of a tuple of their values, or the first
+ * error. `collectAll(range)` combines a range of results into a `Result` of a vector of their values, allocated
+ * once, or the first error. `collectErrors` gathers all the errors into a SmallVector which does not allocate for
+ * a few errors. Every result is checked once and the values of rvalue results are moved, not copied.
+ *
+ * @note This file is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_RESULT_COLLECT_HPP
+#define INTERVIEW_LIBRARY_RESULT_COLLECT_HPP
+
+#include "lib/result.hpp"
+#include "lib/small_vector.hpp"
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+
+/// @brief Default number of errors `collectErrors` stores without allocating.
+constexpr std::size_t kCollectInlineErrors = 4U;
+
+namespace detail
+{
+
+template <typename... Rs>
+struct AllResults : std::true_type
+{
+};
+
+template <typename R, typename... Rs>
+struct AllResults<R, Rs...>
+    : std::integral_constant<bool, IsResult<std::decay_t<R>>::value && AllResults<Rs...>::value>
+{
+};
+
+template <typename E, typename... Rs>
+struct SameErrors : std::true_type
+{
+};
+
+template <typename E, typename R, typename... Rs>
+struct SameErrors<E, R, Rs...>
+    : std::integral_constant<bool, std::is_same<typename std::decay_t<R>::ErrorType, E>::value &&
+                                       SameErrors<E, Rs...>::value>
+{
+};
+
+/// @brief Result of `collect`.
+template <typename R, typename... Rs>
+using CollectedResult = Result<std::tuple<typename std::decay_t<R>::ValueType, typename std::decay_t<Rs>::ValueType...>,
+                               typename std::decay_t<R>::ErrorType>;
+
+/// @brief Returns the error of the last result, all the previous ones hold a value.
+template <typename Out, typename R>
+Out firstError(R&& result)
+{
+    return Out(inPlaceError, std::forward<R>(result).errorUnchecked());
+}
+
+/// @brief Returns the error of the first result holding one.
+template <typename Out, typename R, typename Next, typename... Rs>
+Out firstError(R&& result, Next&& next, Rs&&... rest)
+{
+    if (!result.hasValue())
+    {
+        return Out(inPlaceError, std::forward<R>(result).errorUnchecked());
+    }
+    return firstError<Out>(std::forward<Next>(next), std::forward<Rs>(rest)...);
+}
+
+/// @brief Element of the range, as an rvalue if the range is one, so its payload is moved.
+template <typename Range, typename T>
+std::conditional_t<std::is_lvalue_reference<Range>::value, T&, std::remove_reference_t<T>&&> forwardElement(
+    T& element) noexcept
+{
+    return static_cast<std::conditional_t<std::is_lvalue_reference<Range>::value, T&, std::remove_reference_t<T>&&>>(
+        element);
+}
+
+/// @brief Marks the results past the first error of an rvalue range as checked, the caller cannot check them.
+template <typename Range, typename Iterator, typename End>
+void discardRest(Iterator it, const End& end)
+{
+    if (!std::is_lvalue_reference<Range>::value)
+    {
+        for (; it != end; ++it)
+        {
+            (*it).discard();
+        }
+    }
+}
+
+/// @brief Type of the results of the range.
+template <typename Range>
+using RangeResult = std::decay_t<decltype(*std::begin(std::declval<Range&>()))>;
+
+template <typename Range, typename Vector>
+void reserveFor(Range& range, Vector& values, std::forward_iterator_tag)
+{
+    values.reserve(static_cast<std::size_t>(std::distance(std::begin(range), std::end(range))));
+}
+
+template <typename Range, typename Vector>
+void reserveFor(Range&, Vector&, std::input_iterator_tag)
+{
+}
+
+template <typename Errors, typename R>
+void appendError(Errors& errors, R&& result)
+{
+    if (!result.hasValue())
+    {
+        errors.push_back(std::forward<R>(result).errorUnchecked());
+    }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Combines independent results into a result of a tuple of their values.
+ *
+ * @code
+ * Result<std::tuple<std::uint32_t, std::string>> both = collect(divideNumbers(10U, 2U), greetName("Daniel"));
+ * @endcode
+ *
+ * @param first, rest results with the same error type and non-`void` values, rvalues are moved from.
+ * @return tuple of the values in the order of the arguments, or the error of the first failing argument.
+ */
+template <typename R, typename... Rs>
+detail::CollectedResult<R, Rs...> collect(R&& first, Rs&&... rest)
+{
+    static_assert(detail::AllResults<R, Rs...>::value, "The arguments must be Result objects");
+    static_assert(detail::SameErrors<typename std::decay_t<R>::ErrorType, Rs...>::value,
+                  "The results must have the same error type");
+    using Out = detail::CollectedResult<R, Rs...>;
+
+    bool ok = first.hasValue();
+    (void)std::initializer_list<int>{(ok = rest.hasValue() && ok, 0)...};  // Every argument is checked
+    if (!ok)
+    {
+        return detail::firstError<Out>(std::forward<R>(first), std::forward<Rs>(rest)...);
+    }
+    return Out(inPlace, std::forward<R>(first).valueUnchecked(), std::forward<Rs>(rest).valueUnchecked()...);
+}
+
+/**
+ * @brief Combines a range of results into a result of a vector of their values.
+ *
+ * The vector is allocated once for forward ranges, the values of an rvalue range are moved.
+ *
+ * @param results range of `Result<T, E>` objects with object values.
+ * @return values in the order of the range, or the error of the first failing result.
+ */
+template <typename Range>
+auto collectAll(Range&& results) -> Result<std::vector<typename detail::RangeResult<Range>::ValueType>,
+                                           typename detail::RangeResult<Range>::ErrorType>
+{
+    using R = detail::RangeResult<Range>;
+    using T = typename R::ValueType;
+    static_assert(detail::IsResult<R>::value, "The range must hold Result objects");
+    static_assert(!std::is_void<T>::value && !std::is_reference<T>::value, "The results must have object values");
+    using Out = Result<std::vector<T>, typename R::ErrorType>;
+
+    std::vector<T> values;
+    detail::reserveFor(
+        results, values,
+        typename std::iterator_traits<decltype(std::begin(results))>::iterator_category{});
+    const auto end = std::end(results);
+    for (auto it = std::begin(results); it != end; ++it)
+    {
+        auto&& result = *it;
+        if (!result.hasValue())
+        {
+            Out error(inPlaceError, detail::forwardElement<Range>(result).errorUnchecked());
+            detail::discardRest<Range>(++it, end);
+            return error;
+        }
+        values.push_back(detail::forwardElement<Range>(result).valueUnchecked());
+    }
+    return Out(inPlace, std::move(values));
+}
+
+/**
+ * @brief Gathers the errors of a range of results.
+ *
+ * @tparam N number of errors stored without allocating.
+ * @param results range of `Result<T, E>` objects, the errors of an rvalue range are moved.
+ * @return errors in the order of the range, empty if all the results hold a value.
+ */
+template <std::size_t N = kCollectInlineErrors, typename Range>
+auto collectErrors(Range&& results)
+    -> std::enable_if_t<!detail::IsResult<std::decay_t<Range>>::value,
+                        SmallVector<typename detail::RangeResult<Range>::ErrorType, N>>
+{
+    static_assert(detail::IsResult<detail::RangeResult<Range>>::value, "The range must hold Result objects");
+    SmallVector<typename detail::RangeResult<Range>::ErrorType, N> errors;
+    for (auto&& result : results)
+    {
+        detail::appendError(errors, detail::forwardElement<Range>(result));
+    }
+    return errors;
+}
+
+/**
+ * @brief Gathers the errors of independent results.
+ *
+ * @tparam N number of errors stored without allocating.
+ * @param first, rest results with the same error type, the errors of rvalues are moved.
+ * @return errors in the order of the arguments, empty if all the results hold a value.
+ */
+template <std::size_t N = kCollectInlineErrors, typename R, typename... Rs>
+auto collectErrors(R&& first, Rs&&... rest)
+    -> std::enable_if_t<detail::IsResult<std::decay_t<R>>::value, SmallVector<typename std::decay_t<R>::ErrorType, N>>
+{
+    static_assert(detail::AllResults<Rs...>::value, "The arguments must be Result objects");
+    static_assert(detail::SameErrors<typename std::decay_t<R>::ErrorType, Rs...>::value,
+                  "The results must have the same error type");
+    SmallVector<typename std::decay_t<R>::ErrorType, N> errors;
+    detail::appendError(errors, std::forward<R>(first));
+    (void)std::initializer_list<int>{(detail::appendError(errors, std::forward<Rs>(rest)), 0)...};
+    return errors;
+}
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_RESULT_COLLECT_HPP
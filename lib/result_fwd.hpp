@@ -0,0 +1,78 @@
+/**
+ * @file result_fwd.hpp
+ * @brief Declarations of the Result class, its customization points and its companion classes.
+ *
+ * Include this header instead of `result.hpp` where the types are only named: declarations of functions taking
+ * or returning `Result`, references and pointers to it, members of class templates, specializations of the
+ * traits. It pulls in `<cstdint>` only. Defining such a function, constructing or accessing a `Result` needs
+ * the definitions from `result.hpp`, the companion classes need their own headers.
+ *
+ * The default template arguments are given here, all other headers include this one.
+ *
+ * @note This file is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_RESULT_FWD_HPP
+#define INTERVIEW_LIBRARY_RESULT_FWD_HPP
+
+#include <cstdint>
+
+/**
+ * @brief Underlying type of `Status`, e.g. `std::uint8_t` for narrow columns of statuses.
+ *
+ * Changes the layout of every type holding a `Status`, so all translation units of a program must agree on it.
+ */
+#ifndef INTERVIEW_RESULT_STATUS_TYPE
+#define INTERVIEW_RESULT_STATUS_TYPE std::uint32_t
+#endif
+
+namespace interview
+{
+namespace library
+{
+
+/// @brief Default error type, defined in `result.hpp`.
+enum class Status : INTERVIEW_RESULT_STATUS_TYPE;
+
+/// @brief Value of type `T` or error of type `E`, see `result.hpp`.
+template <typename T, typename E = Status>
+class Result;
+
+/// @brief Error object creator for `createError`, see `result.hpp`.
+template <typename E = Status>
+class ErrorCreate;
+
+/// @brief Tags selecting construction of the value or of the error in place, see `result.hpp`.
+struct InPlace;
+struct InPlaceError;
+
+/// @brief Customization points of the storage and of the exception boundary, see `result.hpp`.
+template <typename E, typename = void>
+struct ResultErrorCodeTraits;
+
+template <typename T, typename = void>
+struct ResultNicheTraits;
+
+template <typename E, typename = void>
+struct ResultExceptionTraits;
+
+/// @brief Batch of results stored as a structure of arrays, see `result_vector.hpp`.
+template <typename T, typename E = Status>
+class ResultVector;
+
+/// @brief Single result handed off between threads, see `atomic_result_slot.hpp`.
+template <typename T, typename E = Status>
+class AtomicResultSlot;
+
+/// @brief Result of an asynchronous operation and its producer side, see `async_result.hpp`.
+template <typename T, typename E = Status>
+class AsyncResult;
+
+template <typename T, typename E = Status>
+class AsyncPromise;
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_RESULT_FWD_HPP
@@ -0,0 +1,524 @@
+/**
+ * @file result_parallel.hpp
+ * @brief Parallel transform and reduce of ranges with functions returning `Result`.
+ *
+ * `parallelTransform` maps a fallible function over a random access range and returns either all the values or
+ * the first error, `parallelReduce` folds the values. The range is split into tasks of `grain` elements run on a
+ * WorkStealingPool: each thread owns a contiguous block of tasks and steals half of the remaining block of another
+ * thread once its own is done. An error cancels all the tasks after the failing one, so the other threads stop
+ * early while the result stays the one of a sequential loop: the error of the first failing element. The values
+ * are written straight into the output vector, no `Result` is stored per element.
+ *
+ * @note This class is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_RESULT_PARALLEL_HPP
+#define INTERVIEW_LIBRARY_RESULT_PARALLEL_HPP
+
+#include "lib/result.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+#include <exception>
+#endif
+
+namespace interview
+{
+namespace library
+{
+
+/// @brief Default number of elements of a task of `parallelTransform` and `parallelReduce`.
+constexpr std::size_t kParallelGrain = 1024U;
+
+/**
+ * @brief Cancels the tasks of a `WorkStealingPool::parallelFor` from a given index on.
+ *
+ * Tasks with an index below the bound still run, so a body failing at a task can keep the earlier tasks, which
+ * decide the first error.
+ */
+class ParallelCancellation
+{
+  public:
+    /// @brief Cancels the task and all the following ones.
+    void cancelFrom(std::size_t task) noexcept
+    {
+        std::size_t bound = bound_.load(std::memory_order_relaxed);
+        while ((task < bound) && !bound_.compare_exchange_weak(bound, task, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    /// @brief Cancels all the tasks.
+    void cancel() noexcept { cancelFrom(0U); }
+
+    /// @brief Check if the task is cancelled.
+    bool cancelled(std::size_t task) const noexcept { return task >= bound_.load(std::memory_order_relaxed); }
+
+  private:
+    std::atomic<std::size_t> bound_{std::numeric_limits<std::size_t>::max()}; /* First cancelled task. */
+};
+
+/**
+ * @brief Thread pool running parallel loops with work stealing.
+ *
+ * The calling thread takes part in the loop, so a pool of `n` threads runs `n + 1` tasks at a time. Loops are run
+ * one at a time; a loop started while the pool runs another, from a task of any pool or from another thread, runs
+ * sequentially in its caller instead of waiting, so nested loops cannot deadlock.
+ */
+class WorkStealingPool
+{
+  public:
+    /**
+     * @brief Starts the threads.
+     *
+     * @param threads number of threads beside the calling one, zero runs all the loops sequentially.
+     */
+    explicit WorkStealingPool(std::size_t threads = defaultThreads())
+        : queues_(new Queue[threads + 1U]), slots_(threads + 1U)
+    {
+        workers_.reserve(threads);
+        for (std::size_t slot = 1U; slot <= threads; ++slot)
+        {
+            workers_.emplace_back([this, slot]() { work(slot); });
+        }
+    }
+
+    WorkStealingPool(const WorkStealingPool&) = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    ~WorkStealingPool()
+    {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (std::thread& worker : workers_)
+        {
+            worker.join();
+        }
+    }
+
+    /// @brief Get the pool shared by the calls without an explicit pool, one thread per core.
+    static WorkStealingPool& global()
+    {
+        static WorkStealingPool pool;
+        return pool;
+    }
+
+    /// @brief Get the number of tasks run at a time, the calling thread included.
+    std::size_t concurrency() const noexcept { return slots_; }
+
+    /**
+     * @brief Runs `body(task)` for every task in `[0, tasks)` and waits for all of them.
+     *
+     * An exception thrown by the body cancels the remaining tasks and is rethrown once the running ones finished.
+     *
+     * @param tasks number of tasks.
+     * @param body callable taking the index of the task.
+     * @param cancellation skips the cancelled tasks, may be cancelled by the body; `nullptr` runs all the tasks.
+     */
+    template <typename Body>
+    void parallelFor(std::size_t tasks, Body&& body, ParallelCancellation* cancellation = nullptr)
+    {
+        ParallelCancellation local;
+        ParallelCancellation* const active = (cancellation != nullptr) ? cancellation : &local;
+        if ((tasks <= 1U) || workers_.empty() || !tryClaim())
+        {
+            for (std::size_t task = 0U; (task < tasks) && !active->cancelled(task); ++task)
+            {
+                body(task);
+            }
+            return;
+        }
+
+        const LoopClaim claim(busy_);
+        for (std::size_t slot = 0U; slot < slots_; ++slot)
+        {
+            const std::lock_guard<std::mutex> lock(queues_[slot].mutex_);
+            queues_[slot].begin_ = (tasks * slot) / slots_;
+            queues_[slot].end_ = (tasks * (slot + 1U)) / slots_;
+        }
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            invoke_ = &invokeBody<std::remove_reference_t<Body>>;
+            body_ = const_cast<void*>(static_cast<const void*>(std::addressof(body)));
+            cancellation_ = active;
+            running_ = workers_.size();
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        run(0U);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this]() { return running_ == 0U; });
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+        if (exception_ != nullptr)
+        {
+            std::exception_ptr exception = exception_;
+            exception_ = nullptr;
+            std::rethrow_exception(exception);
+        }
+#endif
+    }
+
+  private:  // methods
+    /// @brief Tasks not taken yet of one thread.
+    struct Queue
+    {
+        std::mutex mutex_;       /* Guards the bounds, held only to take tasks. */
+        std::size_t begin_{0U};  /* First task, taken by the owner. */
+        std::size_t end_{0U};    /* End of the tasks, half of them taken by the thieves. */
+    };
+
+    using Invoke = void (*)(void* body, std::size_t task);
+
+    /// @brief Releases the pool claimed by `tryClaim()` once its loop finished.
+    class LoopClaim
+    {
+      public:
+        explicit LoopClaim(std::atomic<bool>& busy) noexcept : busy_(busy) {}
+        ~LoopClaim() { busy_.store(false, std::memory_order_release); }
+        LoopClaim(const LoopClaim&) = delete;
+        LoopClaim& operator=(const LoopClaim&) = delete;
+
+      private:
+        std::atomic<bool>& busy_; /* Flag of the claimed pool. */
+    };
+
+    static std::size_t defaultThreads() noexcept
+    {
+        const std::size_t cores = std::thread::hardware_concurrency();
+        return (cores > 1U) ? (cores - 1U) : 0U;
+    }
+
+    /// @brief Claims the pool for a loop without waiting, fails while it runs another one.
+    bool tryClaim() noexcept
+    {
+        bool busy = false;
+        return busy_.compare_exchange_strong(busy, true, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    template <typename Body>
+    static void invokeBody(void* body, std::size_t task)
+    {
+        (*static_cast<Body*>(body))(task);
+    }
+
+    void work(std::size_t slot)
+    {
+        std::uint64_t seen = 0U;
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (;;)
+        {
+            wake_.wait(lock, [this, seen]() { return stopping_ || (generation_ != seen); });
+            if (stopping_)
+            {
+                return;
+            }
+            seen = generation_;
+            lock.unlock();
+            run(slot);
+            lock.lock();
+            if (--running_ == 0U)
+            {
+                done_.notify_one();
+            }
+        }
+    }
+
+    /// @brief Runs the tasks of the slot, then the ones stolen from the others until none is left.
+    void run(std::size_t slot) noexcept
+    {
+        std::size_t task = 0U;
+        while (take(slot, task) || steal(slot, task))
+        {
+            if (cancellation_->cancelled(task))
+            {
+                continue;
+            }
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+            try
+            {
+                invoke_(body_, task);
+            }
+            catch (...)
+            {
+                cancellation_->cancel();
+                const std::lock_guard<std::mutex> lock(mutex_);
+                if (exception_ == nullptr)
+                {
+                    exception_ = std::current_exception();
+                }
+            }
+#else
+            invoke_(body_, task);
+#endif
+        }
+    }
+
+    bool take(std::size_t slot, std::size_t& task) noexcept
+    {
+        Queue& queue = queues_[slot];
+        const std::lock_guard<std::mutex> lock(queue.mutex_);
+        if (queue.begin_ == queue.end_)
+        {
+            return false;
+        }
+        task = queue.begin_++;
+        return true;
+    }
+
+    /// @brief Takes the upper half of the tasks of another slot, runs the first one and keeps the rest.
+    bool steal(std::size_t slot, std::size_t& task) noexcept
+    {
+        for (std::size_t offset = 1U; offset < slots_; ++offset)
+        {
+            Queue& victim = queues_[(slot + offset) % slots_];
+            std::size_t begin = 0U;
+            std::size_t end = 0U;
+            {
+                const std::lock_guard<std::mutex> lock(victim.mutex_);
+                if (victim.begin_ == victim.end_)
+                {
+                    continue;
+                }
+                begin = victim.begin_ + ((victim.end_ - victim.begin_) / 2U);
+                end = victim.end_;
+                victim.end_ = begin;
+            }
+            Queue& own = queues_[slot];
+            const std::lock_guard<std::mutex> lock(own.mutex_);
+            own.begin_ = begin + 1U;
+            own.end_ = end;
+            task = begin;
+            return true;
+        }
+        return false;
+    }
+
+  private:  // members
+    std::unique_ptr<Queue[]> queues_;              /* Tasks of the calling thread (slot 0) and of the workers. */
+    std::size_t slots_;                            /* Number of queues. */
+    std::atomic<bool> busy_{false};                /* Set while a loop runs, serializes the loops. */
+    std::mutex mutex_;                             /* Guards the loop below. */
+    std::condition_variable wake_;                 /* Notified when a loop starts or the pool stops. */
+    std::condition_variable done_;                 /* Notified when the last worker finished the loop. */
+    std::uint64_t generation_{0U};                 /* Incremented for every loop. */
+    std::size_t running_{0U};                      /* Number of workers running the loop. */
+    bool stopping_{false};                         /* Set when the pool is destructed. */
+    Invoke invoke_{nullptr};                       /* Calls the body of the loop. */
+    void* body_{nullptr};                          /* Body of the loop. */
+    ParallelCancellation* cancellation_{nullptr};  /* Cancellation of the loop. */
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+    std::exception_ptr exception_;                 /* First exception thrown by the body. */
+#endif
+    std::vector<std::thread> workers_;             /* Threads of the slots 1 and up. */
+};
+
+namespace detail
+{
+
+/// @brief Error of the first failing element, recorded by the tasks of a parallel loop.
+template <typename E>
+class FirstParallelError
+{
+  public:
+    /// @brief Keeps the error when no earlier element failed, cancels the tasks after the one of the element.
+    void record(std::size_t index, std::size_t task, E&& error, ParallelCancellation& cancellation)
+    {
+        {
+            const std::lock_guard<std::mutex> lock(mutex_);
+            if (index < index_)
+            {
+                index_ = index;
+                error_ = Result<void, E>(inPlaceError, std::move(error));
+            }
+        }
+        cancellation.cancelFrom(task + 1U);
+    }
+
+    bool failed() const noexcept { return !error_.hasValue(); }
+
+    E&& error() noexcept { return std::move(error_).errorUnchecked(); }
+
+  private:
+    std::mutex mutex_;                                             /* Guards the error, taken on failure only. */
+    std::size_t index_{std::numeric_limits<std::size_t>::max()};  /* Index of the failing element. */
+    Result<void, E> error_;                                        /* Error of the element. */
+};
+
+/// @brief Result type of the function applied to the elements of the range.
+template <typename Range, typename F>
+using ParallelResultOf =
+    std::decay_t<decltype(std::declval<F&>()(*std::begin(std::declval<const Range&>())))>;
+
+template <typename R>
+void checkParallelResult()
+{
+    static_assert(IsResult<R>::value, "The function must return a Result");
+    static_assert(!std::is_void<typename R::ValueType>::value && !std::is_reference<typename R::ValueType>::value,
+                  "The function must return object values");
+    static_assert(!std::is_same<typename R::ValueType, bool>::value,
+                  "std::vector<bool> packs its elements, so they cannot be written concurrently");
+    static_assert(std::is_default_constructible<typename R::ValueType>::value,
+                  "The output is pre-sized, so the values must be default constructible");
+}
+
+}  // namespace detail
+
+/**
+ * @brief Applies the function to every element of the range in parallel.
+ *
+ * @param pool pool running the tasks.
+ * @param inputs random access range.
+ * @param f callable taking an element and returning `Result<U, E>`, called concurrently.
+ * @param grain number of elements of a task.
+ * @return values in the order of the inputs, or the error of the first failing element (by position).
+ */
+template <typename Range, typename F>
+auto parallelTransform(WorkStealingPool& pool, const Range& inputs, F&& f, std::size_t grain = kParallelGrain)
+    -> Result<std::vector<typename detail::ParallelResultOf<Range, F>::ValueType>,
+              typename detail::ParallelResultOf<Range, F>::ErrorType>
+{
+    using R = detail::ParallelResultOf<Range, F>;
+    using U = typename R::ValueType;
+    using E = typename R::ErrorType;
+    detail::checkParallelResult<R>();
+
+    const auto first = std::begin(inputs);
+    const std::size_t count = static_cast<std::size_t>(std::distance(first, std::end(inputs)));
+    const std::size_t step = std::max<std::size_t>(grain, 1U);
+    std::vector<U> values(count);
+    detail::FirstParallelError<E> error;
+    ParallelCancellation cancellation;
+    pool.parallelFor(
+        (count + step - 1U) / step,
+        [&](std::size_t task) {
+            const std::size_t end = std::min(count, (task + 1U) * step);
+            for (std::size_t index = task * step; (index < end) && !cancellation.cancelled(task); ++index)
+            {
+                R result = f(first[static_cast<std::ptrdiff_t>(index)]);
+                if (!result.hasValue())
+                {
+                    error.record(index, task, std::move(result).errorUnchecked(), cancellation);
+                    return;
+                }
+                values[index] = std::move(result).valueUnchecked();
+            }
+        },
+        &cancellation);
+
+    if (error.failed())
+    {
+        return Result<std::vector<U>, E>(inPlaceError, error.error());
+    }
+    return Result<std::vector<U>, E>(inPlace, std::move(values));
+}
+
+/**
+ * @brief Applies the function to every element of the range in parallel, on the global pool.
+ */
+template <typename Range, typename F>
+auto parallelTransform(const Range& inputs, F&& f, std::size_t grain = kParallelGrain)
+{
+    return parallelTransform(WorkStealingPool::global(), inputs, std::forward<F>(f), grain);
+}
+
+/**
+ * @brief Applies the function to every element of the range in parallel and folds the values.
+ *
+ * Each task folds its elements starting from `identity`, the results of the tasks are then folded in the order of
+ * the tasks, so `combine` need be associative but not commutative.
+ *
+ * @param pool pool running the tasks.
+ * @param inputs random access range.
+ * @param identity identity of `combine`.
+ * @param f callable taking an element and returning `Result<T, E>`, called concurrently.
+ * @param combine callable folding two values of type `T` into one, called concurrently.
+ * @param grain number of elements of a task.
+ * @return folded value, or the error of the first failing element (by position).
+ */
+template <typename Range, typename T, typename F, typename Combine>
+auto parallelReduce(WorkStealingPool& pool,
+                    const Range& inputs,
+                    T identity,
+                    F&& f,
+                    Combine&& combine,
+                    std::size_t grain = kParallelGrain)
+    -> Result<T, typename detail::ParallelResultOf<Range, F>::ErrorType>
+{
+    using R = detail::ParallelResultOf<Range, F>;
+    using E = typename R::ErrorType;
+    detail::checkParallelResult<R>();
+    static_assert(std::is_convertible<typename R::ValueType, T>::value, "The values must be convertible to T");
+    static_assert(!std::is_same<T, bool>::value,
+                  "std::vector<bool> packs the partial folds, so they cannot be written concurrently");
+
+    const auto first = std::begin(inputs);
+    const std::size_t count = static_cast<std::size_t>(std::distance(first, std::end(inputs)));
+    const std::size_t step = std::max<std::size_t>(grain, 1U);
+    const std::size_t tasks = (count + step - 1U) / step;
+    std::vector<T> partials(tasks, identity);
+    detail::FirstParallelError<E> error;
+    ParallelCancellation cancellation;
+    pool.parallelFor(
+        tasks,
+        [&](std::size_t task) {
+            const std::size_t end = std::min(count, (task + 1U) * step);
+            T partial = identity;
+            for (std::size_t index = task * step; (index < end) && !cancellation.cancelled(task); ++index)
+            {
+                R result = f(first[static_cast<std::ptrdiff_t>(index)]);
+                if (!result.hasValue())
+                {
+                    error.record(index, task, std::move(result).errorUnchecked(), cancellation);
+                    return;
+                }
+                partial = combine(std::move(partial), std::move(result).valueUnchecked());
+            }
+            partials[task] = std::move(partial);
+        },
+        &cancellation);
+
+    if (error.failed())
+    {
+        return Result<T, E>(inPlaceError, error.error());
+    }
+    T total = std::move(identity);
+    for (T& partial : partials)
+    {
+        total = combine(std::move(total), std::move(partial));
+    }
+    return Result<T, E>(inPlace, std::move(total));
+}
+
+/**
+ * @brief Applies the function to every element of the range in parallel and folds the values, on the global pool.
+ */
+template <typename Range, typename T, typename F, typename Combine>
+auto parallelReduce(const Range& inputs, T identity, F&& f, Combine&& combine, std::size_t grain = kParallelGrain)
+{
+    return parallelReduce(WorkStealingPool::global(), inputs, std::move(identity), std::forward<F>(f),
+                          std::forward<Combine>(combine), grain);
+}
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_RESULT_PARALLEL_HPP
@@ -0,0 +1,23 @@
+/**
+ * @file result_pch.hpp
+ * @brief Prefix header of the Result library, to be precompiled.
+ *
+ * Collects `result.hpp` and the standard headers most code using it includes next to it. Precompile it with
+ * the flags of the translation units using it and include it first, e.g. with `-include lib/result_pch.hpp`,
+ * CMake `target_precompile_headers` or the precompiled header settings of the IDE. The configuration macros
+ * (`INTERVIEW_RESULT_STATUS_TYPE`, `INTERVIEW_RESULT_AUDIT`, ...) are part of the precompiled state. A
+ * translation unit with other flags falls back to parsing the headers.
+ *
+ * @note This file is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_RESULT_PCH_HPP
+#define INTERVIEW_LIBRARY_RESULT_PCH_HPP
+
+#include "lib/result.hpp"
+
+#include <string>
+#include <vector>
+
+#endif  // INTERVIEW_LIBRARY_RESULT_PCH_HPP
@@ -0,0 +1,486 @@
+/**
+ * @file result_pipeline.hpp
+ * @brief Definition of the ResultPipeline class.
+ *
+ * This file contains the definition of the ResultPipeline class, a lazy chain of fallible stages over a stream of
+ * elements:
+ *
+ * @code
+ * Result<PipelineStats> stats = fromLines(file) | stage(parse) | stage(validate, ErrorPolicy::SKIP) | sink(store);
+ * @endcode
+ *
+ * The sink pulls fixed size batches through the stages: every stage keeps one batch of its values, reused for all
+ * the batches, so the memory does not depend on the length of the stream and no `Result` is stored per element.
+ * Each stage has its own error policy: stop the pipeline, skip the element and count it, or route the error to a
+ * side channel and count it.
+ *
+ * @note This class is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_RESULT_PIPELINE_HPP
+#define INTERVIEW_LIBRARY_RESULT_PIPELINE_HPP
+
+#include "lib/result.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <istream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+
+/// @brief Default number of elements of a batch.
+constexpr std::size_t kPipelineBatch = 256U;
+
+/// @brief Handling of the errors of a stage.
+enum class ErrorPolicy : std::uint8_t
+{
+    STOP,  /* The pipeline stops and returns the error. */
+    SKIP,  /* The element is dropped and counted. */
+    ROUTE  /* The error is passed to the channel of the stage, the element is dropped and counted. */
+};
+
+/// @brief Counters of a pipeline run.
+struct PipelineStats
+{
+    std::size_t read_{0U};            /* Elements read from the source. */
+    std::size_t batches_{0U};         /* Batches read from the source. */
+    std::size_t delivered_{0U};       /* Elements passed to the sink. */
+    std::vector<std::size_t> errors_; /* Elements skipped or routed, per stage. */
+};
+
+namespace detail
+{
+
+/// @brief Elements of a range: references to the elements of forward ranges, copies from input iterators.
+template <typename Iterator, typename Reference = decltype(*std::declval<Iterator&>())>
+using RangeElement = std::conditional_t<
+    std::is_lvalue_reference<Reference>::value &&
+        std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value,
+    std::reference_wrapper<std::remove_reference_t<Reference>>, std::decay_t<Reference>>;
+
+}  // namespace detail
+
+/**
+ * @brief Source of the elements of an iterator range.
+ *
+ * A source provides `ValueType` and `std::size_t read(std::vector<ValueType>& batch, std::size_t count)` which
+ * appends at most `count` elements to the batch and returns their number, 0 at the end of the stream.
+ *
+ * The elements of forward ranges are not copied: the batches hold `std::reference_wrapper` to them, which
+ * convert to references for the first stage. Input iterators such as `std::istream_iterator` are copied.
+ */
+template <typename Iterator>
+class RangeSource
+{
+  public:
+    using ValueType = detail::RangeElement<Iterator>;
+
+    RangeSource(Iterator first, Iterator last) : first_(std::move(first)), last_(std::move(last)) {}
+
+    std::size_t read(std::vector<ValueType>& batch, std::size_t count)
+    {
+        std::size_t appended = 0U;
+        for (; (appended < count) && (first_ != last_); ++first_, ++appended)
+        {
+            batch.push_back(*first_);
+        }
+        return appended;
+    }
+
+  private:  // members
+    Iterator first_; /* Next element. */
+    Iterator last_;  /* End of the range. */
+};
+
+/// @brief Source of the lines of an input stream, without the line terminators.
+class LineSource
+{
+  public:
+    using ValueType = std::string;
+
+    explicit LineSource(std::istream& stream) noexcept : stream_(&stream) {}
+
+    std::size_t read(std::vector<std::string>& batch, std::size_t count)
+    {
+        std::size_t appended = 0U;
+        std::string line;
+        for (; (appended < count) && std::getline(*stream_, line); ++appended)
+        {
+            batch.push_back(std::move(line));
+        }
+        return appended;
+    }
+
+  private:  // members
+    std::istream* stream_; /* Stream read line by line. */
+};
+
+namespace detail
+{
+
+/// @brief Channel of the stages which do not route their errors.
+struct NoErrorChannel
+{
+    template <typename E>
+    void operator()(const E&) const noexcept
+    {
+    }
+};
+
+/// @brief State of a pipeline run shared by the stages.
+template <typename E>
+struct PipelineRun
+{
+    bool failed() const noexcept { return !result_.hasValue(); }
+
+    /// @brief Stops the run. The error of a later stage replaces an earlier one: it belongs to an earlier element.
+    void fail(E&& error) { result_ = Result<void, E>(inPlaceError, std::move(error)); }
+
+    PipelineStats stats_;
+    Result<void, E> result_;
+};
+
+}  // namespace detail
+
+/**
+ * @brief Fallible function of a pipeline with its error policy, see `stage()`.
+ *
+ * @tparam F callable taking an element and returning `Result<U, E>`.
+ * @tparam Channel callable taking `const E&`, called for the errors of the `ErrorPolicy::ROUTE` policy.
+ */
+template <typename F, typename Channel>
+struct PipelineStage
+{
+    F f_;                /* Function applied to the elements. */
+    ErrorPolicy policy_; /* Handling of the errors. */
+    Channel channel_;    /* Side channel of the errors. */
+};
+
+/// @brief Consumer of the values of a pipeline, see `sink()`.
+template <typename F>
+struct PipelineSink
+{
+    F f_; /* Function called with every value. */
+};
+
+/**
+ * @brief Head of a pipeline, reads the batches from a source.
+ *
+ * @tparam Source type of the source, see `RangeSource`.
+ */
+template <typename Source>
+class PipelineSource
+{
+  public:
+    using ValueType = typename Source::ValueType;
+    using ErrorType = void;
+
+    /// @brief Number of stages of the pipeline.
+    static constexpr std::size_t kStages = 0U;
+
+    PipelineSource(Source source, std::size_t batchSize)
+        : source_(std::move(source)), batchSize_((batchSize == 0U) ? 1U : batchSize)
+    {
+        batch_.reserve(batchSize_);
+    }
+
+    /**
+     * @brief Reads the next batch.
+     *
+     * @param run state of the run.
+     * @return batch, `nullptr` at the end of the stream or once the run failed.
+     */
+    template <typename Run>
+    std::vector<ValueType>* nextBatch(Run& run)
+    {
+        batch_.clear();
+        if (run.failed() || (source_.read(batch_, batchSize_) == 0U))
+        {
+            return nullptr;
+        }
+        run.stats_.read_ += batch_.size();
+        ++run.stats_.batches_;
+        return &batch_;
+    }
+
+  private:  // members
+    Source source_;                 /* Source of the elements. */
+    std::size_t batchSize_;         /* Maximum number of elements of a batch. */
+    std::vector<ValueType> batch_;  /* Current batch. */
+};
+
+/**
+ * @brief Pipeline ending with a fallible stage.
+ *
+ * The stage applies its function to every element of the upstream batch and keeps the values in its own batch.
+ * An error stopping the pipeline keeps the values of the elements before the failing one, so they still reach
+ * the sink and the pipeline returns the error a sequential loop over the elements would.
+ *
+ * @tparam Upstream pipeline before the stage, a `PipelineSource` or a `ResultPipeline`.
+ * @tparam F callable taking an upstream value and returning `Result<U, E>`.
+ * @tparam Channel callable taking `const E&`.
+ */
+template <typename Upstream, typename F, typename Channel>
+class ResultPipeline
+{
+    using InputType = typename Upstream::ValueType;
+    using StageResult = std::decay_t<decltype(std::declval<F&>()(std::declval<InputType&&>()))>;
+
+    static_assert(detail::IsResult<StageResult>::value, "The stage must return a Result");
+
+  public:
+    using ValueType = typename StageResult::ValueType;
+    using ErrorType = typename StageResult::ErrorType;
+
+    static_assert(!std::is_void<ValueType>::value && !std::is_reference<ValueType>::value,
+                  "The stage must return object values");
+    static_assert(std::is_void<typename Upstream::ErrorType>::value ||
+                      std::is_same<typename Upstream::ErrorType, ErrorType>::value,
+                  "The stages must have the same error type");
+
+    /// @brief Number of stages of the pipeline.
+    static constexpr std::size_t kStages = Upstream::kStages + 1U;
+
+    ResultPipeline(Upstream upstream, PipelineStage<F, Channel> stage)
+        : upstream_(std::move(upstream)), stage_(std::move(stage))
+    {
+    }
+
+    /**
+     * @brief Pulls the next non-empty batch through the stage.
+     *
+     * @param run state of the run.
+     * @return batch, `nullptr` at the end of the stream or once the run failed.
+     */
+    template <typename Run>
+    std::vector<ValueType>* nextBatch(Run& run)
+    {
+        batch_.clear();
+        while (batch_.empty())
+        {
+            std::vector<InputType>* inputs = upstream_.nextBatch(run);
+            if (inputs == nullptr)
+            {
+                return nullptr;
+            }
+            for (InputType& input : *inputs)
+            {
+                StageResult result = stage_.f_(std::move(input));
+                if (result.hasValue())
+                {
+                    batch_.push_back(std::move(result).valueUnchecked());
+                    continue;
+                }
+                if (stage_.policy_ == ErrorPolicy::STOP)
+                {
+                    run.fail(std::move(result).errorUnchecked());
+                    return batch_.empty() ? nullptr : &batch_;
+                }
+                ++run.stats_.errors_[kStages - 1U];
+                if (stage_.policy_ == ErrorPolicy::ROUTE)
+                {
+                    stage_.channel_(static_cast<const ErrorType&>(result.errorUnchecked()));
+                }
+            }
+        }
+        return &batch_;
+    }
+
+  private:  // members
+    Upstream upstream_;                /* Pipeline before the stage. */
+    PipelineStage<F, Channel> stage_;  /* Function and error policy of the stage. */
+    std::vector<ValueType> batch_;     /* Values of the current batch. */
+};
+
+namespace detail
+{
+
+/// @brief Error type of a pipeline, `Status` for a pipeline without any stage.
+template <typename Pipeline>
+using PipelineErrorOf = std::conditional_t<std::is_void<typename Pipeline::ErrorType>::value, Status,
+                                           typename Pipeline::ErrorType>;
+
+/// @brief Passes a value to a sink returning `void`.
+template <typename E, typename F, typename T>
+bool consume(F& f, T&& value, PipelineRun<E>&, std::false_type)
+{
+    f(std::forward<T>(value));
+    return true;
+}
+
+/// @brief Passes a value to a sink returning `Result<void, E>`, its error stops the pipeline.
+template <typename E, typename F, typename T>
+bool consume(F& f, T&& value, PipelineRun<E>& run, std::true_type)
+{
+    auto result = f(std::forward<T>(value));
+    if (!result.hasValue())
+    {
+        run.fail(std::move(result).errorUnchecked());
+        return false;
+    }
+    return true;
+}
+
+template <typename Pipeline, typename F>
+Result<PipelineStats, PipelineErrorOf<Pipeline>> runPipeline(Pipeline& pipeline, F& sink)
+{
+    using E = PipelineErrorOf<Pipeline>;
+    using T = typename Pipeline::ValueType;
+    using SinkResult = std::decay_t<decltype(sink(std::declval<T&&>()))>;
+    static_assert(std::is_void<SinkResult>::value || std::is_same<SinkResult, Result<void, E>>::value,
+                  "The sink must return void or Result<void, E>");
+
+    PipelineRun<E> run;
+    run.stats_.errors_.assign(Pipeline::kStages, 0U);
+    bool consuming = true;
+    while (consuming)
+    {
+        std::vector<T>* batch = pipeline.nextBatch(run);
+        if (batch == nullptr)
+        {
+            break;
+        }
+        for (T& value : *batch)
+        {
+            consuming = consume(sink, std::move(value), run, IsResult<SinkResult>{});
+            if (!consuming)
+            {
+                break;
+            }
+            ++run.stats_.delivered_;
+        }
+    }
+    if (run.failed())
+    {
+        return Result<PipelineStats, E>(inPlaceError, std::move(run.result_).errorUnchecked());
+    }
+    return Result<PipelineStats, E>(inPlace, std::move(run.stats_));
+}
+
+}  // namespace detail
+
+/**
+ * @brief Starts a pipeline reading a source.
+ *
+ * @param source source of the elements, see `RangeSource`.
+ * @param batchSize maximum number of elements of a batch.
+ */
+template <typename Source>
+PipelineSource<std::decay_t<Source>> fromSource(Source&& source, std::size_t batchSize = kPipelineBatch)
+{
+    return PipelineSource<std::decay_t<Source>>(std::forward<Source>(source), batchSize);
+}
+
+/// @brief Starts a pipeline reading the elements of an iterator range, which must outlive the run.
+template <typename Iterator>
+PipelineSource<RangeSource<Iterator>> fromRange(Iterator first, Iterator last, std::size_t batchSize = kPipelineBatch)
+{
+    return fromSource(RangeSource<Iterator>(std::move(first), std::move(last)), batchSize);
+}
+
+/// @brief Starts a pipeline reading the elements of a range, e.g. a container, which must outlive the run.
+template <typename Range>
+auto fromRange(const Range& range, std::size_t batchSize = kPipelineBatch)
+    -> PipelineSource<RangeSource<decltype(std::begin(range))>>
+{
+    return fromRange(std::begin(range), std::end(range), batchSize);
+}
+
+/// @brief Starts a pipeline reading the lines of a stream, which must outlive the run.
+inline PipelineSource<LineSource> fromLines(std::istream& stream, std::size_t batchSize = kPipelineBatch)
+{
+    return fromSource(LineSource(stream), batchSize);
+}
+
+/**
+ * @brief Creates a stage stopping or skipping on errors.
+ *
+ * @param f callable taking an element and returning `Result<U, E>`.
+ * @param policy `ErrorPolicy::STOP` or `ErrorPolicy::SKIP`, `ErrorPolicy::ROUTE` without a channel skips.
+ */
+template <typename F>
+PipelineStage<std::decay_t<F>, detail::NoErrorChannel> stage(F&& f, ErrorPolicy policy = ErrorPolicy::STOP)
+{
+    return PipelineStage<std::decay_t<F>, detail::NoErrorChannel>{
+        std::forward<F>(f), (policy == ErrorPolicy::ROUTE) ? ErrorPolicy::SKIP : policy, detail::NoErrorChannel{}};
+}
+
+/**
+ * @brief Creates a stage routing its errors to a side channel.
+ *
+ * @param f callable taking an element and returning `Result<U, E>`.
+ * @param channel callable taking `const E&`, called for every failing element.
+ */
+template <typename F, typename Channel,
+          typename = std::enable_if_t<!std::is_same<std::decay_t<Channel>, ErrorPolicy>::value>>
+PipelineStage<std::decay_t<F>, std::decay_t<Channel>> stage(F&& f, Channel&& channel)
+{
+    return PipelineStage<std::decay_t<F>, std::decay_t<Channel>>{
+        std::forward<F>(f), ErrorPolicy::ROUTE, std::forward<Channel>(channel)};
+}
+
+/**
+ * @brief Creates the sink running a pipeline.
+ *
+ * @param f callable taking a value and returning `void`, or `Result<void, E>` whose error stops the pipeline.
+ */
+template <typename F>
+PipelineSink<std::decay_t<F>> sink(F&& f)
+{
+    return PipelineSink<std::decay_t<F>>{std::forward<F>(f)};
+}
+
+/// @brief Appends a stage to the source.
+template <typename Source, typename F, typename Channel>
+ResultPipeline<PipelineSource<Source>, F, Channel> operator|(PipelineSource<Source> source,
+                                                             PipelineStage<F, Channel> stage)
+{
+    return ResultPipeline<PipelineSource<Source>, F, Channel>(std::move(source), std::move(stage));
+}
+
+/// @brief Appends a stage to the pipeline.
+template <typename Upstream, typename G, typename GChannel, typename F, typename Channel>
+ResultPipeline<ResultPipeline<Upstream, G, GChannel>, F, Channel> operator|(
+    ResultPipeline<Upstream, G, GChannel> pipeline, PipelineStage<F, Channel> stage)
+{
+    return ResultPipeline<ResultPipeline<Upstream, G, GChannel>, F, Channel>(std::move(pipeline), std::move(stage));
+}
+
+/**
+ * @brief Runs a pipeline without stages.
+ *
+ * @return counters of the run, or the error of the sink.
+ */
+template <typename Source, typename F>
+Result<PipelineStats, Status> operator|(PipelineSource<Source> source, PipelineSink<F> sink)
+{
+    return detail::runPipeline(source, sink.f_);
+}
+
+/**
+ * @brief Runs the pipeline until the end of the stream or the first error stopping it.
+ *
+ * @return counters of the run, or the error of the first element (by position) failing in a stopping stage or in
+ * the sink.
+ */
+template <typename Upstream, typename G, typename GChannel, typename F>
+Result<PipelineStats, typename ResultPipeline<Upstream, G, GChannel>::ErrorType> operator|(
+    ResultPipeline<Upstream, G, GChannel> pipeline, PipelineSink<F> sink)
+{
+    return detail::runPipeline(pipeline, sink.f_);
+}
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_RESULT_PIPELINE_HPP
@@ -0,0 +1,540 @@
+/**
+ * @file result_simd.cpp
+ * @brief Implementation of the vectorized bulk operations over batches of results.
+ *
+ * The x86 kernels are compiled with `target` attributes, so the library itself is built
+ * for the baseline architecture and the AVX2 / AVX-512 code is only executed after the
+ * CPU support was checked. NEON is part of the AArch64 baseline and does not need a check.
+ *
+ * The vector kernels of `partition` and `compressValues` store whole registers at the
+ * output cursor. The cursor never exceeds the index of the first row of the block, so
+ * the stores stay within outputs sized for all rows.
+ *
+ * @author Daniel Wieczorek
+ *
+ */
+#include "lib/result_simd.hpp"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#define INTERVIEW_RESULT_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define INTERVIEW_RESULT_SIMD_X86 0
+#endif
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define INTERVIEW_RESULT_SIMD_NEON 1
+#include <arm_neon.h>
+#else
+#define INTERVIEW_RESULT_SIMD_NEON 0
+#endif
+
+namespace interview
+{
+namespace library
+{
+namespace
+{
+
+constexpr std::size_t kBitsPerWord = 64U;
+constexpr std::uint64_t kAllValid = ~std::uint64_t{0U};
+
+/// @brief Get the index of the lowest clear bit of a word which is not `kAllValid`.
+inline std::size_t lowestClearBit(std::uint64_t word) noexcept
+{
+    return static_cast<std::size_t>(__builtin_ctzll(~word));
+}
+
+/// @brief Get the bits of `count` rows starting at `row`, `count` must not cross the word.
+inline std::uint32_t rowBits(const std::uint64_t* words, std::size_t row, std::size_t count) noexcept
+{
+    const std::uint64_t bits = words[row / kBitsPerWord] >> (row % kBitsPerWord);
+    return static_cast<std::uint32_t>(bits & ((std::uint64_t{1U} << count) - 1U));
+}
+
+// --- Scalar kernels, also process the rows left over by the vector kernels ---
+
+/// @brief Find the first word which is not `kAllValid`, starting at `first`.
+std::size_t findPartialWordScalar(const std::uint64_t* words, std::size_t first, std::size_t count) noexcept
+{
+    for (std::size_t i = first; i < count; ++i)
+    {
+        if (words[i] != kAllValid)
+        {
+            return i;
+        }
+    }
+    return count;
+}
+
+/// @brief Partition the rows `first .. size`, the cursors are advanced past the written indices.
+void partitionScalar(const std::uint64_t* words,
+                     std::size_t first,
+                     std::size_t size,
+                     std::uint32_t* ok,
+                     std::uint32_t* failed,
+                     std::size_t& okCount,
+                     std::size_t& failedCount) noexcept
+{
+    for (std::size_t row = first; row < size; ++row)
+    {
+        const std::size_t valid = rowBits(words, row, 1U);
+        ok[okCount] = static_cast<std::uint32_t>(row);
+        failed[failedCount] = static_cast<std::uint32_t>(row);
+        okCount += valid;
+        failedCount += valid ^ 1U;
+    }
+}
+
+/// @brief Compress the values of the rows `first .. size` at the `count` cursor.
+std::size_t compressScalar(const std::uint32_t* values,
+                           const std::uint64_t* words,
+                           std::size_t first,
+                           std::size_t size,
+                           std::uint32_t* out,
+                           std::size_t count) noexcept
+{
+    for (std::size_t row = first; row < size; ++row)
+    {
+        out[count] = values[row];
+        count += rowBits(words, row, 1U);
+    }
+    return count;
+}
+
+#if INTERVIEW_RESULT_SIMD_X86
+
+// --- AVX2 kernels, 8 rows per register ---
+
+/**
+ * @brief Lane permutations moving the lanes selected by an 8 bit mask to the front.
+ *
+ * Entry `m` packs the 3 bit lane indices into bytes, expanded to `_mm256_permutevar8x32_epi32`
+ * operands with `_mm256_cvtepu8_epi32`.
+ */
+struct CompressTable
+{
+    CompressTable() noexcept
+    {
+        for (std::uint32_t mask = 0U; mask < 256U; ++mask)
+        {
+            std::uint64_t lanes = 0U;
+            std::uint32_t position = 0U;
+            for (std::uint32_t lane = 0U; lane < 8U; ++lane)
+            {
+                if ((mask & (1U << lane)) != 0U)
+                {
+                    lanes |= static_cast<std::uint64_t>(lane) << (position * 8U);
+                    ++position;
+                }
+            }
+            lanes_[mask] = lanes;
+        }
+    }
+
+    std::uint64_t lanes_[256]; /* Packed lane indices per mask. */
+};
+
+const CompressTable& compressTable() noexcept
+{
+    static const CompressTable table;
+    return table;
+}
+
+__attribute__((target("avx2"))) inline __m256i compressPermutation(const CompressTable& table,
+                                                                   std::uint32_t mask) noexcept
+{
+    return _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(table.lanes_[mask])));
+}
+
+__attribute__((target("avx2"))) std::size_t findPartialWordAvx2(const std::uint64_t* words,
+                                                                 std::size_t count) noexcept
+{
+    std::size_t i = 0U;
+    for (; (i + 16U) <= count; i += 16U)
+    {
+        const __m256i* block = reinterpret_cast<const __m256i*>(words + i);
+        const __m256i low = _mm256_and_si256(_mm256_loadu_si256(block), _mm256_loadu_si256(block + 1));
+        const __m256i high = _mm256_and_si256(_mm256_loadu_si256(block + 2), _mm256_loadu_si256(block + 3));
+        const __m256i all = _mm256_and_si256(low, high);
+        if (_mm256_testc_si256(all, _mm256_set1_epi64x(-1)) == 0)
+        {
+            break;
+        }
+    }
+    return findPartialWordScalar(words, i, count);
+}
+
+__attribute__((target("avx2,popcnt"))) std::size_t partitionAvx2(const std::uint64_t* words,
+                                                                  std::size_t size,
+                                                                  std::uint32_t* ok,
+                                                                  std::uint32_t* failed) noexcept
+{
+    const CompressTable& table = compressTable();
+    const __m256i step = _mm256_set1_epi32(8);
+    __m256i indices = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    std::size_t okCount = 0U;
+    std::size_t failedCount = 0U;
+    std::size_t row = 0U;
+    for (; (row + 8U) <= size; row += 8U)
+    {
+        const std::uint32_t mask = rowBits(words, row, 8U);
+        const __m256i okIndices = _mm256_permutevar8x32_epi32(indices, compressPermutation(table, mask));
+        const __m256i failedIndices = _mm256_permutevar8x32_epi32(indices, compressPermutation(table, mask ^ 0xFFU));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(ok + okCount), okIndices);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(failed + failedCount), failedIndices);
+        const std::size_t valid = static_cast<std::size_t>(__builtin_popcount(mask));
+        okCount += valid;
+        failedCount += 8U - valid;
+        indices = _mm256_add_epi32(indices, step);
+    }
+    partitionScalar(words, row, size, ok, failed, okCount, failedCount);
+    return okCount;
+}
+
+__attribute__((target("avx2,popcnt"))) std::size_t compressAvx2(const std::uint32_t* values,
+                                                                 const std::uint64_t* words,
+                                                                 std::size_t size,
+                                                                 std::uint32_t* out) noexcept
+{
+    const CompressTable& table = compressTable();
+    std::size_t count = 0U;
+    std::size_t row = 0U;
+    for (; (row + 8U) <= size; row += 8U)
+    {
+        const std::uint32_t mask = rowBits(words, row, 8U);
+        const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + row));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + count),
+                            _mm256_permutevar8x32_epi32(block, compressPermutation(table, mask)));
+        count += static_cast<std::size_t>(__builtin_popcount(mask));
+    }
+    return compressScalar(values, words, row, size, out, count);
+}
+
+// --- AVX-512 kernels, 16 rows per register, the masked instructions also process the last rows ---
+
+__attribute__((target("avx512f"))) std::size_t findPartialWordAvx512(const std::uint64_t* words,
+                                                                     std::size_t count) noexcept
+{
+    const __m512i allValid = _mm512_set1_epi64(-1);
+    std::size_t i = 0U;
+    for (; (i + 8U) <= count; i += 8U)
+    {
+        const __mmask8 partial = _mm512_cmpneq_epu64_mask(_mm512_loadu_si512(words + i), allValid);
+        if (partial != 0U)
+        {
+            return i + static_cast<std::size_t>(__builtin_ctz(partial));
+        }
+    }
+    return findPartialWordScalar(words, i, count);
+}
+
+__attribute__((target("avx512f,popcnt"))) std::size_t partitionAvx512(const std::uint64_t* words,
+                                                                      std::size_t size,
+                                                                      std::uint32_t* ok,
+                                                                      std::uint32_t* failed) noexcept
+{
+    const __m512i step = _mm512_set1_epi32(16);
+    __m512i indices = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    std::size_t okCount = 0U;
+    std::size_t failedCount = 0U;
+    for (std::size_t row = 0U; row < size; row += 16U)
+    {
+        const std::size_t rows = ((size - row) < 16U) ? (size - row) : 16U;
+        const __mmask16 range = static_cast<__mmask16>((1U << rows) - 1U);
+        const __mmask16 mask = static_cast<__mmask16>(rowBits(words, row, rows));
+        _mm512_mask_compressstoreu_epi32(ok + okCount, mask, indices);
+        _mm512_mask_compressstoreu_epi32(failed + failedCount, static_cast<__mmask16>(~mask & range), indices);
+        const std::size_t valid = static_cast<std::size_t>(__builtin_popcount(mask));
+        okCount += valid;
+        failedCount += rows - valid;
+        indices = _mm512_add_epi32(indices, step);
+    }
+    return okCount;
+}
+
+__attribute__((target("avx512f,popcnt"))) std::size_t compressAvx512(const std::uint32_t* values,
+                                                                      const std::uint64_t* words,
+                                                                      std::size_t size,
+                                                                      std::uint32_t* out) noexcept
+{
+    std::size_t count = 0U;
+    for (std::size_t row = 0U; row < size; row += 16U)
+    {
+        const std::size_t rows = ((size - row) < 16U) ? (size - row) : 16U;
+        const __mmask16 mask = static_cast<__mmask16>(rowBits(words, row, rows));
+        const __m512i block = _mm512_maskz_loadu_epi32(mask, values + row);
+        _mm512_mask_compressstoreu_epi32(out + count, mask, block);
+        count += static_cast<std::size_t>(__builtin_popcount(mask));
+    }
+    return count;
+}
+
+#endif  // INTERVIEW_RESULT_SIMD_X86
+
+#if INTERVIEW_RESULT_SIMD_NEON
+
+// --- NEON kernels, 4 rows per register ---
+
+/**
+ * @brief Byte shuffles moving the lanes selected by a 4 bit mask to the front, for `vqtbl1q_u8`.
+ */
+struct CompressTable
+{
+    CompressTable() noexcept
+    {
+        for (std::uint32_t mask = 0U; mask < 16U; ++mask)
+        {
+            std::uint32_t position = 0U;
+            for (std::uint32_t i = 0U; i < 16U; ++i)
+            {
+                bytes_[mask][i] = 0xFFU;  // Out of range indices select zero
+            }
+            for (std::uint32_t lane = 0U; lane < 4U; ++lane)
+            {
+                if ((mask & (1U << lane)) != 0U)
+                {
+                    for (std::uint32_t byte = 0U; byte < 4U; ++byte)
+                    {
+                        bytes_[mask][(position * 4U) + byte] = static_cast<std::uint8_t>((lane * 4U) + byte);
+                    }
+                    ++position;
+                }
+            }
+        }
+    }
+
+    std::uint8_t bytes_[16][16]; /* Byte indices per mask. */
+};
+
+const CompressTable& compressTable() noexcept
+{
+    static const CompressTable table;
+    return table;
+}
+
+inline uint32x4_t compressLanes(const CompressTable& table, uint32x4_t lanes, std::uint32_t mask) noexcept
+{
+    return vreinterpretq_u32_u8(vqtbl1q_u8(vreinterpretq_u8_u32(lanes), vld1q_u8(table.bytes_[mask])));
+}
+
+std::size_t findPartialWordNeon(const std::uint64_t* words, std::size_t count) noexcept
+{
+    std::size_t i = 0U;
+    for (; (i + 8U) <= count; i += 8U)
+    {
+        const uint64x2_t all = vandq_u64(vandq_u64(vld1q_u64(words + i), vld1q_u64(words + i + 2U)),
+                                         vandq_u64(vld1q_u64(words + i + 4U), vld1q_u64(words + i + 6U)));
+        if (vminvq_u32(vreinterpretq_u32_u64(all)) != 0xFFFFFFFFU)
+        {
+            break;
+        }
+    }
+    return findPartialWordScalar(words, i, count);
+}
+
+std::size_t partitionNeon(const std::uint64_t* words,
+                          std::size_t size,
+                          std::uint32_t* ok,
+                          std::uint32_t* failed) noexcept
+{
+    const CompressTable& table = compressTable();
+    const std::uint32_t first[4] = {0U, 1U, 2U, 3U};
+    uint32x4_t indices = vld1q_u32(first);
+    std::size_t okCount = 0U;
+    std::size_t failedCount = 0U;
+    std::size_t row = 0U;
+    for (; (row + 4U) <= size; row += 4U)
+    {
+        const std::uint32_t mask = rowBits(words, row, 4U);
+        vst1q_u32(ok + okCount, compressLanes(table, indices, mask));
+        vst1q_u32(failed + failedCount, compressLanes(table, indices, mask ^ 0xFU));
+        const std::size_t valid = static_cast<std::size_t>(__builtin_popcount(mask));
+        okCount += valid;
+        failedCount += 4U - valid;
+        indices = vaddq_u32(indices, vdupq_n_u32(4U));
+    }
+    partitionScalar(words, row, size, ok, failed, okCount, failedCount);
+    return okCount;
+}
+
+std::size_t compressNeon(const std::uint32_t* values,
+                         const std::uint64_t* words,
+                         std::size_t size,
+                         std::uint32_t* out) noexcept
+{
+    const CompressTable& table = compressTable();
+    std::size_t count = 0U;
+    std::size_t row = 0U;
+    for (; (row + 4U) <= size; row += 4U)
+    {
+        const std::uint32_t mask = rowBits(words, row, 4U);
+        vst1q_u32(out + count, compressLanes(table, vld1q_u32(values + row), mask));
+        count += static_cast<std::size_t>(__builtin_popcount(mask));
+    }
+    return compressScalar(values, words, row, size, out, count);
+}
+
+#endif  // INTERVIEW_RESULT_SIMD_NEON
+
+SimdLevel detectSimdLevel() noexcept
+{
+#if INTERVIEW_RESULT_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return SimdLevel::AVX512;
+    }
+    if (__builtin_cpu_supports("avx2"))
+    {
+        return SimdLevel::AVX2;
+    }
+#elif INTERVIEW_RESULT_SIMD_NEON
+    return SimdLevel::NEON;
+#endif
+    return SimdLevel::SCALAR;
+}
+
+/// @brief Replace the levels not supported by the CPU with the scalar fallback.
+SimdLevel usableLevel(SimdLevel level) noexcept
+{
+    return isSimdLevelSupported(level) ? level : SimdLevel::SCALAR;
+}
+
+/// @brief Find the first word which is not `kAllValid` of the `count` full words.
+std::size_t findPartialWord(const std::uint64_t* words, std::size_t count, SimdLevel level) noexcept
+{
+    switch (usableLevel(level))
+    {
+#if INTERVIEW_RESULT_SIMD_X86
+        case SimdLevel::AVX512:
+            return findPartialWordAvx512(words, count);
+        case SimdLevel::AVX2:
+            return findPartialWordAvx2(words, count);
+#endif
+#if INTERVIEW_RESULT_SIMD_NEON
+        case SimdLevel::NEON:
+            return findPartialWordNeon(words, count);
+#endif
+        default:
+            return findPartialWordScalar(words, 0U, count);
+    }
+}
+
+}  // namespace
+
+SimdLevel bestSimdLevel() noexcept
+{
+    static const SimdLevel level = detectSimdLevel();
+    return level;
+}
+
+bool isSimdLevelSupported(SimdLevel level) noexcept
+{
+    switch (level)
+    {
+        case SimdLevel::SCALAR:
+            return true;
+        case SimdLevel::NEON:
+            return bestSimdLevel() == SimdLevel::NEON;
+        case SimdLevel::AVX2:
+            return (bestSimdLevel() == SimdLevel::AVX2) || (bestSimdLevel() == SimdLevel::AVX512);
+        case SimdLevel::AVX512:
+            return bestSimdLevel() == SimdLevel::AVX512;
+    }
+    return false;
+}
+
+const char* simdLevelName(SimdLevel level) noexcept
+{
+    switch (level)
+    {
+        case SimdLevel::SCALAR:
+            return "scalar";
+        case SimdLevel::NEON:
+            return "neon";
+        case SimdLevel::AVX2:
+            return "avx2";
+        case SimdLevel::AVX512:
+            return "avx512";
+    }
+    return "unknown";
+}
+
+bool anyError(Span<const std::uint64_t> validity, std::size_t size, SimdLevel level) noexcept
+{
+    return firstError(validity, size, level) != size;
+}
+
+std::size_t firstError(Span<const std::uint64_t> validity, std::size_t size, SimdLevel level) noexcept
+{
+    const std::size_t fullWords = size / kBitsPerWord;
+    const std::size_t word = findPartialWord(validity.data(), fullWords, level);
+    if (word != fullWords)
+    {
+        return (word * kBitsPerWord) + lowestClearBit(validity[word]);
+    }
+    const std::size_t lastRows = size % kBitsPerWord;
+    if (lastRows != 0U)
+    {
+        const std::uint64_t lastMask = (std::uint64_t{1U} << lastRows) - 1U;
+        if ((validity[fullWords] & lastMask) != lastMask)
+        {
+            return (fullWords * kBitsPerWord) + lowestClearBit(validity[fullWords]);
+        }
+    }
+    return size;
+}
+
+std::size_t partition(Span<const std::uint64_t> validity,
+                      std::size_t size,
+                      std::uint32_t* ok,
+                      std::uint32_t* failed,
+                      SimdLevel level) noexcept
+{
+    switch (usableLevel(level))
+    {
+#if INTERVIEW_RESULT_SIMD_X86
+        case SimdLevel::AVX512:
+            return partitionAvx512(validity.data(), size, ok, failed);
+        case SimdLevel::AVX2:
+            return partitionAvx2(validity.data(), size, ok, failed);
+#endif
+#if INTERVIEW_RESULT_SIMD_NEON
+        case SimdLevel::NEON:
+            return partitionNeon(validity.data(), size, ok, failed);
+#endif
+        default:
+        {
+            std::size_t okCount = 0U;
+            std::size_t failedCount = 0U;
+            partitionScalar(validity.data(), 0U, size, ok, failed, okCount, failedCount);
+            return okCount;
+        }
+    }
+}
+
+std::size_t compressValues(Span<const std::uint32_t> values,
+                           Span<const std::uint64_t> validity,
+                           std::uint32_t* out,
+                           SimdLevel level) noexcept
+{
+    switch (usableLevel(level))
+    {
+#if INTERVIEW_RESULT_SIMD_X86
+        case SimdLevel::AVX512:
+            return compressAvx512(values.data(), validity.data(), values.size(), out);
+        case SimdLevel::AVX2:
+            return compressAvx2(values.data(), validity.data(), values.size(), out);
+#endif
+#if INTERVIEW_RESULT_SIMD_NEON
+        case SimdLevel::NEON:
+            return compressNeon(values.data(), validity.data(), values.size(), out);
+#endif
+        default:
+            return compressScalar(values.data(), validity.data(), 0U, values.size(), out, 0U);
+    }
+}
+
+}  // namespace library
+}  // namespace interview
@@ -0,0 +1,203 @@
+/**
+ * @file result_simd.hpp
+ * @brief Vectorized bulk operations over batches of results.
+ *
+ * This file contains the declaration of the kernels operating on the validity bitmap
+ * and the dense values of a `ResultVector`: `anyError`, `firstError`, `partition` and
+ * `compressValues`. Each kernel has an AVX2, AVX-512 and NEON implementation next to
+ * the scalar fallback. The best implementation supported by the CPU is selected at
+ * runtime, a specific one can be requested (e.g. to compare them) with `SimdLevel`.
+ *
+ * The kernels take the validity bitmap as a `Span`, so they can run on a word aligned
+ * block of a larger batch, e.g. `validity().subspan(block * 1024U, 1024U)` for the
+ * 64K rows of `block`. Row indices are 32 bit, a view is limited to 2^32 rows.
+ *
+ * @note This file is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_RESULT_SIMD_HPP
+#define INTERVIEW_LIBRARY_RESULT_SIMD_HPP
+
+#include "lib/result_vector.hpp"
+#include "lib/span.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+
+/**
+ * @brief Instruction set used by the kernels.
+ */
+enum class SimdLevel : std::uint8_t
+{
+    SCALAR = 0,
+    NEON,
+    AVX2,
+    AVX512
+};
+
+/**
+ * @brief Get the best instruction set supported by the CPU, detected once.
+ */
+SimdLevel bestSimdLevel() noexcept;
+
+/**
+ * @brief Check if the kernels can use the instruction set on this CPU.
+ *
+ * Unsupported levels passed to the kernels fall back to `SimdLevel::SCALAR`.
+ */
+bool isSimdLevelSupported(SimdLevel level) noexcept;
+
+/**
+ * @brief Get the name of the instruction set.
+ */
+const char* simdLevelName(SimdLevel level) noexcept;
+
+/**
+ * @brief Check if any of the rows holds an error.
+ *
+ * @param validity validity bitmap, bit `i % 64` of word `i / 64` is set if row `i` holds a value.
+ * @param size number of rows described by the bitmap.
+ * @param level instruction set to use.
+ * @return `true` if the bit of any row is clear, `false` otherwise.
+ */
+bool anyError(Span<const std::uint64_t> validity, std::size_t size, SimdLevel level = bestSimdLevel()) noexcept;
+
+/**
+ * @brief Find the first row holding an error.
+ *
+ * @param validity validity bitmap.
+ * @param size number of rows described by the bitmap.
+ * @param level instruction set to use.
+ * @return index of the first row holding an error, `size` if all rows hold a value.
+ */
+std::size_t firstError(Span<const std::uint64_t> validity,
+                       std::size_t size,
+                       SimdLevel level = bestSimdLevel()) noexcept;
+
+/**
+ * @brief Split the row indices into the rows holding a value and the rows holding an error.
+ *
+ * The vector implementations store whole registers, so both outputs must have room for
+ * `size` indices, not only for the indices written.
+ *
+ * @param validity validity bitmap.
+ * @param size number of rows described by the bitmap.
+ * @param ok output of the indices of the rows holding a value, in ascending order.
+ * @param failed output of the indices of the rows holding an error, in ascending order.
+ * @param level instruction set to use.
+ * @return number of indices written to `ok`, `size` minus it were written to `failed`.
+ */
+std::size_t partition(Span<const std::uint64_t> validity,
+                      std::size_t size,
+                      std::uint32_t* ok,
+                      std::uint32_t* failed,
+                      SimdLevel level = bestSimdLevel()) noexcept;
+
+/**
+ * @brief Copy the values of the rows holding a value to a contiguous output (stream compaction).
+ *
+ * @param values one value per row.
+ * @param validity validity bitmap describing `values.size()` rows.
+ * @param out output with room for `values.size()` values.
+ * @param level instruction set to use.
+ * @return number of values written to `out`.
+ */
+std::size_t compressValues(Span<const std::uint32_t> values,
+                           Span<const std::uint64_t> validity,
+                           std::uint32_t* out,
+                           SimdLevel level = bestSimdLevel()) noexcept;
+
+namespace detail
+{
+
+/// @brief The vector kernel handles 32 bit integers, accessed as `std::uint32_t`.
+template <typename T>
+using IsCompressible = std::integral_constant<bool,
+                                              std::is_same<T, std::uint32_t>::value ||
+                                                  std::is_same<T, std::int32_t>::value>;
+
+template <typename T, typename E, std::enable_if_t<IsCompressible<T>::value, int> = 0>
+std::size_t compressValuesOf(const ResultVector<T, E>& results, T* out, SimdLevel level) noexcept
+{
+    const Span<const T> values = results.values();
+    const Span<const std::uint32_t> words(reinterpret_cast<const std::uint32_t*>(values.data()), values.size());
+    return compressValues(words, results.validity(), reinterpret_cast<std::uint32_t*>(out), level);
+}
+
+template <typename T, typename E, std::enable_if_t<!IsCompressible<T>::value, int> = 0>
+std::size_t compressValuesOf(const ResultVector<T, E>& results, T* out, SimdLevel /* level */)
+{
+    std::size_t count = 0U;
+    for (std::size_t i = 0U; i < results.size(); ++i)
+    {
+        if (results.isOk(i))
+        {
+            out[count++] = results.valueAt(i);
+        }
+    }
+    return count;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Find the first element of the batch holding an error.
+ *
+ * @return index of the element, `results.size()` if all elements hold a value.
+ */
+template <typename T, typename E>
+std::size_t firstError(const ResultVector<T, E>& results, SimdLevel level = bestSimdLevel()) noexcept
+{
+    return firstError(results.validity(), results.size(), level);
+}
+
+/**
+ * @brief Split the element indices of the batch into the elements holding a value and an error.
+ *
+ * @param results batch to split.
+ * @param ok replaced with the indices of the elements holding a value.
+ * @param failed replaced with the indices of the elements holding an error.
+ * @param level instruction set to use.
+ */
+template <typename T, typename E>
+void partition(const ResultVector<T, E>& results,
+               std::vector<std::uint32_t>& ok,
+               std::vector<std::uint32_t>& failed,
+               SimdLevel level = bestSimdLevel())
+{
+    ok.resize(results.size());
+    failed.resize(results.size());
+    const std::size_t okCount = partition(results.validity(), results.size(), ok.data(), failed.data(), level);
+    ok.resize(okCount);
+    failed.resize(results.size() - okCount);
+}
+
+/**
+ * @brief Get the values of the elements of the batch holding a value.
+ *
+ * 32 bit integer values are compressed by the vector kernels, other types are copied
+ * by a scalar loop.
+ *
+ * @param results batch to compress.
+ * @param out replaced with the values, in the order of the elements.
+ * @param level instruction set to use.
+ */
+template <typename T, typename E>
+void compressValues(const ResultVector<T, E>& results, std::vector<T>& out, SimdLevel level = bestSimdLevel())
+{
+    out.resize(results.size());
+    out.resize(detail::compressValuesOf(results, out.data(), level));
+}
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_RESULT_SIMD_HPP
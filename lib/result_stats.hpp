@@ -0,0 +1,182 @@
+/**
+ * @file result_stats.hpp
+ * @brief Snapshots of the errors counted per `createError()` call site.
+ *
+ * This file contains the API reading the per call site error counters. The counters are only
+ * maintained when the code is built with `INTERVIEW_RESULT_STATS=1` (Bazel: `--define result_stats=1`):
+ * `createError()` then captures its source location and counts the error code in lock-free counters
+ * of the calling thread. Without it `createError()` is unchanged and the snapshots are empty, so the
+ * code taking them compiles in both modes.
+ *
+ * The histogram of a call site is indexed by the value of the error code, the names printed are the
+ * ones of `Status`. The last bucket collects the higher codes and the errors which are not enumerations.
+ *
+ * @note This file is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_RESULT_STATS_HPP
+#define INTERVIEW_LIBRARY_RESULT_STATS_HPP
+
+#include "lib/result.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+
+/// @brief Number of buckets of the histogram of a call site.
+constexpr std::size_t kResultStatsCodeCount = 8U;
+
+/**
+ * @brief Errors created by one call site, summed over all threads.
+ */
+struct ResultCallSiteStats
+{
+    const char* file_;                            /* Source file. */
+    const char* function_;                        /* Enclosing function. */
+    std::uint32_t line_;                          /* Source line. */
+    std::uint64_t counts_[kResultStatsCodeCount]; /* Number of errors per code. */
+    std::uint64_t total_;                         /* Number of errors of all codes. */
+};
+
+/**
+ * @brief Errors counted at the time of the snapshot.
+ */
+struct ResultStatsSnapshot
+{
+    std::vector<ResultCallSiteStats> callSites_; /* Call sites ordered by the number of errors, highest first. */
+    std::uint64_t dropped_{0U};                  /* Errors of call sites exceeding the per thread capacity. */
+
+    /**
+     * @brief Find the statistics of the call site.
+     *
+     * @param file source file, compared by content.
+     * @param line source line.
+     * @return statistics of the call site, `nullptr` if no error was counted for it.
+     */
+    const ResultCallSiteStats* find(const char* file, std::uint32_t line) const noexcept
+    {
+        for (const ResultCallSiteStats& callSite : callSites_)
+        {
+            if ((callSite.line_ == line) && (std::strcmp(callSite.file_, file) == 0))
+            {
+                return &callSite;
+            }
+        }
+        return nullptr;
+    }
+};
+
+/// @brief Check if the build counts the errors per call site.
+constexpr bool resultStatsEnabled() noexcept
+{
+    return INTERVIEW_RESULT_STATS != 0;
+}
+
+/**
+ * @brief Takes a snapshot of the counters of all threads, including the exited ones.
+ *
+ * The counters are read while the threads update them, so the snapshot is consistent per counter only.
+ *
+ * @return errors per call site, empty when the build does not count them.
+ */
+inline ResultStatsSnapshot takeResultStatsSnapshot()
+{
+    ResultStatsSnapshot snapshot;
+#if INTERVIEW_RESULT_STATS
+    static_assert(kResultStatsCodeCount == detail::kStatsCodeCount, "Histogram size must match the counters");
+    for (const detail::ThreadStats* stats = detail::threadStatsList().load(std::memory_order_acquire);
+         stats != nullptr; stats = stats->next_)
+    {
+        snapshot.dropped_ += stats->dropped_.load(std::memory_order_relaxed);
+        for (const detail::StatsSlot& slot : stats->slots_)
+        {
+            const char* file = slot.file_.load(std::memory_order_acquire);
+            if (file == nullptr)
+            {
+                continue;
+            }
+            // The same location is counted by each thread, and by each copy of the file name literal
+            const std::uint32_t line = slot.line_;
+            auto callSite = std::find_if(snapshot.callSites_.begin(), snapshot.callSites_.end(),
+                                         [file, line](const ResultCallSiteStats& known) {
+                                             return (known.line_ == line) && (std::strcmp(known.file_, file) == 0);
+                                         });
+            if (callSite == snapshot.callSites_.end())
+            {
+                snapshot.callSites_.push_back(ResultCallSiteStats{file, slot.function_, line, {}, 0U});
+                callSite = snapshot.callSites_.end() - 1;
+            }
+            for (std::size_t code = 0U; code < kResultStatsCodeCount; ++code)
+            {
+                const std::uint64_t count = slot.counts_[code].load(std::memory_order_relaxed);
+                callSite->counts_[code] += count;
+                callSite->total_ += count;
+            }
+        }
+    }
+    std::stable_sort(snapshot.callSites_.begin(), snapshot.callSites_.end(),
+                     [](const ResultCallSiteStats& a, const ResultCallSiteStats& b) { return a.total_ > b.total_; });
+#endif
+    return snapshot;
+}
+
+/**
+ * @brief Prints the histogram of the error codes per call site.
+ *
+ * One line per call site: `file:line function total=N OK=N INVALID_ARG=N ...`, zero counts are omitted.
+ *
+ * @param out stream to print to.
+ * @param snapshot counters to print.
+ */
+inline void dumpResultStats(std::ostream& out, const ResultStatsSnapshot& snapshot)
+{
+    for (const ResultCallSiteStats& callSite : snapshot.callSites_)
+    {
+        out << callSite.file_ << ':' << callSite.line_ << ' ' << callSite.function_ << " total=" << callSite.total_;
+        for (std::size_t code = 0U; code < kResultStatsCodeCount; ++code)
+        {
+            if (callSite.counts_[code] == 0U)
+            {
+                continue;
+            }
+            if (code == (kResultStatsCodeCount - 1U))
+            {
+                out << " OTHER=";
+            }
+            else if (code <= static_cast<std::size_t>(Status::ERROR))
+            {
+                out << ' ' << toString(static_cast<Status>(code)) << '=';
+            }
+            else
+            {
+                out << " CODE_" << code << '=';
+            }
+            out << callSite.counts_[code];
+        }
+        out << '\n';
+    }
+    if (snapshot.dropped_ != 0U)
+    {
+        out << "dropped=" << snapshot.dropped_ << '\n';
+    }
+}
+
+/// @brief Prints the current counters, see `dumpResultStats(std::ostream&, const ResultStatsSnapshot&)`.
+inline void dumpResultStats(std::ostream& out)
+{
+    dumpResultStats(out, takeResultStatsSnapshot());
+}
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_RESULT_STATS_HPP
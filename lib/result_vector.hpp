@@ -0,0 +1,354 @@
+/**
+ * @file result_vector.hpp
+ * @brief Definition of the ResultVector class.
+ *
+ * This file contains the definition of the ResultVector class, a batch container of
+ * `Result` objects stored as a structure of arrays: a dense array of values, a packed
+ * validity bitmap and a sparse list of the errors ordered by index. Compared to
+ * `std::vector<Result<T, E>>` there is no per element discriminant nor padding, the
+ * values are contiguous and the bulk queries (`allOk()`, `countErrors()`) are O(1).
+ *
+ * @note This class is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_RESULT_VECTOR_HPP
+#define INTERVIEW_LIBRARY_RESULT_VECTOR_HPP
+
+#include "lib/result.hpp"
+#include "lib/span.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+
+/**
+ * @brief Batch container of `Result<T, E>` objects with structure of arrays layout.
+ *
+ * Element `i` holds a value if bit `i % 64` of the validity word `i / 64` is set.
+ * Error elements keep a default constructed placeholder in the value array, so
+ * `values()` always spans one object per element and can be processed without
+ * branching on the validity. Errors are expected to be rare: they are stored in a
+ * separate list which is empty (and does not allocate) when all elements are values.
+ *
+ * @tparam T type of the values, must be default constructible and not `bool`.
+ * @tparam E type of the errors.
+ */
+template <typename T, typename E>
+class ResultVector
+{
+    static_assert(std::is_default_constructible<T>::value, "Value type must be default constructible");
+    static_assert(!std::is_same<T, bool>::value, "std::vector<bool> has no data() to view the values");
+
+  public:
+    using ValueType = T;
+    using ErrorType = E;
+
+    /// @brief Number of elements described by one validity word.
+    static constexpr std::size_t kBitsPerWord = 64U;
+
+    /// @brief Error of the element at `index_`.
+    struct ErrorEntry
+    {
+        std::size_t index_; /* Index of the element. */
+        E error_;           /* Error of the element. */
+    };
+
+    /**
+     * @brief Forward iterator over the elements, yields them as `Result<T, E>` objects.
+     *
+     * The iterator walks the error list together with the values, so a full iteration
+     * does not search for the errors.
+     */
+    class ConstIterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Result<T, E>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = Result<T, E>;
+
+        ConstIterator() noexcept : owner_(nullptr), index_(0U), error_(0U) {}
+
+        Result<T, E> operator*() const
+        {
+            if (owner_->isOk(index_))
+            {
+                return Result<T, E>(owner_->values_[index_]);
+            }
+            return Result<T, E>(owner_->errors_[error_].error_);
+        }
+
+        ConstIterator& operator++() noexcept
+        {
+            if (!owner_->isOk(index_))
+            {
+                ++error_;
+            }
+            ++index_;
+            return *this;
+        }
+
+        ConstIterator operator++(int) noexcept
+        {
+            ConstIterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        /// @brief Get the index of the element the iterator points to.
+        std::size_t index() const noexcept { return index_; }
+
+        bool operator==(const ConstIterator& other) const noexcept { return index_ == other.index_; }
+        bool operator!=(const ConstIterator& other) const noexcept { return index_ != other.index_; }
+
+      private:
+        friend class ResultVector;
+
+        ConstIterator(const ResultVector* owner, std::size_t index, std::size_t error) noexcept
+            : owner_(owner), index_(index), error_(error)
+        {
+        }
+
+        const ResultVector* owner_; /* Iterated container. */
+        std::size_t index_;         /* Index of the element. */
+        std::size_t error_;         /* Position of the next error in the error list. */
+    };
+
+    using const_iterator = ConstIterator;
+
+    /// @brief Constructs an empty container.
+    ResultVector() = default;
+
+    /**
+     * @brief Reserves storage for the values and the validity bitmap.
+     *
+     * @param capacity number of elements to reserve for.
+     */
+    void reserve(std::size_t capacity)
+    {
+        values_.reserve(capacity);
+        validity_.reserve((capacity + kBitsPerWord - 1U) / kBitsPerWord);
+    }
+
+    /// @brief Removes all elements.
+    void clear() noexcept
+    {
+        values_.clear();
+        validity_.clear();
+        errors_.clear();
+    }
+
+    /**
+     * @brief Appends a value.
+     *
+     * @param value value to append.
+     */
+    void pushValue(const T& value)
+    {
+        reserveValidity();
+        values_.push_back(value);
+        markLast(true);
+    }
+
+    /// @copydoc pushValue(const T&)
+    void pushValue(T&& value)
+    {
+        reserveValidity();
+        values_.push_back(std::move(value));
+        markLast(true);
+    }
+
+    /**
+     * @brief Appends an error.
+     *
+     * @param error error to append.
+     */
+    void pushError(const E& error) { appendError(error); }
+
+    /// @copydoc pushError(const E&)
+    void pushError(E&& error) { appendError(std::move(error)); }
+
+    /**
+     * @brief Appends the value or the error held by the result.
+     *
+     * @param result result to append.
+     */
+    void pushBack(const Result<T, E>& result)
+    {
+        if (result.hasValue())
+        {
+            pushValue(result.valueUnchecked());
+        }
+        else
+        {
+            pushError(result.errorUnchecked());
+        }
+    }
+
+    /// @copydoc pushBack(const Result<T, E>&)
+    void pushBack(Result<T, E>&& result)
+    {
+        if (result.hasValue())
+        {
+            pushValue(std::move(result).valueUnchecked());
+        }
+        else
+        {
+            pushError(std::move(result).errorUnchecked());
+        }
+    }
+
+    /// @brief Get the number of elements.
+    std::size_t size() const noexcept { return values_.size(); }
+
+    /// @brief Check if the container has no elements.
+    bool empty() const noexcept { return values_.empty(); }
+
+    /// @brief Check if no element holds an error.
+    bool allOk() const noexcept { return errors_.empty(); }
+
+    /// @brief Get the number of elements holding an error.
+    std::size_t countErrors() const noexcept { return errors_.size(); }
+
+    /**
+     * @brief Check if the element holds a value.
+     *
+     * @param index index of the element, must be lower than `size()`.
+     * @return `true` if the element holds a value, `false` otherwise.
+     */
+    bool isOk(std::size_t index) const noexcept
+    {
+        return ((validity_[index / kBitsPerWord] >> (index % kBitsPerWord)) & 1U) != 0U;
+    }
+
+    /**
+     * @brief Get the element as a result.
+     *
+     * @param index index of the element, must be lower than `size()`.
+     * @return copy of the value or of the error of the element.
+     */
+    Result<T, E> operator[](std::size_t index) const
+    {
+        if (isOk(index))
+        {
+            return Result<T, E>(values_[index]);
+        }
+        return Result<T, E>(errorAt(index));
+    }
+
+    /**
+     * @brief Get the value of the element without checking it holds one.
+     *
+     * @param index index of the element, must be lower than `size()`.
+     * @return the value, or the default constructed placeholder for error elements.
+     */
+    const T& valueAt(std::size_t index) const noexcept { return values_[index]; }
+
+    /**
+     * @brief Get the error of the element.
+     *
+     * The error list is searched in O(log(countErrors())).
+     *
+     * @param index index of an element holding an error.
+     * @return the error.
+     */
+    const E& errorAt(std::size_t index) const noexcept
+    {
+        auto entry = std::lower_bound(errors_.begin(), errors_.end(), index,
+                                      [](const ErrorEntry& e, std::size_t i) { return e.index_ < i; });
+        return entry->error_;
+    }
+
+    /**
+     * @brief Get the dense view of the values.
+     *
+     * @return one object per element, placeholders for the error elements.
+     */
+    Span<const T> values() const noexcept { return Span<const T>(values_.data(), values_.size()); }
+
+    /**
+     * @brief Get the packed validity bitmap.
+     *
+     * @return `(size() + 63) / 64` words, bit `i % 64` of word `i / 64` is set if element `i` holds a value.
+     *         Bits past `size()` are zero.
+     */
+    Span<const std::uint64_t> validity() const noexcept
+    {
+        return Span<const std::uint64_t>(validity_.data(), validity_.size());
+    }
+
+    /// @brief Get the errors ordered by the element index.
+    Span<const ErrorEntry> errors() const noexcept { return Span<const ErrorEntry>(errors_.data(), errors_.size()); }
+
+    ConstIterator begin() const noexcept { return ConstIterator(this, 0U, 0U); }
+    ConstIterator end() const noexcept { return ConstIterator(this, values_.size(), errors_.size()); }
+
+  private:  // methods
+    /**
+     * @brief Appends a placeholder value and the error entry of an error element.
+     *
+     * The placeholder is removed again when the entry cannot be appended, so the arrays describe the same
+     * elements on every exit.
+     */
+    template <typename Error>
+    void appendError(Error&& error)
+    {
+        reserveValidity();
+        values_.emplace_back();
+#if INTERVIEW_RESULT_HAS_EXCEPTIONS
+        try
+        {
+            errors_.push_back(ErrorEntry{values_.size() - 1U, std::forward<Error>(error)});
+        }
+        catch (...)
+        {
+            values_.pop_back();
+            throw;
+        }
+#else
+        errors_.push_back(ErrorEntry{values_.size() - 1U, std::forward<Error>(error)});
+#endif
+        markLast(false);
+    }
+
+    /// @brief Makes room for the validity of the next element, so recording it in `markLast` cannot throw.
+    void reserveValidity()
+    {
+        if (((values_.size() % kBitsPerWord) == 0U) && (validity_.size() == validity_.capacity()))
+        {
+            validity_.reserve(std::max<std::size_t>(2U * validity_.capacity(), 1U));
+        }
+    }
+
+    /// @brief Records the validity of the last appended element, the word is reserved by `reserveValidity`.
+    void markLast(bool ok) noexcept
+    {
+        const std::size_t index = values_.size() - 1U;
+        if ((index % kBitsPerWord) == 0U)
+        {
+            validity_.push_back(0U);
+        }
+        validity_.back() |= static_cast<std::uint64_t>(ok ? 1U : 0U) << (index % kBitsPerWord);
+    }
+
+  private:  // members
+    std::vector<T> values_;               /* Values, placeholders for the error elements. */
+    std::vector<std::uint64_t> validity_; /* Validity bitmap. */
+    std::vector<ErrorEntry> errors_;      /* Errors ordered by the element index. */
+};
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_RESULT_VECTOR_HPP
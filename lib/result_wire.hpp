@@ -0,0 +1,382 @@
+/**
+ * @file result_wire.hpp
+ * @brief Definition of the binary encoding of `Result<T, Status>`.
+ *
+ * This file contains a versioned fixed layout binary encoding of `Result<T, Status>` for the exchange of results
+ * between processes, e.g. over shared memory. `serializeInto()` writes a frame into a caller provided buffer and
+ * `ResultView` reads the value or the error in place from a received buffer, without copying nor constructing.
+ *
+ * Frame layout of wire version 1, the fields are in the byte order of the host:
+ *
+ * | Offset | Size    | Field                                                  |
+ * |--------|---------|--------------------------------------------------------|
+ * | 0      | 1       | wire version, `kResultWireVersion`                     |
+ * | 1      | 1       | kind: 0 error, 1 value                                 |
+ * | 2      | 2       | payload size, `ResultWireTraits<T>::kSize`             |
+ * | 4      | 4       | status, `Status::OK` for a value                       |
+ * | P      | payload | value, P is 8 rounded up to the payload alignment      |
+ *
+ * The size of a frame does not depend on its kind and is a multiple of its alignment, so frames can be stored in
+ * arrays and ring buffers. The bytes past the header that the payload does not fill, the payload of an error
+ * frame and the padding after the payload, are zeroed.
+ *
+ * Trivially copyable types are encoded as their object representation, `bool` and error code enumerations are
+ * checked on receipt. The padding inside such a type is copied as-is, so values whose type has padding carry
+ * whatever the sender left in it; zero them before setting their members or specialize `ResultWireTraits`.
+ * Other types specialize `ResultWireTraits`.
+ *
+ * @note This file is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_RESULT_WIRE_HPP
+#define INTERVIEW_LIBRARY_RESULT_WIRE_HPP
+
+#include "lib/result.hpp"
+#include "lib/span.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace interview
+{
+namespace library
+{
+
+/// @brief Version of the frame layout, written into every frame and checked by `ResultView`.
+constexpr std::uint8_t kResultWireVersion = 1U;
+
+/**
+ * @brief Customization point of the encoding of the values of type `T`.
+ *
+ * A specialization encodes `T` into a fixed size payload and provides:
+ *
+ * @code
+ * using ViewType = ...;                                                  // result of ResultView::getValue()
+ * static constexpr std::size_t kSize = ...;                              // size of the payload, < 65536
+ * static constexpr std::size_t kAlignment = ...;                         // alignment of the payload
+ * static bool encode(const T& value, unsigned char* payload) noexcept;   // false if `value` is not representable
+ * static ViewType view(const unsigned char* payload) noexcept;           // reads the payload in place
+ * static T decode(const unsigned char* payload);                         // constructs the value
+ * static bool valid(const unsigned char* payload) noexcept;             // optional, false if no value of `T`
+ * @endcode
+ *
+ * `ResultView::fromBuffer()` rejects value frames whose payload `valid()` refuses, so `view()` and `decode()` only
+ * see payloads of values. Without `valid()` every payload is accepted. The primary template is empty, so types
+ * without encoding are rejected at compile time.
+ *
+ * @tparam T type of the values.
+ */
+template <typename T, typename Enable = void>
+struct ResultWireTraits
+{
+};
+
+namespace detail
+{
+
+/// @brief Encoding of trivially copyable types: the object representation including its padding, read in place
+/// as `const T&`.
+template <typename T>
+struct WireObjectTraits
+{
+    using ViewType = const T&;
+
+    static constexpr std::size_t kSize = sizeof(T);
+    static constexpr std::size_t kAlignment = alignof(T);
+
+    static bool encode(const T& value, unsigned char* payload) noexcept
+    {
+        std::memcpy(payload, &value, sizeof(T));
+        return true;
+    }
+
+    static ViewType view(const unsigned char* payload) noexcept { return *reinterpret_cast<const T*>(payload); }
+
+    static T decode(const unsigned char* payload) noexcept { return view(payload); }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Encoding of trivially copyable types whose every object representation is a value.
+ *
+ * `bool` and enumerations have representations that are no value, reading them is undefined behaviour, so they
+ * have their own checking encodings below.
+ */
+template <typename T>
+struct ResultWireTraits<T,
+                        std::enable_if_t<std::is_trivially_copyable<T>::value && !std::is_same<T, bool>::value &&
+                                         !std::is_enum<T>::value>> : detail::WireObjectTraits<T>
+{
+};
+
+/// @brief Encoding of `bool`: one byte, `0` or `1`.
+template <>
+struct ResultWireTraits<bool> : detail::WireObjectTraits<bool>
+{
+    static_assert(sizeof(bool) == 1U, "bool must be one byte");
+
+    static bool valid(const unsigned char* payload) noexcept { return payload[0] <= 1U; }
+};
+
+/**
+ * @brief Encoding of the error code enumerations: the object representation, one of the codes.
+ *
+ * Only enumerations specializing `ResultErrorCodeTraits` are encoded, their codes are known to be
+ * `0 .. kCount - 1`. Other enumerations specialize `ResultWireTraits` themselves.
+ */
+template <typename T>
+struct ResultWireTraits<T, std::enable_if_t<std::is_enum<T>::value && (ResultErrorCodeTraits<T>::kCount > 0U)>>
+    : detail::WireObjectTraits<T>
+{
+    static bool valid(const unsigned char* payload) noexcept
+    {
+        std::underlying_type_t<T> code{};
+        std::memcpy(&code, payload, sizeof(code));
+        return static_cast<std::size_t>(code) < ResultErrorCodeTraits<T>::kCount;  // Negative codes wrap past it
+    }
+};
+
+namespace detail
+{
+
+/// @brief Discriminant of a frame.
+enum class WireKind : std::uint8_t
+{
+    ERROR = 0,
+    VALUE = 1
+};
+
+constexpr std::size_t kWireHeaderSize = 8U;
+constexpr std::size_t kWireKindOffset = 1U;
+constexpr std::size_t kWireSizeOffset = 2U;
+constexpr std::size_t kWireStatusOffset = 4U;
+
+constexpr std::size_t roundUp(std::size_t size, std::size_t alignment) noexcept
+{
+    return ((size + alignment - 1U) / alignment) * alignment;
+}
+
+/// @brief Layout of the frames of `T`.
+template <typename T>
+struct WireLayout
+{
+    using Traits = ResultWireTraits<T>;
+
+    static_assert(Traits::kSize <= 0xFFFFU, "Payload size must fit the 16 bits size field");
+    static_assert((Traits::kAlignment & (Traits::kAlignment - 1U)) == 0U, "Payload alignment must be a power of 2");
+
+    static constexpr std::size_t kAlignment =
+        (Traits::kAlignment > alignof(std::uint32_t)) ? Traits::kAlignment : alignof(std::uint32_t);
+    static constexpr std::size_t kPayloadOffset = roundUp(kWireHeaderSize, Traits::kAlignment);
+    static constexpr std::size_t kFrameSize = roundUp(kPayloadOffset + Traits::kSize, kAlignment);
+};
+
+inline bool isAligned(const void* pointer, std::size_t alignment) noexcept
+{
+    return (reinterpret_cast<std::uintptr_t>(pointer) % alignment) == 0U;
+}
+
+/// @brief Checks a payload with `Traits::valid()`, selected when the traits provide it.
+template <typename Traits>
+auto isValidPayload(const unsigned char* payload, int /* preferred */) noexcept -> decltype(Traits::valid(payload))
+{
+    return Traits::valid(payload);
+}
+
+/// @brief Accepts every payload of traits without `valid()`.
+template <typename Traits>
+bool isValidPayload(const unsigned char* /* payload */, long /* fallback */) noexcept
+{
+    return true;
+}
+
+}  // namespace detail
+
+/// @brief Size in bytes of the frames of `Result<T, Status>`.
+template <typename T>
+constexpr std::size_t resultWireSize() noexcept
+{
+    return detail::WireLayout<T>::kFrameSize;
+}
+
+/// @brief Alignment required from the buffers of the frames of `Result<T, Status>`.
+template <typename T>
+constexpr std::size_t resultWireAlignment() noexcept
+{
+    return detail::WireLayout<T>::kAlignment;
+}
+
+/**
+ * @brief Writes the frame of a result into a buffer.
+ *
+ * @code
+ * alignas(resultWireAlignment<Sample>()) unsigned char slot[resultWireSize<Sample>()];
+ * serializeInto(Span<unsigned char>(slot), readSample());
+ * @endcode
+ *
+ * @tparam T type of the value.
+ * @param buffer destination, aligned to `resultWireAlignment<T>()`.
+ * @param result result to encode.
+ * @return number of bytes written, `resultWireSize<T>()`, or `Status::INVALID_ARG` if the buffer is too small or
+ * misaligned, or if the value is not representable.
+ */
+template <typename T>
+Result<std::size_t> serializeInto(Span<unsigned char> buffer, const Result<T, Status>& result) noexcept
+{
+    using Layout = detail::WireLayout<T>;
+
+    if ((buffer.size() < Layout::kFrameSize) || !detail::isAligned(buffer.data(), Layout::kAlignment))
+    {
+        return createError(Status::INVALID_ARG);
+    }
+    unsigned char* frame = buffer.data();
+    std::memset(frame + detail::kWireHeaderSize, 0, Layout::kFrameSize - detail::kWireHeaderSize);
+    std::uint32_t status = static_cast<std::uint32_t>(Status::OK);
+    detail::WireKind kind = detail::WireKind::VALUE;
+    if (result.hasValue())
+    {
+        if (!Layout::Traits::encode(*result, frame + Layout::kPayloadOffset))
+        {
+            return createError(Status::INVALID_ARG);
+        }
+    }
+    else
+    {
+        status = static_cast<std::uint32_t>(result.getError());
+        kind = detail::WireKind::ERROR;
+    }
+    const std::uint16_t size = static_cast<std::uint16_t>(Layout::Traits::kSize);
+    frame[0] = kResultWireVersion;
+    frame[detail::kWireKindOffset] = static_cast<unsigned char>(kind);
+    std::memcpy(frame + detail::kWireSizeOffset, &size, sizeof(size));
+    std::memcpy(frame + detail::kWireStatusOffset, &status, sizeof(status));
+    return resultWireSize<T>();
+}
+
+/**
+ * @brief Read-only view of the frame of a `Result<T, Status>`.
+ *
+ * The view reads the frame in place, the buffer must outlive it and must not be modified while it is used.
+ *
+ * @tparam T type of the value.
+ */
+template <typename T>
+class ResultView
+{
+    using Layout = detail::WireLayout<T>;
+    using Traits = typename Layout::Traits;
+
+  public:
+    using ValueType = T;
+    using ErrorType = Status;
+    using ViewType = typename Traits::ViewType;
+
+    /**
+     * @brief Validates a received frame.
+     *
+     * @param buffer frame written by `serializeInto()`, aligned to `resultWireAlignment<T>()`.
+     * @return view of the frame, or `Status::INVALID_ARG` if the buffer is too small or misaligned, if the frame
+     * has another version, kind or payload size, if an error frame holds `Status::OK` or no `Status` code, or if
+     * `ResultWireTraits<T>::valid()` rejects the payload of a value frame.
+     */
+    static Result<ResultView> fromBuffer(Span<const unsigned char> buffer) noexcept
+    {
+        if ((buffer.size() < Layout::kFrameSize) || !detail::isAligned(buffer.data(), Layout::kAlignment))
+        {
+            return createError(Status::INVALID_ARG);
+        }
+        const unsigned char* frame = buffer.data();
+        const unsigned char kind = frame[detail::kWireKindOffset];
+        std::uint16_t size = 0U;
+        std::memcpy(&size, frame + detail::kWireSizeOffset, sizeof(size));
+        if ((frame[0] != kResultWireVersion) || (size != Traits::kSize) ||
+            ((kind != static_cast<unsigned char>(detail::WireKind::VALUE)) &&
+             (kind != static_cast<unsigned char>(detail::WireKind::ERROR))))
+        {
+            return createError(Status::INVALID_ARG);
+        }
+        if (kind == static_cast<unsigned char>(detail::WireKind::ERROR))
+        {
+            // The buffer is untrusted, a status out of the codes would read as another error or even as a value
+            std::uint32_t status = 0U;
+            std::memcpy(&status, frame + detail::kWireStatusOffset, sizeof(status));
+            if ((status == static_cast<std::uint32_t>(Status::OK)) || (status >= ResultErrorCodeTraits<Status>::kCount))
+            {
+                return createError(Status::INVALID_ARG);
+            }
+        }
+        else if (!detail::isValidPayload<Traits>(frame + Layout::kPayloadOffset, 0))
+        {
+            return createError(Status::INVALID_ARG);
+        }
+        return ResultView(frame);
+    }
+
+    /// @brief Check if the frame holds a value.
+    bool hasValue() const noexcept
+    {
+        return frame_[detail::kWireKindOffset] == static_cast<unsigned char>(detail::WireKind::VALUE);
+    }
+
+    explicit operator bool() const noexcept { return hasValue(); }
+
+    /**
+     * @brief Get the value, read in place.
+     *
+     * @return value, `const T&` into the buffer for trivially copyable types.
+     * @throws std::runtime_error If the frame does not hold a value.
+     */
+    ViewType getValue() const
+    {
+        if (!hasValue())
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_VALUE);
+        }
+        return Traits::view(frame_ + Layout::kPayloadOffset);
+    }
+
+    /// @brief Unchecked access to the value.
+    ViewType operator*() const noexcept { return Traits::view(frame_ + Layout::kPayloadOffset); }
+
+    /**
+     * @brief Get the error.
+     *
+     * @return error.
+     * @throws std::runtime_error If the frame does not hold an error.
+     */
+    Status getError() const
+    {
+        if (hasValue())
+        {
+            detail::reportBadAccess(detail::BadAccess::MISSING_ERROR);
+        }
+        std::uint32_t status = 0U;
+        std::memcpy(&status, frame_ + detail::kWireStatusOffset, sizeof(status));
+        return static_cast<Status>(status);
+    }
+
+    /// @brief Constructs the result held by the frame.
+    Result<T, Status> toResult() const
+    {
+        if (hasValue())
+        {
+            return Result<T, Status>(inPlace, Traits::decode(frame_ + Layout::kPayloadOffset));
+        }
+        return createError(getError());
+    }
+
+  private:  // methods
+    explicit ResultView(const unsigned char* frame) noexcept : frame_(frame) {}
+
+  private:  // members
+    const unsigned char* frame_; /* Validated frame. */
+};
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_RESULT_WIRE_HPP
@@ -0,0 +1,449 @@
+/**
+ * @file rich_error.hpp
+ * @brief Definition of the RichError class.
+ *
+ * This file contains the definition of the RichError class, a compact error type
+ * for `Result` which carries a `Status` code together with a small context: either
+ * a trivially copyable payload (e.g. errno or an offset) or a diagnostic message.
+ * Payloads and messages up to `kInlineCapacity` bytes are stored inline, so the
+ * error path does not allocate in the common case. Only longer messages are
+ * stored on the heap, or in the memory resource passed at construction (e.g. a
+ * `RequestArena`).
+ *
+ * @note This class is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_RICH_ERROR_HPP
+#define INTERVIEW_LIBRARY_RICH_ERROR_HPP
+
+#include "lib/result.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace interview
+{
+namespace library
+{
+
+/**
+ * @brief Allocator of the long messages of `RichError`, the memory resource is type-erased.
+ *
+ * Converts from memory resources (anything with `allocate(bytes, alignment)` and `deallocate(pointer, bytes,
+ * alignment)`, e.g. `std::pmr::memory_resource`) and from allocators with a `resource()`, e.g.
+ * `std::pmr::polymorphic_allocator`. It names no `std::pmr` type itself, so `RichError` has the same definition
+ * and the same heap layout in the C++14 and the C++17 translation units of a program. Default constructed, it
+ * allocates from the global heap.
+ */
+class RichErrorAllocator
+{
+  public:
+    /// @brief Alignment of the allocated blocks.
+    static constexpr std::size_t kAlignment = alignof(void*);
+
+    /// @brief Allocates from the global heap.
+    RichErrorAllocator() noexcept : resource_(nullptr), allocate_(&allocateGlobal), deallocate_(&deallocateGlobal) {}
+
+    /**
+     * @brief Allocates from the memory resource.
+     *
+     * @param resource memory resource, must outlive the messages allocated from it.
+     */
+    template <typename Resource,
+              typename = decltype(std::declval<Resource&>().allocate(std::size_t(), std::size_t()))>
+    RichErrorAllocator(Resource* resource) noexcept
+        : resource_(resource), allocate_(&allocateFrom<Resource>), deallocate_(&deallocateFrom<Resource>)
+    {
+    }
+
+    /**
+     * @brief Allocates from the memory resource of the allocator.
+     *
+     * @param allocator allocator with a `resource()`, e.g. `std::pmr::polymorphic_allocator`.
+     */
+    template <typename Allocator,
+              typename = decltype(std::declval<const Allocator&>().resource()->allocate(std::size_t(), std::size_t()))>
+    RichErrorAllocator(const Allocator& allocator) noexcept : RichErrorAllocator(allocator.resource())
+    {
+    }
+
+    /// @brief Allocates a block of `size` bytes.
+    void* allocate(std::size_t size) const { return allocate_(resource_, size); }
+
+    /// @brief Deallocates a block allocated with an equal allocator.
+    void deallocate(void* block, std::size_t size) const noexcept { deallocate_(resource_, block, size); }
+
+    /// @brief Check if both allocate from the same memory resource.
+    bool operator==(const RichErrorAllocator& other) const noexcept
+    {
+        return (resource_ == other.resource_) && (allocate_ == other.allocate_);
+    }
+
+    bool operator!=(const RichErrorAllocator& other) const noexcept { return !(*this == other); }
+
+  private:  // methods
+    static void* allocateGlobal(void* /* resource */, std::size_t size) { return ::operator new(size); }
+
+    static void deallocateGlobal(void* /* resource */, void* block, std::size_t /* size */) noexcept
+    {
+        ::operator delete(block);
+    }
+
+    template <typename Resource>
+    static void* allocateFrom(void* resource, std::size_t size)
+    {
+        return static_cast<Resource*>(resource)->allocate(size, kAlignment);
+    }
+
+    template <typename Resource>
+    static void deallocateFrom(void* resource, void* block, std::size_t size) noexcept
+    {
+        static_cast<Resource*>(resource)->deallocate(block, size, kAlignment);
+    }
+
+  private:  // members
+    void* resource_;                                /* Memory resource, `nullptr` for the global heap. */
+    void* (*allocate_)(void*, std::size_t);         /* Allocates from the resource. */
+    void (*deallocate_)(void*, void*, std::size_t); /* Deallocates from the resource. */
+};
+
+/**
+ * @brief Error type carrying a `Status` code and a small inline context.
+ */
+class RichError
+{
+  public:
+    /// @brief Bytes available for the payload or the message (including the terminating null) without allocation.
+    static constexpr std::size_t kInlineCapacity = 16U;
+
+    /// @brief Allocator of the heap stored message, makes RichError allocator-aware like `std::pmr::string`.
+    using allocator_type = RichErrorAllocator;
+
+    /**
+     * @brief Constructs an error without context.
+     *
+     * @param code status code of the error.
+     */
+    RichError(Status code = Status::ERROR) noexcept : code_(code), kind_(Kind::NONE), size_(0U) {}
+
+    /**
+     * @brief Constructs an error with a diagnostic message.
+     *
+     * @param code status code of the error.
+     * @param message message to copy, not required to be null terminated.
+     * @param size length of the message.
+     */
+    RichError(Status code, const char* message, std::size_t size) : code_(code), kind_(Kind::NONE), size_(0U)
+    {
+        setMessage(message, size);
+    }
+
+    /**
+     * @brief Constructs an error with a null terminated diagnostic message.
+     *
+     * @param code status code of the error.
+     * @param message message to copy.
+     */
+    RichError(Status code, const char* message) : RichError(code, message, std::strlen(message)) {}
+
+    /**
+     * @brief Constructs an error with a diagnostic message.
+     *
+     * @param code status code of the error.
+     * @param message message to copy.
+     */
+    RichError(Status code, const std::string& message) : RichError(code, message.data(), message.size()) {}
+
+    /**
+     * @brief Constructs an error without context, the allocator is not used.
+     */
+    explicit RichError(const allocator_type& /* alloc */) noexcept : RichError() {}
+
+    /**
+     * @brief Constructs an error without context, the allocator is not used.
+     */
+    RichError(Status code, const allocator_type& /* alloc */) noexcept : RichError(code) {}
+
+    /**
+     * @brief Constructs an error with a diagnostic message, a long message is allocated with the allocator.
+     *
+     * @param code status code of the error.
+     * @param message message to copy, not required to be null terminated.
+     * @param size length of the message.
+     * @param alloc allocator of the heap stored message.
+     */
+    RichError(Status code, const char* message, std::size_t size, const allocator_type& alloc)
+        : code_(code), kind_(Kind::NONE), size_(0U)
+    {
+        setMessage(message, size, alloc);
+    }
+
+    /**
+     * @brief Constructs an error with a null terminated diagnostic message allocated with the allocator.
+     */
+    RichError(Status code, const char* message, const allocator_type& alloc)
+        : RichError(code, message, std::strlen(message), alloc)
+    {
+    }
+
+    /**
+     * @brief Constructs an error with a diagnostic message allocated with the allocator.
+     */
+    RichError(Status code, const std::string& message, const allocator_type& alloc)
+        : RichError(code, message.data(), message.size(), alloc)
+    {
+    }
+
+    /// @brief Copies the error, the heap stored message is allocated with the allocator.
+    RichError(const RichError& other, const allocator_type& alloc) : code_(other.code_), kind_(Kind::NONE), size_(0U)
+    {
+        copyFrom(other, alloc);
+    }
+
+    /// @brief Moves the error, takes over the heap stored message when it uses the same memory resource.
+    RichError(RichError&& other, const allocator_type& alloc) : code_(other.code_), kind_(Kind::NONE), size_(0U)
+    {
+        if ((other.kind_ == Kind::HEAP_MESSAGE) && (other.heapAllocator() != alloc))
+        {
+            copyFrom(other, alloc);
+        }
+        else
+        {
+            moveFrom(std::move(other));
+        }
+    }
+
+    /**
+     * @brief Creates an error with a trivially copyable payload stored inline.
+     *
+     * @param code status code of the error.
+     * @param payload payload to copy, e.g. errno or an offset.
+     * @return error object.
+     */
+    template <typename P>
+    static RichError withPayload(Status code, const P& payload) noexcept
+    {
+        static_assert(std::is_trivially_copyable<P>::value, "Payload must be trivially copyable");
+        static_assert(sizeof(P) <= kInlineCapacity, "Payload must fit into the inline storage");
+        RichError error(code);
+        error.kind_ = Kind::PAYLOAD;
+        error.size_ = static_cast<std::uint8_t>(sizeof(P));
+        std::memcpy(error.storage_.inline_, &payload, sizeof(P));
+        return error;
+    }
+
+    /// @brief Copy constructor, copies the heap stored message to the global heap.
+    RichError(const RichError& other) : code_(other.code_), kind_(Kind::NONE), size_(0U)
+    {
+        copyFrom(other, allocator_type());
+    }
+
+    /// @brief Move constructor, takes over the heap stored message.
+    RichError(RichError&& other) noexcept : code_(other.code_), kind_(Kind::NONE), size_(0U)
+    {
+        moveFrom(std::move(other));
+    }
+
+    /// @brief Copy assignment operator, the heap stored message is allocated with `get_allocator()`.
+    RichError& operator=(const RichError& other)
+    {
+        if (this != &other)
+        {
+            RichError copy(other, get_allocator());
+            release();
+            code_ = copy.code_;
+            moveFrom(std::move(copy));
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment operator.
+    RichError& operator=(RichError&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            code_ = other.code_;
+            moveFrom(std::move(other));
+        }
+        return *this;
+    }
+
+    /// @brief Destructor. Releases the heap stored message.
+    ~RichError() { release(); }
+
+    /// @brief Get the status code.
+    Status code() const noexcept { return code_; }
+
+    /// @brief Check if the error carries a diagnostic message.
+    bool hasMessage() const noexcept { return (kind_ == Kind::INLINE_MESSAGE) || (kind_ == Kind::HEAP_MESSAGE); }
+
+    /// @brief Check if the error carries a payload.
+    bool hasPayload() const noexcept { return kind_ == Kind::PAYLOAD; }
+
+    /// @brief Check if the message had to be stored on the heap.
+    bool isHeapAllocated() const noexcept { return kind_ == Kind::HEAP_MESSAGE; }
+
+    /// @brief Get the allocator of the heap stored message, the global heap when the message is inline.
+    allocator_type get_allocator() const noexcept
+    {
+        return (kind_ == Kind::HEAP_MESSAGE) ? heapAllocator() : allocator_type();
+    }
+
+    /**
+     * @brief Get the diagnostic message.
+     *
+     * @return null terminated message, empty string if the error carries no message.
+     */
+    const char* message() const noexcept
+    {
+        if (kind_ == Kind::INLINE_MESSAGE)
+        {
+            return storage_.message_;
+        }
+        if (kind_ == Kind::HEAP_MESSAGE)
+        {
+            return storage_.heap_.data_;
+        }
+        return "";
+    }
+
+    /// @brief Get the length of the diagnostic message.
+    std::size_t messageSize() const noexcept
+    {
+        if (kind_ == Kind::INLINE_MESSAGE)
+        {
+            return size_;
+        }
+        if (kind_ == Kind::HEAP_MESSAGE)
+        {
+            return storage_.heap_.size_;
+        }
+        return 0U;
+    }
+
+    /**
+     * @brief Get the payload.
+     *
+     * @param payload object the payload is copied to.
+     * @return `true` if the error carries a payload of the size of `P`, `false` otherwise.
+     */
+    template <typename P>
+    bool getPayload(P& payload) const noexcept
+    {
+        static_assert(std::is_trivially_copyable<P>::value, "Payload must be trivially copyable");
+        if ((kind_ != Kind::PAYLOAD) || (size_ != sizeof(P)))
+        {
+            return false;
+        }
+        std::memcpy(&payload, storage_.inline_, sizeof(P));
+        return true;
+    }
+
+  private:  // methods
+    enum class Kind : std::uint8_t
+    {
+        NONE,
+        PAYLOAD,
+        INLINE_MESSAGE,
+        HEAP_MESSAGE
+    };
+
+    /// @brief Size of the header of a heap stored message, holding its allocator.
+    static constexpr std::size_t kHeaderSize = sizeof(allocator_type);
+
+    /// @brief Stores the message inline or on the heap when it does not fit.
+    void setMessage(const char* message, std::size_t size, const allocator_type& alloc = allocator_type())
+    {
+        if (size < kInlineCapacity)
+        {
+            std::memcpy(storage_.message_, message, size);
+            storage_.message_[size] = '\0';
+            kind_ = Kind::INLINE_MESSAGE;
+            size_ = static_cast<std::uint8_t>(size);
+        }
+        else
+        {
+            // The allocator is stored in front of the message, so the object does not grow
+            char* block = static_cast<char*>(alloc.allocate(kHeaderSize + size + 1U));
+            std::memcpy(block, &alloc, kHeaderSize);
+            char* data = block + kHeaderSize;
+            std::memcpy(data, message, size);
+            data[size] = '\0';
+            storage_.heap_.data_ = data;
+            storage_.heap_.size_ = size;
+            kind_ = Kind::HEAP_MESSAGE;
+        }
+    }
+
+    /// @brief Get the allocator of the heap stored message.
+    allocator_type heapAllocator() const noexcept
+    {
+        allocator_type alloc;
+        std::memcpy(&alloc, storage_.heap_.data_ - kHeaderSize, kHeaderSize);
+        return alloc;
+    }
+
+    void copyFrom(const RichError& other, const allocator_type& alloc)
+    {
+        if (other.kind_ == Kind::HEAP_MESSAGE)
+        {
+            setMessage(other.storage_.heap_.data_, other.storage_.heap_.size_, alloc);
+        }
+        else
+        {
+            storage_ = other.storage_;
+            kind_ = other.kind_;
+            size_ = other.size_;
+        }
+    }
+
+    void moveFrom(RichError&& other) noexcept
+    {
+        storage_ = other.storage_;
+        kind_ = other.kind_;
+        size_ = other.size_;
+        other.kind_ = Kind::NONE;
+        other.size_ = 0U;
+    }
+
+    void release() noexcept
+    {
+        if (kind_ == Kind::HEAP_MESSAGE)
+        {
+            heapAllocator().deallocate(storage_.heap_.data_ - kHeaderSize, kHeaderSize + storage_.heap_.size_ + 1U);
+        }
+        kind_ = Kind::NONE;
+        size_ = 0U;
+    }
+
+  private:  // members
+    struct HeapMessage
+    {
+        char* data_;       /* Null terminated message. */
+        std::size_t size_; /* Length of the message. */
+    };
+
+    union Storage
+    {
+        alignas(std::uint64_t) unsigned char inline_[kInlineCapacity]; /* Payload. */
+        char message_[kInlineCapacity];                                    /* Inline message. */
+        HeapMessage heap_;                                                 /* Heap stored message. */
+    };
+
+    Status code_;        /* Status code of the error. */
+    Kind kind_;          /* Kind of the context stored. */
+    std::uint8_t size_;  /* Size of the payload or of the inline message. */
+    Storage storage_{};  /* Payload or message. */
+};
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_RICH_ERROR_HPP
@@ -0,0 +1,231 @@
+/**
+ * @file small_vector.hpp
+ * @brief Definition of the SmallVector class.
+ *
+ * This file contains the definition of the SmallVector class, a sequence container storing up to `N` objects
+ * inline, without allocating. It moves to the heap once it grows beyond `N`. Only the subset of the `std::vector`
+ * interface needed by the libraries is provided.
+ *
+ * @note This class is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_SMALL_VECTOR_HPP
+#define INTERVIEW_LIBRARY_SMALL_VECTOR_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace interview
+{
+namespace library
+{
+
+/**
+ * @brief Sequence container with inline storage for `N` objects.
+ *
+ * @tparam T type of the objects.
+ * @tparam N number of objects stored without allocating, at least 1.
+ */
+template <typename T, std::size_t N>
+class SmallVector
+{
+    static_assert(N > 0U, "Inline capacity must not be 0");
+
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    /// @brief Number of objects stored inline.
+    static constexpr std::size_t kInlineCapacity = N;
+
+    /// @brief Constructs an empty container, does not allocate.
+    SmallVector() noexcept : data_(inlineData()), size_(0U), capacity_(N) {}
+
+    SmallVector(const SmallVector& other) : SmallVector()
+    {
+        reserve(other.size_);
+        std::uninitialized_copy(other.begin(), other.end(), data_);
+        size_ = other.size_;
+    }
+
+    /// @brief Takes over the heap storage of `other`, or moves its inline objects one by one.
+    SmallVector(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value) : SmallVector()
+    {
+        takeOver(other);
+    }
+
+    SmallVector& operator=(const SmallVector& other)
+    {
+        if (this != &other)
+        {
+            clear();
+            reserve(other.size_);
+            std::uninitialized_copy(other.begin(), other.end(), data_);
+            size_ = other.size_;
+        }
+        return *this;
+    }
+
+    SmallVector& operator=(SmallVector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        if (this != &other)
+        {
+            clear();
+            release();
+            takeOver(other);
+        }
+        return *this;
+    }
+
+    ~SmallVector()
+    {
+        clear();
+        release();
+    }
+
+    T* data() noexcept { return data_; }
+    const T* data() const noexcept { return data_; }
+    std::size_t size() const noexcept { return size_; }
+    std::size_t capacity() const noexcept { return capacity_; }
+    bool empty() const noexcept { return size_ == 0U; }
+
+    /// @brief Check if the objects are stored inline.
+    bool isInline() const noexcept { return data_ == inlineData(); }
+
+    iterator begin() noexcept { return data_; }
+    iterator end() noexcept { return data_ + size_; }
+    const_iterator begin() const noexcept { return data_; }
+    const_iterator end() const noexcept { return data_ + size_; }
+
+    /// @brief Unchecked access to the object at `index`.
+    T& operator[](std::size_t index) noexcept { return data_[index]; }
+    const T& operator[](std::size_t index) const noexcept { return data_[index]; }
+
+    T& front() noexcept { return data_[0]; }
+    const T& front() const noexcept { return data_[0]; }
+    T& back() noexcept { return data_[size_ - 1U]; }
+    const T& back() const noexcept { return data_[size_ - 1U]; }
+
+    /**
+     * @brief Ensures the storage for `capacity` objects.
+     *
+     * @param capacity number of objects, the storage moves to the heap beyond `N`.
+     */
+    void reserve(std::size_t capacity)
+    {
+        if (capacity > capacity_)
+        {
+            reallocate(capacity);
+        }
+    }
+
+    /**
+     * @brief Constructs an object at the end.
+     *
+     * @param args arguments of the constructor of `T`.
+     * @return the new object.
+     */
+    template <typename... Args>
+    T& emplace_back(Args&&... args)
+    {
+        if (size_ == capacity_)
+        {
+            // The arguments may refer to an object of the container, so it is constructed before the reallocation
+            T object(std::forward<Args>(args)...);
+            reallocate(2U * capacity_);
+            ::new (static_cast<void*>(data_ + size_)) T(std::move(object));
+        }
+        else
+        {
+            ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+        }
+        return data_[size_++];
+    }
+
+    void push_back(const T& object) { emplace_back(object); }
+    void push_back(T&& object) { emplace_back(std::move(object)); }
+
+    void pop_back() noexcept { data_[--size_].~T(); }
+
+    /// @brief Destructs all the objects, keeps the storage.
+    void clear() noexcept
+    {
+        for (T& object : *this)
+        {
+            object.~T();
+        }
+        size_ = 0U;
+    }
+
+  private:  // methods
+    T* inlineData() noexcept { return reinterpret_cast<T*>(inline_); }
+    const T* inlineData() const noexcept { return reinterpret_cast<const T*>(inline_); }
+
+    /// @brief Moves the objects into a heap storage of `capacity` objects, unchanged if an exception is thrown.
+    void reallocate(std::size_t capacity)
+    {
+        // Frees the new storage if a constructor throws
+        const auto deallocate = [capacity](T* storage) { std::allocator<T>().deallocate(storage, capacity); };
+        std::unique_ptr<T, decltype(deallocate)> storage(std::allocator<T>().allocate(capacity), deallocate);
+        using Source = std::conditional_t<std::is_nothrow_move_constructible<T>::value ||
+                                              !std::is_copy_constructible<T>::value,
+                                          std::move_iterator<T*>, T*>;
+        std::uninitialized_copy(Source(begin()), Source(end()), storage.get());
+        const std::size_t size = size_;
+        clear();
+        release();
+        data_ = storage.release();
+        size_ = size;
+        capacity_ = capacity;
+    }
+
+    /// @brief Frees the heap storage, the container must be empty.
+    void release() noexcept
+    {
+        if (!isInline())
+        {
+            std::allocator<T>().deallocate(data_, capacity_);
+            data_ = inlineData();
+            capacity_ = N;
+        }
+    }
+
+    /// @brief Takes the objects of `other` over, the container must be empty and inline.
+    void takeOver(SmallVector& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+        if (other.isInline())
+        {
+            std::uninitialized_copy(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()),
+                                    data_);
+            size_ = other.size_;
+            other.clear();
+        }
+        else
+        {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inlineData();
+            other.size_ = 0U;
+            other.capacity_ = N;
+        }
+    }
+
+  private:  // members
+    T* data_;                                        /* Inline or heap storage. */
+    std::size_t size_;                               /* Number of objects. */
+    std::size_t capacity_;                           /* Number of objects of the storage. */
+    alignas(T) unsigned char inline_[sizeof(T) * N]; /* Inline storage. */
+};
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_SMALL_VECTOR_HPP
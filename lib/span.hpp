@@ -0,0 +1,104 @@
+/**
+ * @file span.hpp
+ * @brief Definition of the Span class.
+ *
+ * This file contains the definition of the Span class, a non-owning view of
+ * a contiguous sequence of objects. It is the subset of `std::span` (C++20)
+ * needed by the libraries, usable with C++14.
+ *
+ * @note This class is part of the interview::library namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_SPAN_HPP
+#define INTERVIEW_LIBRARY_SPAN_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+
+/**
+ * @brief Non-owning view of a contiguous sequence of objects.
+ *
+ * @tparam T type of the objects, `const` qualified for read-only views.
+ */
+template <typename T>
+class Span
+{
+  public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using iterator = T*;
+
+    /// @brief Constructs an empty view.
+    constexpr Span() noexcept : data_(nullptr), size_(0U) {}
+
+    /**
+     * @brief Constructs a view of `size` objects starting at `data`.
+     *
+     * @param data pointer to the first object.
+     * @param size number of objects.
+     */
+    constexpr Span(T* data, std::size_t size) noexcept : data_(data), size_(size) {}
+
+    /// @brief Constructs a view of an array.
+    template <std::size_t N>
+    constexpr Span(T (&array)[N]) noexcept : data_(array), size_(N)
+    {
+    }
+
+    /// @brief Constructs a view of the vector elements.
+    template <typename U, typename = std::enable_if_t<std::is_convertible<U*, T*>::value>>
+    Span(std::vector<U>& vector) noexcept : data_(vector.data()), size_(vector.size())
+    {
+    }
+
+    /// @brief Constructs a read-only view of the vector elements.
+    template <typename U, typename = std::enable_if_t<std::is_convertible<const U*, T*>::value>>
+    Span(const std::vector<U>& vector) noexcept : data_(vector.data()), size_(vector.size())
+    {
+    }
+
+    /// @brief Converts a view of mutable objects to a read-only one.
+    template <typename U, typename = std::enable_if_t<std::is_convertible<U*, T*>::value>>
+    constexpr Span(const Span<U>& other) noexcept : data_(other.data()), size_(other.size())
+    {
+    }
+
+    constexpr T* data() const noexcept { return data_; }
+    constexpr std::size_t size() const noexcept { return size_; }
+    constexpr std::size_t sizeBytes() const noexcept { return size_ * sizeof(T); }
+    constexpr bool empty() const noexcept { return size_ == 0U; }
+
+    constexpr T* begin() const noexcept { return data_; }
+    constexpr T* end() const noexcept { return data_ + size_; }
+
+    /// @brief Unchecked access to the object at `index`.
+    constexpr T& operator[](std::size_t index) const noexcept { return data_[index]; }
+
+    /**
+     * @brief Get the sub view.
+     *
+     * @param offset index of the first object, must not exceed `size()`.
+     * @param count number of objects, clamped to the end of the view.
+     * @return view of the objects `offset .. offset + count`.
+     */
+    constexpr Span subspan(std::size_t offset, std::size_t count) const noexcept
+    {
+        return Span(data_ + offset, ((size_ - offset) < count) ? (size_ - offset) : count);
+    }
+
+  private:
+    T* data_;          /* First object of the view. */
+    std::size_t size_; /* Number of objects in the view. */
+};
+
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_SPAN_HPP
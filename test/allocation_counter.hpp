@@ -0,0 +1,69 @@
+/**
+ * @file allocation_counter.hpp
+ * @brief Replacement of the global `operator new` counting the allocations of a test binary.
+ *
+ * This file replaces the global `operator new` and `operator delete` so a test can check how many allocations a
+ * code path makes. Replacement functions cannot be inline, so include it from one translation unit of the binary
+ * only.
+ *
+ * @note This file is part of the interview::library::test namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_TEST_ALLOCATION_COUNTER_HPP
+#define INTERVIEW_LIBRARY_TEST_ALLOCATION_COUNTER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+/// @brief Get the number of allocations made with the global `operator new` so far.
+inline std::atomic<std::size_t>& allocationCount() noexcept
+{
+    static std::atomic<std::size_t> count{0U};
+    return count;
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
+
+// Keeps the replaced operator delete out of line: inlined next to a new expression, GCC reports free() on memory
+// of operator new (-Wmismatched-new-delete), which is the intent here. A pragma around the definitions does not
+// reach the inlined copies.
+#if defined(__GNUC__) || defined(__clang__)
+#define INTERVIEW_TEST_NOINLINE __attribute__((noinline))
+#else
+#define INTERVIEW_TEST_NOINLINE
+#endif
+
+void* operator new(std::size_t size)
+{
+    interview::library::test::allocationCount().fetch_add(1U, std::memory_order_relaxed);
+    void* memory = std::malloc((size != 0U) ? size : 1U);
+    if (memory == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+INTERVIEW_TEST_NOINLINE void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+INTERVIEW_TEST_NOINLINE void operator delete(void* memory, std::size_t /* size */) noexcept
+{
+    std::free(memory);
+}
+
+#endif  // INTERVIEW_LIBRARY_TEST_ALLOCATION_COUNTER_HPP
@@ -0,0 +1,170 @@
+/**
+ * @file lifetime_tracker.hpp
+ * @brief Definition of the Tracked test type.
+ *
+ * This file contains the definition of the Tracked class, a payload which counts its constructions, copies, moves,
+ * assignments and destructions. Every live object registers its address, so the tracker detects double
+ * destruction, operations on destroyed objects and objects relocated by a `memcpy` without reading the memory of
+ * an object after its lifetime ended. Used by the lifetime tests and the fuzz target of `Result`.
+ *
+ * @note This class is part of the interview::library::test namespace.
+ * @author Daniel Wieczorek
+ *
+ */
+#ifndef INTERVIEW_LIBRARY_TEST_LIFETIME_TRACKER_HPP
+#define INTERVIEW_LIBRARY_TEST_LIFETIME_TRACKER_HPP
+
+#include <cstddef>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+/// @brief Counters shared by all tracked objects.
+struct LifetimeCounters
+{
+    int constructed_{0};        /* Constructions from a payload. */
+    int copied_{0};             /* Copy constructions. */
+    int moved_{0};              /* Move constructions. */
+    int assigned_{0};           /* Copy and move assignments. */
+    int destroyed_{0};          /* Destructions. */
+    int violations_{0};         /* Double destructions, operations on destroyed or relocated objects. */
+    int copiesUntilThrow_{-1};  /* Copy constructions left until one throws, `-1` never throws. */
+    std::unordered_set<const void*> live_; /* Addresses of the live objects. */
+
+    /// @brief Get the number of live objects.
+    std::size_t live() const noexcept { return live_.size(); }
+
+    /// @brief Check that every constructed object was destructed exactly once and nothing was misused.
+    bool balanced() const noexcept { return live_.empty() && (violations_ == 0); }
+};
+
+/// @brief Get the counters, reset them with `lifetimeCounters() = LifetimeCounters{}` between test cases.
+inline LifetimeCounters& lifetimeCounters()
+{
+    static LifetimeCounters counters;
+    return counters;
+}
+
+/**
+ * @brief Payload tracking its lifetime, see `LifetimeCounters`.
+ *
+ * The move constructor never throws, the copy constructor throws `std::runtime_error` when armed with
+ * `copiesUntilThrow_`. A moved-from object keeps the payload `kMovedFrom`.
+ *
+ * @tparam Kind Distinguishes the value type from the error type of `Result<Tracked<0>, Tracked<1>>`.
+ */
+template <int Kind>
+class Tracked
+{
+  public:
+    static constexpr int kMovedFrom = -1;
+
+    explicit Tracked(int payload = 0) : payload_(payload)
+    {
+        enter();
+        ++lifetimeCounters().constructed_;
+    }
+
+    Tracked(const Tracked& other) : payload_(other.payload())
+    {
+        LifetimeCounters& counters = lifetimeCounters();
+        if (counters.copiesUntilThrow_ == 0)
+        {
+            counters.copiesUntilThrow_ = -1;
+            throw std::runtime_error("Tracked copy");
+        }
+        if (counters.copiesUntilThrow_ > 0)
+        {
+            --counters.copiesUntilThrow_;
+        }
+        enter();
+        ++counters.copied_;
+    }
+
+    Tracked(Tracked&& other) noexcept : payload_(other.payload())
+    {
+        other.payload_ = kMovedFrom;
+        enter();
+        ++lifetimeCounters().moved_;
+    }
+
+    Tracked& operator=(const Tracked& other)
+    {
+        check();
+        payload_ = other.payload();
+        ++lifetimeCounters().assigned_;
+        return *this;
+    }
+
+    Tracked& operator=(Tracked&& other) noexcept
+    {
+        check();
+        payload_ = other.payload();
+        if (&other != this)
+        {
+            other.payload_ = kMovedFrom;
+        }
+        ++lifetimeCounters().assigned_;
+        return *this;
+    }
+
+    ~Tracked()
+    {
+        LifetimeCounters& counters = lifetimeCounters();
+        if (counters.live_.erase(this) == 0U)
+        {
+            ++counters.violations_;
+        }
+        ++counters.destroyed_;
+    }
+
+    /// @brief Get the payload, counts a violation when the object is not alive.
+    int payload() const noexcept
+    {
+        check();
+        return payload_;
+    }
+
+    friend bool operator==(const Tracked& a, const Tracked& b) noexcept { return a.payload() == b.payload(); }
+    friend bool operator!=(const Tracked& a, const Tracked& b) noexcept { return !(a == b); }
+
+  private:  // methods
+    /// @brief Registers the object, counts a violation when another object still lives at the address.
+    void enter()
+    {
+        if (!lifetimeCounters().live_.insert(this).second)
+        {
+            ++lifetimeCounters().violations_;
+        }
+    }
+
+    void check() const noexcept
+    {
+        const LifetimeCounters& counters = lifetimeCounters();
+        if (counters.live_.find(this) == counters.live_.end())
+        {
+            ++lifetimeCounters().violations_;
+        }
+    }
+
+  private:  // members
+    int payload_; /* Payload compared by the tests. */
+};
+
+template <int Kind>
+constexpr int Tracked<Kind>::kMovedFrom;
+
+using TrackedValue = Tracked<0>;
+using TrackedError = Tracked<1>;
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
+
+#endif  // INTERVIEW_LIBRARY_TEST_LIFETIME_TRACKER_HPP
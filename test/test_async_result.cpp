@@ -0,0 +1,242 @@
+#include "lib/async_result.hpp"
+#include "test/allocation_counter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+class AsyncResultTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(AsyncResultTest, ReadyResult)
+{
+    AsyncResult<std::uint32_t> async = makeReadyAsyncResult(Result<std::uint32_t>(3U));
+    ASSERT_TRUE(async.valid());
+    EXPECT_TRUE(async.ready());
+    EXPECT_EQ(async.get().getValue(), 3U);
+    EXPECT_FALSE(async.valid());
+}
+
+TEST_F(AsyncResultTest, PromiseSetLater)
+{
+    AsyncPromise<std::string> promise;
+    AsyncResult<std::string> async = promise.getAsyncResult();
+    EXPECT_FALSE(async.ready());
+    promise.setResult(std::string("done"));
+    EXPECT_TRUE(async.ready());
+    EXPECT_EQ(async.get().getValue(), "done");
+}
+
+TEST_F(AsyncResultTest, BrokenPromise)
+{
+    AsyncResult<std::uint32_t> async;
+    {
+        AsyncPromise<std::uint32_t> promise;
+        async = promise.getAsyncResult();
+    }
+    EXPECT_EQ(async.get().getError(), Status::ERROR);
+
+    // Without a consumer the state is freed by the promise alone
+    AsyncPromise<std::uint32_t> unused;
+}
+
+TEST_F(AsyncResultTest, ThenRunsInlineInCompletingThread)
+{
+    AsyncPromise<std::uint32_t> promise;
+    std::thread::id continuationThread;
+    AsyncResult<std::string> async = promise.getAsyncResult().then([&continuationThread](std::uint32_t value) {
+        continuationThread = std::this_thread::get_id();
+        return std::to_string(value * 2U);
+    });
+    EXPECT_FALSE(async.ready());
+
+    std::thread producer([&promise]() { promise.setResult(21U); });
+    const std::thread::id producerThread = producer.get_id();
+    producer.join();
+    EXPECT_EQ(continuationThread, producerThread);
+    EXPECT_EQ(async.get().getValue(), "42");
+}
+
+TEST_F(AsyncResultTest, ThenOnReadyResultRunsRightAway)
+{
+    bool called = false;
+    AsyncResult<std::uint32_t> async = makeReadyAsyncResult(Result<std::uint32_t>(4U)).then([&called](std::uint32_t v) {
+        called = true;
+        return v + 1U;
+    });
+    EXPECT_TRUE(called);
+    EXPECT_EQ(async.get().getValue(), 5U);
+}
+
+TEST_F(AsyncResultTest, ErrorsShortCircuit)
+{
+    AsyncPromise<std::uint32_t> promise;
+    std::uint32_t calls = 0U;
+    AsyncResult<std::uint32_t> async = promise.getAsyncResult()
+                                           .then([&calls](std::uint32_t value) {
+                                               ++calls;
+                                               return value + 1U;
+                                           })
+                                           .andThen([&calls](std::uint32_t value) -> Result<std::uint32_t> {
+                                               ++calls;
+                                               return value;
+                                           });
+    promise.setResult(createError(Status::INVALID_ARG));
+    EXPECT_EQ(async.get().getError(), Status::INVALID_ARG);
+    EXPECT_EQ(calls, 0U);
+}
+
+TEST_F(AsyncResultTest, AndThenWithResult)
+{
+    const auto checkEven = [](std::uint32_t value) -> Result<std::uint32_t> {
+        if ((value % 2U) != 0U)
+        {
+            return createError(Status::INVALID_ARG);
+        }
+        return value / 2U;
+    };
+    EXPECT_EQ(makeReadyAsyncResult(Result<std::uint32_t>(8U)).andThen(checkEven).get().getValue(), 4U);
+    EXPECT_EQ(makeReadyAsyncResult(Result<std::uint32_t>(7U)).andThen(checkEven).get().getError(),
+              Status::INVALID_ARG);
+}
+
+TEST_F(AsyncResultTest, AndThenWithAsyncResult)
+{
+    AsyncPromise<std::uint32_t> first;
+    AsyncPromise<std::string> second;
+    AsyncResult<std::string> async =
+        first.getAsyncResult().andThen([&second](std::uint32_t) { return second.getAsyncResult(); });
+    first.setResult(1U);
+    EXPECT_FALSE(async.ready());
+    second.setResult(std::string("chained"));
+    EXPECT_EQ(async.get().getValue(), "chained");
+
+    AsyncPromise<std::uint32_t> failing;
+    AsyncResult<std::string> skipped = failing.getAsyncResult().andThen(
+        [](std::uint32_t value) { return makeReadyAsyncResult(Result<std::string>(std::to_string(value))); });
+    failing.setResult(createError(Status::ERROR));
+    EXPECT_EQ(skipped.get().getError(), Status::ERROR);
+}
+
+TEST_F(AsyncResultTest, ContinuationsOnExecutor)
+{
+    AsyncThreadPool pool(2U);
+    AsyncPromise<std::uint32_t> promise;
+    const std::thread::id caller = std::this_thread::get_id();
+    std::atomic<bool> onPool{false};
+    AsyncResult<std::uint32_t> async = promise.getAsyncResult()
+                                           .then(pool,
+                                                 [caller, &onPool](std::uint32_t value) {
+                                                     onPool.store(std::this_thread::get_id() != caller);
+                                                     return value * 3U;
+                                                 })
+                                           .andThen(pool, [](std::uint32_t value) -> Result<std::uint32_t> {
+                                               return value + 1U;
+                                           });
+    promise.setResult(5U);
+    EXPECT_EQ(async.get().getValue(), 16U);
+    EXPECT_TRUE(onPool.load());
+}
+
+TEST_F(AsyncResultTest, VoidResults)
+{
+    AsyncPromise<void> promise;
+    AsyncResult<std::uint32_t> async = promise.getAsyncResult().then([]() { return 7U; });
+    promise.setResult(Result<void>());
+    EXPECT_EQ(async.get().getValue(), 7U);
+
+    AsyncResult<void> mapped = makeReadyAsyncResult(Result<std::uint32_t>(1U)).then([](std::uint32_t) {});
+    EXPECT_TRUE(mapped.get().hasValue());
+}
+
+TEST_F(AsyncResultTest, WhenAllCollectsValues)
+{
+    std::vector<AsyncPromise<std::uint32_t>> promises(3U);
+    std::vector<AsyncResult<std::uint32_t>> inputs;
+    for (auto& promise : promises)
+    {
+        inputs.push_back(promise.getAsyncResult());
+    }
+    AsyncResult<std::vector<std::uint32_t>> all = whenAll(std::move(inputs));
+    promises[2].setResult(30U);
+    promises[0].setResult(10U);
+    EXPECT_FALSE(all.ready());
+    promises[1].setResult(20U);
+    EXPECT_EQ(all.get().getValue(), (std::vector<std::uint32_t>{10U, 20U, 30U}));
+
+    EXPECT_TRUE(whenAll(std::vector<AsyncResult<std::uint32_t>>()).get().getValue().empty());
+}
+
+TEST_F(AsyncResultTest, WhenAllTakesFirstErrorByPosition)
+{
+    std::vector<AsyncResult<std::uint32_t>> inputs;
+    inputs.push_back(makeReadyAsyncResult(Result<std::uint32_t>(1U)));
+    inputs.push_back(makeReadyAsyncResult(Result<std::uint32_t>(createError(Status::INVALID_ARG))));
+    inputs.push_back(makeReadyAsyncResult(Result<std::uint32_t>(createError(Status::ERROR))));
+    EXPECT_EQ(whenAll(std::move(inputs)).get().getError(), Status::INVALID_ARG);
+}
+
+TEST_F(AsyncResultTest, OneAllocationPerStage)
+{
+    AsyncPromise<std::uint32_t> promise;
+    const std::size_t before = allocationCount().load();
+    AsyncResult<std::uint32_t> async =
+        promise.getAsyncResult().then([](std::uint32_t value) { return value + 1U; }).then([](std::uint32_t value) {
+            return value * 2U;
+        });
+    promise.setResult(1U);
+    EXPECT_EQ(async.get().getValue(), 4U);
+    EXPECT_EQ(allocationCount().load(), before + 2U);
+}
+
+TEST_F(AsyncResultTest, ConcurrentCompletionAndChaining)
+{
+    constexpr std::uint32_t kOperations = 2000U;
+    std::vector<AsyncPromise<std::uint32_t>> promises(kOperations);
+    std::vector<AsyncResult<std::uint32_t>> inputs;
+    for (auto& promise : promises)
+    {
+        inputs.push_back(promise.getAsyncResult());
+    }
+    // The producer races with the continuations being attached
+    std::thread producer([&promises]() {
+        for (std::uint32_t i = 0U; i < kOperations; ++i)
+        {
+            promises[i].setResult(i);
+        }
+    });
+    std::vector<AsyncResult<std::uint32_t>> chained;
+    for (auto& input : inputs)
+    {
+        chained.push_back(std::move(input).then([](std::uint32_t value) { return value + 1U; }));
+    }
+    AsyncResult<std::vector<std::uint32_t>> all = whenAll(std::move(chained));
+    const Result<std::vector<std::uint32_t>> values = all.get();
+    producer.join();
+    ASSERT_TRUE(values.hasValue());
+    for (std::uint32_t i = 0U; i < kOperations; ++i)
+    {
+        EXPECT_EQ(values.getValue()[i], i + 1U);
+    }
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
@@ -0,0 +1,205 @@
+#include "lib/atomic_result_slot.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+constexpr const char* kLongText = "value longer than the small string buffer";
+
+class AtomicResultSlotTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(AtomicResultSlotTest, PublishAndPoll)
+{
+    AtomicResultSlot<std::uint32_t> slot;
+    EXPECT_TRUE(slot.empty());
+    EXPECT_FALSE(slot.ready());
+    EXPECT_EQ(slot.tryGet(), nullptr);
+
+    slot.publish(42U);
+    ASSERT_TRUE(slot.ready());
+    ASSERT_NE(slot.tryGet(), nullptr);
+    EXPECT_EQ(slot.tryGet()->getValue(), 42U);
+    EXPECT_EQ(slot.wait().getValue(), 42U);
+
+    AtomicResultSlot<std::string> failed;
+    failed.publish(createError(Status::ERROR));
+    EXPECT_EQ(failed.wait().getError(), Status::ERROR);
+}
+
+TEST_F(AtomicResultSlotTest, TakeMovesResultOut)
+{
+#if !INTERVIEW_RESULT_AUDIT
+    // The slot holds a plain Result, so trivially copyable results are taken out with a memcpy
+    static_assert(std::is_trivially_copyable<Result<std::uint64_t>>::value, "Result of a trivial payload");
+#endif
+    EXPECT_LE(sizeof(AtomicResultSlot<std::uint64_t>),
+              sizeof(Result<std::uint64_t>) + alignof(Result<std::uint64_t>));
+
+    AtomicResultSlot<std::string> slot;
+    slot.publish(inPlace, kLongText);
+    const Result<std::string> taken = slot.take();
+    EXPECT_EQ(taken.getValue(), kLongText);
+    EXPECT_TRUE(slot.empty());
+    EXPECT_EQ(slot.tryGet(), nullptr);
+
+    // The slot is empty for the next result
+    slot.publish(createError(Status::INVALID_ARG));
+    EXPECT_EQ(slot.take().getError(), Status::INVALID_ARG);
+    slot.publish("discarded");
+    slot.reset();
+    EXPECT_FALSE(slot.ready());
+}
+
+/// @brief Payload whose moves throw while `failMoves` is set.
+bool failMoves = false;
+
+struct ThrowingMove
+{
+    explicit ThrowingMove(int id) noexcept : id_(id) {}
+    ThrowingMove(const ThrowingMove&) = default;
+    ThrowingMove(ThrowingMove&& other) : id_(other.id_)
+    {
+        if (failMoves)
+        {
+            throw std::runtime_error("move");
+        }
+    }
+
+    int id_;
+};
+
+TEST_F(AtomicResultSlotTest, ThrowingTakeKeepsResultPublished)
+{
+    AtomicResultSlot<ThrowingMove> slot;
+    slot.publish(inPlace, 7);
+    failMoves = true;
+    EXPECT_THROW(slot.take(), std::runtime_error);
+    failMoves = false;
+    ASSERT_TRUE(slot.ready());
+    EXPECT_EQ(slot.wait()->id_, 7);
+    EXPECT_EQ(slot.take()->id_, 7);
+    EXPECT_TRUE(slot.empty());
+}
+
+TEST_F(AtomicResultSlotTest, ConsumersBlockUntilPublished)
+{
+    AtomicResultSlot<std::string> slot;
+    std::atomic<std::uint32_t> received{0U};
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < 4; ++consumer)
+    {
+        consumers.emplace_back([&slot, &received]() {
+            if (slot.wait().getValue() == kLongText)
+            {
+                received.fetch_add(1U);
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    EXPECT_EQ(received.load(), 0U);
+    slot.publish(kLongText);
+    for (std::thread& consumer : consumers)
+    {
+        consumer.join();
+    }
+    EXPECT_EQ(received.load(), 4U);
+}
+
+TEST_F(AtomicResultSlotTest, ConcurrentTakersShareResults)
+{
+    constexpr std::uint32_t kResults = 1000U;
+    AtomicResultSlot<std::uint32_t> slot;
+    AtomicResultSlot<std::uint32_t> done;
+    std::atomic<std::uint64_t> sum{0U};
+    std::vector<std::thread> consumers;
+    for (int consumer = 0; consumer < 3; ++consumer)
+    {
+        consumers.emplace_back([&slot, &done, &sum]() {
+            for (;;)
+            {
+                const Result<std::uint32_t> result = slot.take();
+                done.publish(result.hasValue() ? *result : 0U);
+                if (!result.hasValue())
+                {
+                    return;  // Stop request
+                }
+                sum.fetch_add(*result);
+            }
+        });
+    }
+    for (std::uint32_t value = 1U; value <= kResults; ++value)
+    {
+        slot.publish(value);
+        EXPECT_EQ(done.take().getValue(), value);  // Exactly one consumer took it
+    }
+    for (std::size_t consumer = 0U; consumer < consumers.size(); ++consumer)
+    {
+        slot.publish(createError(Status::ERROR));
+        EXPECT_EQ(done.take().getValue(), 0U);
+    }
+    for (std::thread& consumer : consumers)
+    {
+        consumer.join();
+    }
+    EXPECT_EQ(sum.load(), (std::uint64_t{kResults} * (kResults + 1U)) / 2U);
+}
+
+TEST_F(AtomicResultSlotTest, RepeatedHandOff)
+{
+    constexpr std::uint32_t kRounds = 2000U;
+    AtomicResultSlot<std::uint32_t> request;
+    AtomicResultSlot<std::uint32_t> reply;
+    std::thread worker([&request, &reply]() {
+        for (std::uint32_t round = 0U; round < kRounds; ++round)
+        {
+            const Result<std::uint32_t> value = request.take();
+            reply.publish(value.hasValue() ? (*value + 1U) : 0U);
+        }
+    });
+    std::uint64_t sum = 0U;
+    for (std::uint32_t round = 0U; round < kRounds; ++round)
+    {
+        if ((round % 7U) == 0U)
+        {
+            request.publish(createError(Status::ERROR));
+        }
+        else
+        {
+            request.publish(round);
+        }
+        sum += reply.take().getValue();
+    }
+    worker.join();
+
+    std::uint64_t expected = 0U;
+    for (std::uint32_t round = 0U; round < kRounds; ++round)
+    {
+        expected += ((round % 7U) == 0U) ? 0U : (round + 1U);
+    }
+    EXPECT_EQ(sum, expected);
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
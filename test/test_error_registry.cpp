@@ -0,0 +1,177 @@
+#include "lib/error_registry.hpp"
+#include "test/allocation_counter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+enum class NetworkError : std::uint32_t
+{
+    TIMEOUT = 1,
+    REFUSED,
+};
+
+enum class StorageError : std::uint32_t
+{
+    FULL = 1,
+    READ_ONLY,
+};
+
+class ErrorRegistryTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(ErrorRegistryTest, DomainsAreDistinct)
+{
+    EXPECT_EQ(ErrorDomain::of<NetworkError>(), ErrorDomain::of<NetworkError>());
+    EXPECT_NE(ErrorDomain::of<NetworkError>(), ErrorDomain::of<StorageError>());
+}
+
+TEST_F(ErrorRegistryTest, InternAndLookup)
+{
+    ErrorRegistry registry;
+    EXPECT_STREQ(registry.intern(NetworkError::TIMEOUT, "connection timed out"), "connection timed out");
+    EXPECT_STREQ(registry.intern(StorageError::FULL, "disk full"), "disk full");
+
+    // Equal codes of different domains do not clash
+    EXPECT_STREQ(registry.lookup(NetworkError::TIMEOUT), "connection timed out");
+    EXPECT_STREQ(registry.lookup(StorageError::FULL), "disk full");
+    EXPECT_EQ(registry.lookup(NetworkError::REFUSED), nullptr);
+    EXPECT_EQ(registry.size(), 2U);
+}
+
+TEST_F(ErrorRegistryTest, FirstMessageIsKept)
+{
+    ErrorRegistry registry;
+    const char* first = registry.intern(NetworkError::TIMEOUT, "first");
+    EXPECT_EQ(registry.intern(NetworkError::TIMEOUT, "second"), first);
+    EXPECT_STREQ(registry.lookup(NetworkError::TIMEOUT), "first");
+    EXPECT_EQ(registry.size(), 1U);
+}
+
+TEST_F(ErrorRegistryTest, MessageIsCopied)
+{
+    ErrorRegistry registry;
+    std::string message("temporary message");
+    registry.intern(NetworkError::REFUSED, message.c_str());
+    message.assign("overwritten");
+    EXPECT_STREQ(registry.lookup(NetworkError::REFUSED), "temporary message");
+}
+
+TEST_F(ErrorRegistryTest, Describe)
+{
+    ErrorRegistry registry;
+    registry.intern(Status::INVALID_ARG, "invalid argument");
+    EXPECT_STREQ(registry.describe(Status::INVALID_ARG), "invalid argument");
+    EXPECT_STREQ(registry.describe(Status::ERROR), "ERROR");
+    EXPECT_STREQ(registry.describe(StorageError::READ_ONLY), "unknown error");
+}
+
+TEST_F(ErrorRegistryTest, CapacityLimits)
+{
+    ErrorRegistry entries(2U, 1024U);
+    EXPECT_NE(entries.intern(NetworkError::TIMEOUT, "a"), nullptr);
+    EXPECT_NE(entries.intern(NetworkError::REFUSED, "b"), nullptr);
+    EXPECT_EQ(entries.intern(StorageError::FULL, "c"), nullptr);
+    EXPECT_EQ(entries.lookup(StorageError::FULL), nullptr);
+
+    ErrorRegistry bytes(16U, 8U);
+    EXPECT_NE(bytes.intern(NetworkError::TIMEOUT, "1234"), nullptr);
+    EXPECT_EQ(bytes.intern(NetworkError::REFUSED, "1234"), nullptr);  // 3 bytes left only for 2 characters
+    EXPECT_NE(bytes.intern(StorageError::FULL, "12"), nullptr);
+}
+
+TEST_F(ErrorRegistryTest, ManyCodes)
+{
+    ErrorRegistry registry(512U, 16U * 1024U);
+    for (std::uint32_t code = 0U; code < 512U; ++code)
+    {
+        ASSERT_NE(registry.intern(ErrorDomain::of<NetworkError>(), code, std::to_string(code).c_str()), nullptr);
+    }
+    for (std::uint32_t code = 0U; code < 512U; ++code)
+    {
+        EXPECT_EQ(std::string(registry.lookup(ErrorDomain::of<NetworkError>(), code)), std::to_string(code));
+        EXPECT_EQ(registry.lookup(ErrorDomain::of<StorageError>(), code), nullptr);
+    }
+}
+
+TEST_F(ErrorRegistryTest, DescribeDoesNotAllocate)
+{
+    ErrorRegistry registry;
+    registry.intern(NetworkError::TIMEOUT, "connection timed out");
+    const Result<std::uint32_t, NetworkError> result(NetworkError::TIMEOUT);
+
+    const std::size_t before = allocationCount().load();
+    std::size_t length = 0U;
+    for (std::uint32_t i = 0U; i < 1000U; ++i)
+    {
+        length += std::strlen(registry.describe(result.getError()));
+        length += std::strlen(registry.describe(Status::ERROR));
+        length += std::strlen(toString(Status::INVALID_ARG));
+    }
+    EXPECT_EQ(allocationCount().load(), before);
+    EXPECT_GT(length, 0U);
+}
+
+TEST_F(ErrorRegistryTest, GlobalRegistry)
+{
+    ErrorRegistry& registry = ErrorRegistry::global();
+    EXPECT_EQ(&registry, &ErrorRegistry::global());
+    registry.intern(StorageError::READ_ONLY, "read-only file system");
+    EXPECT_STREQ(ErrorRegistry::global().describe(StorageError::READ_ONLY), "read-only file system");
+}
+
+TEST_F(ErrorRegistryTest, ConcurrentLookups)
+{
+    ErrorRegistry registry(256U, 8U * 1024U);
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> mismatches{0U};
+    std::vector<std::thread> readers;
+    for (std::uint32_t reader = 0U; reader < 4U; ++reader)
+    {
+        readers.emplace_back([&registry, &done, &mismatches]() {
+            while (!done.load(std::memory_order_acquire))
+            {
+                for (std::uint32_t code = 0U; code < 256U; ++code)
+                {
+                    const char* message = registry.lookup(ErrorDomain::of<StorageError>(), code);
+                    if ((message != nullptr) && (std::string(message) != ("code " + std::to_string(code))))
+                    {
+                        mismatches.fetch_add(1U);
+                    }
+                }
+            }
+        });
+    }
+    for (std::uint32_t code = 0U; code < 256U; ++code)
+    {
+        registry.intern(ErrorDomain::of<StorageError>(), code, ("code " + std::to_string(code)).c_str());
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    EXPECT_EQ(mismatches.load(), 0U);
+    EXPECT_EQ(registry.size(), 256U);
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
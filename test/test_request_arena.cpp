@@ -0,0 +1,137 @@
+#include "lib/request_arena.hpp"
+#include "lib/rich_error.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+/// @brief Upstream resource counting the blocks allocated by the arena.
+class CountingResource : public std::pmr::memory_resource
+{
+  public:
+    std::size_t allocations_{0U};
+
+  private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        ++allocations_;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+    {
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+class RequestArenaTest : public ::testing::Test
+{
+  protected:
+    // Any allocation bypassing the arena throws std::bad_alloc
+    void SetUp() override { previous_ = std::pmr::set_default_resource(std::pmr::null_memory_resource()); }
+    void TearDown() override { std::pmr::set_default_resource(previous_); }
+
+    std::pmr::memory_resource* previous_{nullptr};
+    CountingResource upstream_;
+    static constexpr const char* kLongMessage = "configuration file is missing the listen address";
+};
+
+TEST_F(RequestArenaTest, ValuesAllocateFromArena)
+{
+    RequestArena arena(4096U, &upstream_);
+    const Result<std::pmr::string> greeting = arena.makeResult<std::pmr::string>(kLongMessage);
+    EXPECT_EQ(*greeting, kLongMessage);
+    EXPECT_EQ(greeting->get_allocator().resource(), arena.resource());
+    EXPECT_EQ(upstream_.allocations_, 1U);  // The first block only
+}
+
+TEST_F(RequestArenaTest, ContainersPassTheirAllocatorOn)
+{
+    RequestArena arena(4096U, &upstream_);
+    std::pmr::vector<Result<std::pmr::string>> results(arena.allocator());
+    results.emplace_back(inPlace, kLongMessage);
+    results.push_back(Result<std::pmr::string>(Status::ERROR));
+    results.resize(3U);
+    EXPECT_EQ(results[0].getValue(), kLongMessage);
+    EXPECT_EQ(results[0]->get_allocator().resource(), arena.resource());
+    EXPECT_EQ(results[1].getError(), Status::ERROR);
+    EXPECT_EQ(results[2]->get_allocator().resource(), arena.resource());
+}
+
+TEST_F(RequestArenaTest, RichErrorMessagesAllocateFromArena)
+{
+    RequestArena arena(4096U, &upstream_);
+    const Result<std::pmr::string, RichError> failed =
+        arena.makeError<std::pmr::string, RichError>(Status::ERROR, kLongMessage);
+    ASSERT_TRUE(failed.getError().isHeapAllocated());
+    EXPECT_STREQ(failed.getError().message(), kLongMessage);
+    EXPECT_EQ(sizeof(RichError), sizeof(Status) + 4U + RichError::kInlineCapacity);
+
+    // Moving within the arena takes the message over, copying without an allocator uses the global heap
+    const RichError moved(RichError(failed.getError(), RichError::allocator_type(arena.resource())),
+                          RichError::allocator_type(arena.resource()));
+    EXPECT_STREQ(moved.message(), kLongMessage);
+    EXPECT_EQ(moved.get_allocator(), RichError::allocator_type(arena.resource()));
+    const RichError copied(failed.getError());
+    EXPECT_STREQ(copied.message(), kLongMessage);
+    EXPECT_EQ(copied.get_allocator(), RichError::allocator_type());
+
+    // Assigning keeps the memory resource of the assigned error
+    RichError assigned(Status::INVALID_ARG, std::string(32, 'z'), RichError::allocator_type(arena.resource()));
+    assigned = copied;
+    EXPECT_STREQ(assigned.message(), kLongMessage);
+    EXPECT_EQ(assigned.get_allocator(), RichError::allocator_type(arena.resource()));
+
+    // Short messages stay inline and do not allocate
+    const RichError inlined(Status::ERROR, "timeout", RichError::allocator_type(arena.resource()));
+    EXPECT_FALSE(inlined.isHeapAllocated());
+}
+
+TEST_F(RequestArenaTest, ResetReusesFirstBlock)
+{
+    RequestArena arena(4096U, &upstream_);
+    const void* first = nullptr;
+    for (int request = 0; request < 3; ++request)
+    {
+        {
+            const Result<std::pmr::string> greeting = arena.makeResult<std::pmr::string>(kLongMessage);
+            if (first == nullptr)
+            {
+                first = greeting->data();
+            }
+            EXPECT_EQ(greeting->data(), first);
+        }
+        arena.reset();
+    }
+    EXPECT_EQ(upstream_.allocations_, 1U);
+}
+
+TEST_F(RequestArenaTest, GrowsBeyondFirstBlock)
+{
+    RequestArena arena(64U, &upstream_);
+    std::pmr::vector<Result<std::pmr::string>> results(arena.allocator());
+    for (int row = 0; row < 32; ++row)
+    {
+        results.emplace_back(inPlace, kLongMessage);
+    }
+    EXPECT_GT(upstream_.allocations_, 1U);
+    EXPECT_EQ(results.back().getValue(), kLongMessage);
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
@@ -1,7 +1,19 @@
 #include "lib/result.hpp"
+#include "test/allocation_counter.hpp"
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 namespace interview
 {
 namespace library
@@ -170,6 +182,1322 @@ TEST_F(ResultTest, NonDefaultConstructibleType)
     EXPECT_EQ(result.getValue().getData(), 42U);
 }
 
+#if !INTERVIEW_RESULT_AUDIT
+// Trivial payloads keep Result trivially copyable and destructible:
+static_assert(std::is_trivially_copyable<Result<std::uint32_t>>::value, "Result<uint32_t> must be trivially copyable");
+static_assert(std::is_trivially_destructible<Result<std::uint32_t>>::value,
+              "Result<uint32_t> must be trivially destructible");
+static_assert(std::is_trivially_copyable<Result<CustomType>>::value, "Result<CustomType> must be trivially copyable");
+#endif
+static_assert(!std::is_trivially_copyable<Result<std::string>>::value,
+              "Result<std::string> must not be trivially copyable");
+static_assert(!std::is_trivially_destructible<Result<std::string>>::value,
+              "Result<std::string> must not be trivially destructible");
+
+TEST_F(ResultTest, NonTrivialCopyConstructor)
+{
+    const Result<std::string> original(std::string("payload"));
+    const Result<std::string> copy(original);
+    EXPECT_TRUE(copy.hasValue());
+    EXPECT_EQ(copy.getValue(), "payload");
+    EXPECT_EQ(original.getValue(), "payload");
+}
+
+TEST_F(ResultTest, NonTrivialMoveConstructor)
+{
+    Result<std::string> original(std::string("payload"));
+    const Result<std::string> moved(std::move(original));
+    EXPECT_TRUE(moved.hasValue());
+    EXPECT_EQ(moved.getValue(), "payload");
+}
+
+// Payload counting its destructions, a destructor run on storage never constructed is counted as well
+int payloadDestructions = 0;
+
+class ThrowingCopyPayload
+{
+  public:
+    ThrowingCopyPayload() = default;
+    ThrowingCopyPayload(const ThrowingCopyPayload& /* other */) { throw std::runtime_error("copy"); }
+    ThrowingCopyPayload(ThrowingCopyPayload&& /* other */) { throw std::runtime_error("move"); }
+    ~ThrowingCopyPayload() { ++payloadDestructions; }
+};
+
+using ThrowingCopyResult = Result<ThrowingCopyPayload>;
+
+TEST_F(ResultTest, ThrowingCopyLeavesNothingToDestruct)
+{
+    ThrowingCopyResult value;
+    // Storage with the bit pattern of a held value, a destructor chosen by an uninitialized flag would run on it
+    alignas(ThrowingCopyResult) unsigned char storage[sizeof(ThrowingCopyResult)];
+    std::memset(storage, 0xFF, sizeof(storage));
+    payloadDestructions = 0;
+    EXPECT_THROW(new (storage) ThrowingCopyResult(value), std::runtime_error);
+    EXPECT_THROW(new (storage) ThrowingCopyResult(std::move(value)), std::runtime_error);
+    EXPECT_EQ(payloadDestructions, 0);
+}
+
+TEST_F(ResultTest, NonTrivialAssignmentChangesState)
+{
+    Result<std::string> result(std::string("payload"));
+    const Result<std::string> failure = createError(Status::ERROR);
+    result = failure;
+    EXPECT_FALSE(result.hasValue());
+    EXPECT_EQ(result.getError(), Status::ERROR);
+
+    result = Result<std::string>(std::string("again"));
+    EXPECT_TRUE(result.hasValue());
+    EXPECT_EQ(result.getValue(), "again");
+}
+
+TEST_F(ResultTest, TrivialResultsInVector)
+{
+    std::vector<Result<std::uint32_t>> results;
+    results.emplace_back(1U);
+    results.emplace_back(Status::INVALID_ARG);
+    results.emplace_back(3U);
+    const std::vector<Result<std::uint32_t>> copy = results;
+    ASSERT_EQ(copy.size(), 3U);
+    EXPECT_EQ(copy[0].getValue(), 1U);
+    EXPECT_EQ(copy[1].getError(), Status::INVALID_ARG);
+    EXPECT_EQ(copy[2].getValue(), 3U);
+}
+
+TEST_F(ResultTest, UncheckedAccess)
+{
+    Result<std::string> result(std::string("payload"));
+    EXPECT_EQ(*result, "payload");
+    EXPECT_EQ(result.valueUnchecked(), "payload");
+    EXPECT_EQ(result->size(), 7U);
+    const std::string moved = *std::move(result);
+    EXPECT_EQ(moved, "payload");
+
+    const Result<std::uint32_t> failure(Status::INVALID_ARG);
+    EXPECT_EQ(failure.errorUnchecked(), Status::INVALID_ARG);
+}
+
+TEST_F(ResultTest, ValueOr)
+{
+    const Result<std::uint32_t> success(42U);
+    const Result<std::uint32_t> failure(Status::ERROR);
+    EXPECT_EQ(success.valueOr(7U), 42U);
+    EXPECT_EQ(failure.valueOr(7U), 7U);
+    EXPECT_EQ(Result<std::string>(std::string("value")).valueOr("default"), "value");
+    EXPECT_EQ(Result<std::string>(Status::ERROR).valueOr("default"), "default");
+}
+
+TEST_F(ResultTest, GetIf)
+{
+    Result<std::uint32_t> success(42U);
+    const Result<std::uint32_t> failure(Status::ERROR);
+    ASSERT_NE(success.getIf(), nullptr);
+    EXPECT_EQ(*success.getIf(), 42U);
+    *success.getIf() = 43U;
+    EXPECT_EQ(success.getValue(), 43U);
+    EXPECT_EQ(failure.getIf(), nullptr);
+}
+
+#if !INTERVIEW_RESULT_AUDIT
+// Compact (niche) storage:
+static_assert(sizeof(Result<std::uint32_t*>) == sizeof(std::uint32_t*), "pointer niche must drop the discriminant");
+static_assert(sizeof(Result<const CustomType*>) == sizeof(const CustomType*),
+              "pointer niche must drop the discriminant");
+static_assert(std::is_trivially_copyable<Result<std::uint32_t*>>::value, "niche storage must be trivially copyable");
+#endif
+
+TEST_F(ResultTest, NichePointerValue)
+{
+    std::uint32_t data = 42U;
+    const Result<std::uint32_t*> result(&data);
+    EXPECT_TRUE(result.hasValue());
+    EXPECT_EQ(result.getValue(), &data);
+    EXPECT_EQ(*result.getValue(), 42U);
+}
+
+TEST_F(ResultTest, NichePointerNullIsValue)
+{
+    const Result<std::uint32_t*> result(nullptr);
+    EXPECT_TRUE(result.hasValue());
+    EXPECT_EQ(result.getValue(), nullptr);
+}
+
+TEST_F(ResultTest, NichePointerError)
+{
+    const Result<std::uint32_t*> invalid = createError(Status::INVALID_ARG);
+    const Result<std::uint32_t*> error(Status::ERROR);
+    EXPECT_FALSE(invalid.hasValue());
+    EXPECT_FALSE(error.hasValue());
+    EXPECT_EQ(invalid.getError(), Status::INVALID_ARG);
+    EXPECT_EQ(error.getError(), Status::ERROR);
+    EXPECT_THROW(invalid.getValue(), std::runtime_error);
+    EXPECT_EQ(invalid.getIf(), nullptr);
+}
+
+TEST_F(ResultTest, NichePointerSentinelIsValue)
+{
+    // Only the lowest addresses encode the error codes, other addresses of the first page are legal values
+    char* const sentinel = reinterpret_cast<char*>(16);
+    const Result<char*> result(sentinel);
+    EXPECT_TRUE(result.hasValue());
+    EXPECT_EQ(result.getValue(), sentinel);
+}
+
+TEST_F(ResultTest, NichePointerOutOfRangeErrorCode)
+{
+    // Codes past the first memory page named a regular pointer, they are asserted or mapped to the last code instead
+#ifdef NDEBUG
+    const Result<std::uint32_t*> result = createError(static_cast<Status>(5000));
+    EXPECT_FALSE(result.hasValue());
+    EXPECT_EQ(result.getError(), Status::ERROR);
+#else
+    EXPECT_DEATH(static_cast<void>(Result<std::uint32_t*>(createError(static_cast<Status>(5000)))), "out of the range");
+#endif
+}
+
+TEST_F(ResultTest, NichePointerAssignment)
+{
+    std::uint32_t data = 42U;
+    Result<std::uint32_t*> result(&data);
+    result = Result<std::uint32_t*>(Status::ERROR);
+    EXPECT_EQ(result.getError(), Status::ERROR);
+    result = Result<std::uint32_t*>(&data);
+    EXPECT_EQ(result.getValue(), &data);
+}
+
+/// @brief Enumeration using only 3 of the 256 representations of its underlying type.
+enum class Color : std::uint8_t
+{
+    RED,
+    GREEN,
+    BLUE
+};
+
+}  // namespace test
+
+template <>
+struct ResultNicheTraits<test::Color>
+{
+    static constexpr std::size_t kCount = 253U;
+
+    static test::Color fromIndex(std::size_t index) noexcept { return static_cast<test::Color>(index + 3U); }
+
+    static std::size_t toIndex(const test::Color& value) noexcept
+    {
+        const std::size_t raw = static_cast<std::size_t>(value);
+        return (raw >= 3U) ? raw - 3U : kCount;
+    }
+};
+
+namespace test
+{
+
+#if !INTERVIEW_RESULT_AUDIT
+static_assert(sizeof(Result<Color>) == sizeof(Color), "enumeration niche must drop the discriminant");
+#endif
+
+TEST_F(ResultTest, NicheEnumeration)
+{
+    const Result<Color> value(Color::BLUE);
+    const Result<Color> error = createError(Status::INVALID_ARG);
+    EXPECT_TRUE(value.hasValue());
+    EXPECT_EQ(value.getValue(), Color::BLUE);
+    EXPECT_FALSE(error.hasValue());
+    EXPECT_EQ(error.getError(), Status::INVALID_ARG);
+}
+
+#if !INTERVIEW_RESULT_AUDIT
+// Packed storage:
+static_assert(sizeof(Result<std::uint8_t>) == 2U, "discriminant and error code must share the tag byte");
+static_assert(sizeof(Result<std::uint16_t>) == 4U, "discriminant and error code must share the tag byte");
+static_assert(sizeof(Result<std::uint32_t>) == 8U, "discriminant and error code must share the tag byte");
+static_assert(std::is_trivially_copyable<Result<std::uint16_t>>::value, "packed storage must be trivially copyable");
+#endif
+static_assert(sizeof(Result<std::string>) > sizeof(std::string), "non-trivial payloads keep the flag");
+
+TEST_F(ResultTest, PackedValueAndError)
+{
+    Result<std::uint16_t> result(std::uint16_t{0xFFFFU});
+    EXPECT_TRUE(result.hasValue());
+    EXPECT_EQ(result.getValue(), 0xFFFFU);
+    result.getValue() = 7U;
+    EXPECT_EQ(*result, 7U);
+
+    const Result<std::uint16_t> invalid = createError(Status::INVALID_ARG);
+    const Result<std::uint16_t> error(Status::ERROR);
+    const Result<std::uint16_t> ok(Status::OK);
+    EXPECT_EQ(invalid.getError(), Status::INVALID_ARG);
+    EXPECT_EQ(error.getError(), Status::ERROR);
+    EXPECT_FALSE(ok.hasValue());
+    EXPECT_EQ(ok.getError(), Status::OK);
+    EXPECT_THROW(invalid.getValue(), std::runtime_error);
+}
+
+TEST_F(ResultTest, PackedAssignmentAndSwap)
+{
+    Result<std::uint16_t> result(std::uint16_t{42U});
+    Result<std::uint16_t> other(Status::ERROR);
+    result.swap(other);
+    EXPECT_EQ(result.getError(), Status::ERROR);
+    EXPECT_EQ(other.getValue(), 42U);
+
+    result = other;
+    EXPECT_EQ(result.getValue(), 42U);
+    result = Result<std::uint16_t>(Status::INVALID_ARG);
+    EXPECT_EQ(result.getError(), Status::INVALID_ARG);
+    EXPECT_EQ(result.emplace(std::uint16_t{9U}), 9U);
+    EXPECT_EQ(result.getValue(), 9U);
+}
+
+TEST_F(ResultTest, PackedOutOfRangeErrorCode)
+{
+    // Codes past the tag byte wrapped into the value tag, they are asserted or mapped to the last code instead
+#ifdef NDEBUG
+    const Result<std::uint16_t> result = createError(static_cast<Status>(255));
+    EXPECT_FALSE(result.hasValue());
+    EXPECT_EQ(result.getError(), Status::ERROR);
+#else
+    EXPECT_DEATH(static_cast<void>(Result<std::uint16_t>(createError(static_cast<Status>(255)))), "out of the range");
+#endif
+}
+
+/// @brief Error enumeration of a columnar validator, declared with the narrowest underlying type.
+enum class FieldError : std::uint8_t
+{
+    MISSING,
+    OUT_OF_RANGE,
+    MALFORMED
+};
+
+}  // namespace test
+
+template <>
+struct ResultErrorCodeTraits<test::FieldError>
+{
+    static constexpr std::size_t kCount = 3U;
+};
+
+namespace test
+{
+
+#if !INTERVIEW_RESULT_AUDIT
+static_assert(sizeof(Result<std::uint16_t, FieldError>) == 4U, "own error codes must be packed");
+static_assert(sizeof(Result<double, FieldError>) == 16U, "the tag byte is padded to the alignment of the value");
+#endif
+
+#if INTERVIEW_RESULT_HAS_CONSTEXPR
+constexpr Result<std::uint16_t, FieldError> parseDigit(char digit)
+{
+    if ((digit < '0') || (digit > '9'))
+    {
+        return createError(FieldError::MALFORMED);
+    }
+    return static_cast<std::uint16_t>(digit - '0');
+}
+
+static_assert(parseDigit('7').getValue() == 7U, "packed storage must be usable in constant expressions");
+static_assert(parseDigit('x').getError() == FieldError::MALFORMED, "packed error must be decoded at compile time");
+#endif
+
+TEST_F(ResultTest, PackedOwnErrorCodes)
+{
+    std::vector<Result<std::uint16_t, FieldError>> column{Result<std::uint16_t, FieldError>(4U),
+                                                          createError(FieldError::MALFORMED),
+                                                          createError(FieldError::OUT_OF_RANGE)};
+    EXPECT_EQ(column[0].getValue(), 4U);
+    EXPECT_EQ(column[1].getError(), FieldError::MALFORMED);
+    EXPECT_EQ(column[2].getError(), FieldError::OUT_OF_RANGE);
+    EXPECT_EQ(column[2].mapError([](FieldError) { return FieldError::MISSING; }).getError(), FieldError::MISSING);
+}
+
+// Combinators:
+Result<std::uint32_t> halve(std::uint32_t value)
+{
+    if ((value % 2U) != 0U)
+    {
+        return createError(Status::INVALID_ARG);
+    }
+    return value / 2U;
+}
+
+TEST_F(ResultTest, MapValue)
+{
+    const Result<std::uint32_t> result(21U);
+    const Result<std::string> mapped = result.map([](std::uint32_t value) { return std::to_string(value * 2U); });
+    EXPECT_EQ(mapped.getValue(), "42");
+}
+
+TEST_F(ResultTest, MapForwardsError)
+{
+    const Result<std::uint32_t> result(Status::ERROR);
+    bool called = false;
+    const auto mapped = result.map([&called](std::uint32_t value) {
+        called = true;
+        return value;
+    });
+    EXPECT_FALSE(called);
+    EXPECT_EQ(mapped.getError(), Status::ERROR);
+}
+
+TEST_F(ResultTest, TransformIsMap)
+{
+    const auto transformed = Result<std::uint32_t>(2U).transform([](std::uint32_t value) { return value + 1U; });
+    EXPECT_EQ(transformed.getValue(), 3U);
+}
+
+TEST_F(ResultTest, MapMovesOutOfRvalue)
+{
+    Result<std::string> result(std::string(64, 'x'));
+    const auto size = std::move(result).map([](std::string&& value) {
+        const std::string stolen(std::move(value));
+        return stolen.size();
+    });
+    EXPECT_EQ(size.getValue(), 64U);
+    EXPECT_TRUE(result.getValue().empty());
+}
+
+TEST_F(ResultTest, AndThenChain)
+{
+    const auto success = Result<std::uint32_t>(8U).andThen(halve).andThen(halve).andThen(halve);
+    EXPECT_EQ(success.getValue(), 1U);
+
+    const auto failure = Result<std::uint32_t>(6U).andThen(halve).andThen(halve).andThen(halve);
+    EXPECT_EQ(failure.getError(), Status::INVALID_ARG);
+}
+
+TEST_F(ResultTest, MapErrorValueForwarded)
+{
+    const auto result = Result<std::uint32_t>(7U).mapError([](Status) { return Status::ERROR; });
+    EXPECT_EQ(result.getValue(), 7U);
+}
+
+TEST_F(ResultTest, MapErrorMapsError)
+{
+    const auto result = Result<std::uint32_t>(Status::INVALID_ARG).mapError([](Status status) {
+        return (status == Status::INVALID_ARG) ? Status::ERROR : status;
+    });
+    EXPECT_EQ(result.getError(), Status::ERROR);
+}
+
+TEST_F(ResultTest, OrElseRecovers)
+{
+    const auto recovered =
+        Result<std::uint32_t>(Status::INVALID_ARG).orElse([](Status) { return Result<std::uint32_t>(0U); });
+    EXPECT_EQ(recovered.getValue(), 0U);
+
+    bool called = false;
+    const auto untouched = Result<std::uint32_t>(5U).orElse([&called](Status status) {
+        called = true;
+        return Result<std::uint32_t>(std::move(status));
+    });
+    EXPECT_FALSE(called);
+    EXPECT_EQ(untouched.getValue(), 5U);
+}
+
+TEST_F(ResultTest, CombinatorsOnNicheStorage)
+{
+    std::uint32_t data = 42U;
+    const auto value = Result<std::uint32_t*>(&data).map([](std::uint32_t* pointer) { return *pointer; });
+    EXPECT_EQ(value.getValue(), 42U);
+    const auto error =
+        Result<std::uint32_t*>(Status::ERROR).map([](std::uint32_t* pointer) { return *pointer; });
+    EXPECT_EQ(error.getError(), Status::ERROR);
+}
+
+static_assert(sizeof(Result<std::uint32_t>) == 8U, "combinators must not add to the size of Result");
+
+// Error propagation:
+Result<std::uint32_t> quarter(std::uint32_t value)
+{
+    RESULT_TRY(const std::uint32_t half, halve(value));
+    RESULT_TRY(const std::uint32_t result, halve(half));
+    return result;
+}
+
+Result<std::size_t> stringLength(const Result<std::string>& input)
+{
+    RESULT_TRY(const std::string copy, input);  // lvalue is copied, not moved
+    return copy.size();
+}
+
+Result<std::string> takeString(Result<std::string>&& input)
+{
+    RESULT_TRY(std::string value, std::move(input));
+    return value + "!";
+}
+
+TEST_F(ResultTest, TryPropagatesValue)
+{
+    EXPECT_EQ(quarter(8U).getValue(), 2U);
+}
+
+TEST_F(ResultTest, TryPropagatesError)
+{
+    EXPECT_EQ(quarter(6U).getError(), Status::INVALID_ARG);
+    EXPECT_EQ(quarter(7U).getError(), Status::INVALID_ARG);
+}
+
+TEST_F(ResultTest, TryCopiesFromLValue)
+{
+    const Result<std::string> input(std::string("abc"));
+    EXPECT_EQ(stringLength(input).getValue(), 3U);
+    EXPECT_EQ(input.getValue(), "abc");
+    EXPECT_EQ(stringLength(Result<std::string>(Status::ERROR)).getError(), Status::ERROR);
+}
+
+TEST_F(ResultTest, TryMovesFromRValue)
+{
+    Result<std::string> input(std::string(64, 'x'));
+    EXPECT_EQ(takeString(std::move(input)).getValue(), std::string(64, 'x') + "!");
+    EXPECT_TRUE(input.getValue().empty());
+}
+
+#if INTERVIEW_RESULT_HAS_COROUTINES
+Result<std::uint32_t> quarterCoroutine(std::uint32_t value)
+{
+    const std::uint32_t half = co_await halve(value);
+    co_return co_await halve(half);
+}
+
+Result<std::string> describeCoroutine(std::uint32_t value)
+{
+    const std::uint32_t result = co_await quarterCoroutine(value);
+    co_return std::to_string(result);
+}
+
+TEST_F(ResultTest, CoroutineValue)
+{
+    EXPECT_EQ(quarterCoroutine(8U).getValue(), 2U);
+    EXPECT_EQ(describeCoroutine(16U).getValue(), "4");
+}
+
+TEST_F(ResultTest, CoroutineError)
+{
+    EXPECT_EQ(quarterCoroutine(6U).getError(), Status::INVALID_ARG);
+    EXPECT_EQ(describeCoroutine(7U).getError(), Status::INVALID_ARG);
+}
+
+TEST_F(ResultTest, CoroutineFramesAreReused)
+{
+    // GCC allocates the frames, the promise takes them from the cache of the thread after the first call
+    EXPECT_EQ(quarterCoroutine(8U).getValue(), 2U);
+    const std::size_t before = allocationCount().load();
+    for (std::uint32_t call = 0U; call < 100U; ++call)
+    {
+        EXPECT_TRUE(quarterCoroutine(8U).hasValue());
+        EXPECT_FALSE(quarterCoroutine(6U).hasValue());
+        EXPECT_FALSE(quarterCoroutine(7U).hasValue());
+    }
+    EXPECT_EQ(allocationCount().load(), before);
+}
+#endif
+
+#if INTERVIEW_RESULT_HAS_CONSTEXPR
+// Compile-time evaluation:
+constexpr Result<std::uint32_t> constexprDivide(std::uint32_t a, std::uint32_t b)
+{
+    if (b == 0U)
+    {
+        return createError(Status::INVALID_ARG);
+    }
+    return a / b;
+}
+
+constexpr std::uint32_t constexprTwice(std::uint32_t value)
+{
+    return value * 2U;
+}
+
+static_assert(constexprDivide(10U, 2U).getValue() == 5U, "constexpr value");
+static_assert(constexprDivide(10U, 0U).getError() == Status::INVALID_ARG, "constexpr error");
+static_assert(constexprDivide(10U, 2U).map(constexprTwice).valueOr(0U) == 10U, "constexpr combinator");
+static_assert(!constexprDivide(10U, 0U).map(constexprTwice).hasValue(), "constexpr combinator error");
+
+/// @brief Descriptor of a protocol field, tables of them are validated at compile time.
+struct FieldDescriptor
+{
+    std::uint32_t offset;
+    std::uint32_t size;
+};
+
+template <std::size_t N>
+constexpr Result<std::uint32_t> validateLayout(const FieldDescriptor (&fields)[N])
+{
+    std::uint32_t end = 0U;
+    for (std::size_t index = 0U; index < N; ++index)
+    {
+        if ((fields[index].offset != end) || (fields[index].size == 0U))
+        {
+            return createError(Status::INVALID_ARG);
+        }
+        end = fields[index].offset + fields[index].size;
+    }
+    return end;
+}
+
+constexpr FieldDescriptor kValidLayout[] = {{0U, 4U}, {4U, 2U}, {6U, 2U}};
+constexpr FieldDescriptor kOverlappingLayout[] = {{0U, 4U}, {2U, 2U}};
+static_assert(validateLayout(kValidLayout).getValue() == 8U, "valid layout");
+static_assert(validateLayout(kOverlappingLayout).getError() == Status::INVALID_ARG, "overlapping layout");
+#endif
+
+#if __cplusplus >= 202002L
+constexpr bool nonTrivialResultAtCompileTime()
+{
+    Result<std::string> result(std::string("compile time"));
+    Result<std::string> copy(result);
+    copy = createError(Status::ERROR);
+    const bool copied = (copy.getError() == Status::ERROR) && (result.getValue() == "compile time");
+    result = std::move(copy);
+    const auto size = result.orElse([](Status) { return Result<std::string>(std::string("recovered")); })
+                          .map([](const std::string& value) { return value.size(); });
+    return copied && !result.hasValue() && (size.getValue() == 9U);
+}
+static_assert(nonTrivialResultAtCompileTime(), "Result<std::string> must be usable in constant expressions");
+#endif
+
+TEST_F(ResultTest, StatusToString)
+{
+    static_assert(toString(Status::OK)[0] == 'O', "toString must be usable at compile time");
+    EXPECT_STREQ(toString(Status::OK), "OK");
+    EXPECT_STREQ(toString(Status::INVALID_ARG), "INVALID_ARG");
+    EXPECT_STREQ(toString(Status::ERROR), "ERROR");
+    EXPECT_STREQ(toString(static_cast<Status>(42U)), "UNKNOWN");
+}
+
+TEST_F(ResultTest, BadAccessExceptionSharesMessage)
+{
+    const Result<std::uint32_t> result(Status::ERROR);
+    const char* first = nullptr;
+    const char* second = nullptr;
+    try
+    {
+        (void)result.getValue();
+    }
+    catch (const std::runtime_error& error)
+    {
+        first = error.what();
+    }
+    try
+    {
+        (void)result.getValue();
+    }
+    catch (const std::runtime_error& error)
+    {
+        second = error.what();
+    }
+    ASSERT_NE(first, nullptr);
+    EXPECT_STREQ(first, "No value");
+    EXPECT_EQ(first, second);  // The message is not copied for each throw
+}
+
+// Results without a value and results referring to objects:
+#if !INTERVIEW_RESULT_AUDIT
+static_assert(sizeof(Result<void>) == sizeof(Status), "Result<void> must store the status only");
+static_assert(std::is_trivially_copyable<Result<void>>::value, "Result<void> must be trivially copyable");
+static_assert(sizeof(Result<std::uint32_t&>) == sizeof(std::uint32_t*), "Result<T&> must store the address only");
+static_assert(std::is_trivially_copyable<Result<std::uint32_t&>>::value, "Result<T&> must be trivially copyable");
+#endif
+static_assert(!std::is_constructible<Result<const std::uint32_t&>, std::uint32_t&&>::value,
+              "Result<T&> must not bind temporaries");
+static_assert(!std::is_constructible<Result<std::uint32_t&>, const std::uint32_t&>::value,
+              "Result<T&> must not drop const");
+
+Result<void> checkEven(std::uint32_t value)
+{
+    if ((value % 2U) != 0U)
+    {
+        return createError(Status::INVALID_ARG);
+    }
+    return {};
+}
+
+TEST_F(ResultTest, VoidResult)
+{
+    const Result<void> success = checkEven(4U);
+    EXPECT_TRUE(success.hasValue());
+    EXPECT_TRUE(static_cast<bool>(success));
+    EXPECT_NO_THROW(success.getValue());
+    EXPECT_THROW(success.getError(), std::runtime_error);
+
+    const Result<void> failure = checkEven(3U);
+    EXPECT_FALSE(failure.hasValue());
+    EXPECT_EQ(failure.getError(), Status::INVALID_ARG);
+    EXPECT_THROW(failure.getValue(), std::runtime_error);
+
+    Result<void> assigned = success;
+    assigned = failure;
+    EXPECT_EQ(assigned.errorUnchecked(), Status::INVALID_ARG);
+}
+
+TEST_F(ResultTest, VoidResultOkError)
+{
+    // Status::OK is the spare representation encoding the success of Result<void>
+#ifdef NDEBUG
+    const Result<void> result = createError(Status::OK);
+    EXPECT_TRUE(result.hasValue());
+#else
+    EXPECT_DEATH(static_cast<void>(Result<void>(createError(Status::OK))), "spare representation");
+#endif
+}
+
+TEST_F(ResultTest, VoidResultWithNonTrivialError)
+{
+    const Result<void, std::string> success;
+    EXPECT_TRUE(success.hasValue());
+
+    Result<void, std::string> failure(std::string("failed"));
+    EXPECT_EQ(failure.getError(), "failed");
+    const std::string moved = std::move(failure).getError();
+    EXPECT_EQ(moved, "failed");
+}
+
+TEST_F(ResultTest, VoidResultCombinators)
+{
+    const auto mapped = checkEven(2U).map([]() { return 7U; });
+    static_assert(std::is_same<std::decay_t<decltype(mapped)>, Result<std::uint32_t>>::value, "map of void");
+    EXPECT_EQ(mapped.getValue(), 7U);
+
+    const auto chained = checkEven(2U).andThen([]() { return checkEven(5U); });
+    EXPECT_EQ(chained.getError(), Status::INVALID_ARG);
+
+    std::uint32_t calls = 0U;
+    const Result<void> counted = halve(4U).map([&calls](std::uint32_t) { ++calls; });
+    EXPECT_TRUE(counted.hasValue());
+    EXPECT_EQ(calls, 1U);
+
+    const auto described = checkEven(3U).mapError([](Status status) { return std::string(toString(status)); });
+    EXPECT_EQ(described.getError(), "INVALID_ARG");
+    const Result<void> recovered = checkEven(3U).orElse([](Status) { return Result<void>(); });
+    EXPECT_TRUE(recovered.hasValue());
+}
+
+TEST_F(ResultTest, ReferenceResult)
+{
+    std::uint32_t value = 3U;
+    const Result<std::uint32_t&> result(value);
+    ASSERT_TRUE(result.hasValue());
+    EXPECT_EQ(&result.getValue(), &value);
+    EXPECT_EQ(result.getIf(), &value);
+    result.getValue() = 5U;  // Shallow like a pointer
+    EXPECT_EQ(value, 5U);
+    EXPECT_THROW(result.getError(), std::runtime_error);
+
+    std::uint32_t fallback = 0U;
+    const Result<std::uint32_t&> failure(Status::ERROR);
+    EXPECT_EQ(failure.getError(), Status::ERROR);
+    EXPECT_EQ(failure.getIf(), nullptr);
+    EXPECT_EQ(&failure.valueOr(fallback), &fallback);
+    EXPECT_THROW(failure.getValue(), std::runtime_error);
+
+    // Every code is distinguished from a value, the first one is encoded as nullptr
+    const Result<std::uint32_t&> ok(Status::OK);
+    EXPECT_FALSE(ok.hasValue());
+    EXPECT_EQ(ok.getError(), Status::OK);
+}
+
+TEST_F(ResultTest, ReferenceResultRebinds)
+{
+    std::string first = "first";
+    std::string second = "second";
+    Result<std::string&> result(first);
+    result = Result<std::string&>(second);
+    EXPECT_EQ(result->size(), 6U);
+    EXPECT_EQ(first, "first");
+    EXPECT_EQ(&*result, &second);
+
+    const std::uint32_t value = 1U;
+    Result<const std::uint32_t&, std::string> rich(value);
+    EXPECT_EQ(rich.getValue(), 1U);
+    rich = std::string("failed");
+    EXPECT_EQ(rich.getError(), "failed");
+}
+
+TEST_F(ResultTest, ReferenceResultCombinators)
+{
+    std::vector<std::uint32_t> values{1U, 2U, 3U};
+    const auto at = [&values](std::size_t index) -> Result<std::uint32_t&> {
+        if (index >= values.size())
+        {
+            return createError(Status::INVALID_ARG);
+        }
+        return values[index];
+    };
+    EXPECT_EQ(at(1U).map([](std::uint32_t& value) { return value * 10U; }).getValue(), 20U);
+    EXPECT_EQ(at(5U).map([](std::uint32_t& value) { return value; }).getError(), Status::INVALID_ARG);
+
+    const Result<std::uint32_t&, std::string> mapped =
+        at(2U).mapError([](Status status) { return std::string(toString(status)); });
+    EXPECT_EQ(&mapped.getValue(), &values[2U]);
+    const Result<std::uint32_t&> recovered = at(5U).orElse([&values](Status) -> Result<std::uint32_t&> {
+        return values.front();
+    });
+    EXPECT_EQ(&recovered.getValue(), &values[0U]);
+}
+
+Result<std::uint32_t> incrementTry(Result<std::uint32_t&> reference)
+{
+    RESULT_TRY(const std::uint32_t value, reference);
+    return value + 1U;
+}
+
+TEST_F(ResultTest, TryOnReference)
+{
+    std::uint32_t value = 1U;
+    EXPECT_EQ(incrementTry(value).getValue(), 2U);
+    EXPECT_EQ(incrementTry(Status::ERROR).getError(), Status::ERROR);
+}
+
+#if INTERVIEW_RESULT_HAS_COROUTINES
+Result<void> checkQuarterCoroutine(std::uint32_t value)
+{
+    co_await quarterCoroutine(value);
+    co_await checkEven(value);
+    co_return;
+}
+
+TEST_F(ResultTest, CoroutineVoid)
+{
+    EXPECT_TRUE(checkQuarterCoroutine(8U).hasValue());
+    EXPECT_EQ(checkQuarterCoroutine(6U).getError(), Status::INVALID_ARG);
+}
+#endif
+
+// In-place construction:
+struct ConstructionCounters
+{
+    std::uint32_t constructions_{0U};
+    std::uint32_t copies_{0U};
+    std::uint32_t moves_{0U};
+    std::uint32_t assignments_{0U};
+};
+
+/// @brief Payload counting how it is constructed.
+class CountingPayload
+{
+  public:
+    CountingPayload(ConstructionCounters& counters, std::uint32_t value) : counters_(&counters), value_(value)
+    {
+        ++counters_->constructions_;
+    }
+    CountingPayload(const CountingPayload& other) : counters_(other.counters_), value_(other.value_)
+    {
+        ++counters_->copies_;
+    }
+    CountingPayload(CountingPayload&& other) noexcept : counters_(other.counters_), value_(other.value_)
+    {
+        ++counters_->moves_;
+    }
+    CountingPayload& operator=(const CountingPayload& other)
+    {
+        value_ = other.value_;
+        ++counters_->assignments_;
+        return *this;
+    }
+    CountingPayload& operator=(CountingPayload&& other) noexcept
+    {
+        value_ = other.value_;
+        ++counters_->assignments_;
+        return *this;
+    }
+
+    std::uint32_t value() const { return value_; }
+
+  private:
+    ConstructionCounters* counters_;
+    std::uint32_t value_;
+};
+
+/// @brief Payload whose constructor throws on request.
+struct ThrowingPayload
+{
+    explicit ThrowingPayload(bool doThrow)
+    {
+        if (doThrow)
+        {
+            throw std::runtime_error("construction failed");
+        }
+    }
+};
+
+#if INTERVIEW_RESULT_HAS_CONSTEXPR
+constexpr Result<std::uint32_t> constexprInPlace = makeResult<std::uint32_t>(7U);
+static_assert(constexprInPlace.getValue() == 7U, "makeResult must be usable in constant expressions");
+#endif
+static_assert(!std::is_convertible<InPlace, Result<std::uint32_t>>::value, "In-place construction must be explicit");
+
+TEST_F(ResultTest, InPlaceValue)
+{
+    ConstructionCounters counters;
+    const Result<CountingPayload> result(inPlace, counters, 5U);
+    EXPECT_EQ(result.getValue().value(), 5U);
+    EXPECT_EQ(counters.constructions_, 1U);
+    EXPECT_EQ(counters.copies_, 0U);
+    EXPECT_EQ(counters.moves_, 0U);
+
+    const Result<std::vector<std::uint32_t>> filled(inPlace, 3U, 7U);
+    EXPECT_EQ(filled.getValue(), std::vector<std::uint32_t>(3U, 7U));
+}
+
+TEST_F(ResultTest, InPlaceError)
+{
+    const Result<std::uint32_t, std::string> result(inPlaceError, 3U, 'x');
+    EXPECT_EQ(result.getError(), "xxx");
+
+    const Result<void, std::string> failure(inPlaceError, "failed");
+    EXPECT_EQ(failure.getError(), "failed");
+
+    const Result<std::uint32_t&, std::string> reference(inPlaceError, 2U, 'y');
+    EXPECT_EQ(reference.getError(), "yy");
+}
+
+TEST_F(ResultTest, Emplace)
+{
+    Result<std::string> result(Status::ERROR);
+    std::string& value = result.emplace(3U, 'a');
+    EXPECT_EQ(&value, &result.getValue());
+    EXPECT_EQ(value, "aaa");
+    result.emplace("replaced");
+    EXPECT_EQ(result.getValue(), "replaced");
+
+    Result<std::uint32_t*> pointer(Status::INVALID_ARG);  // Compact storage
+    std::uint32_t target = 1U;
+    EXPECT_EQ(pointer.emplace(&target), &target);
+    EXPECT_EQ(pointer.getValue(), &target);
+
+    Result<void> success(Status::ERROR);
+    success.emplace();
+    EXPECT_TRUE(success.hasValue());
+    Result<void, std::string> cleared(std::string("failed"));
+    cleared.emplace();
+    EXPECT_TRUE(cleared.hasValue());
+}
+
+TEST_F(ResultTest, EmplaceThrowingKeepsState)
+{
+    Result<ThrowingPayload, std::string> result(std::string("kept"));
+    EXPECT_THROW(result.emplace(true), std::runtime_error);
+    EXPECT_EQ(result.getError(), "kept");
+    result.emplace(false);
+    EXPECT_TRUE(result.hasValue());
+}
+
+TEST_F(ResultTest, MakeResult)
+{
+    ConstructionCounters counters;
+    const auto result = makeResult<CountingPayload>(counters, 9U);
+    static_assert(std::is_same<std::decay_t<decltype(result)>, Result<CountingPayload>>::value, "makeResult type");
+    EXPECT_EQ(result.getValue().value(), 9U);
+    EXPECT_EQ(counters.constructions_, 1U);
+    EXPECT_EQ(counters.copies_, 0U);
+#if __cplusplus >= 201703L
+    EXPECT_EQ(counters.moves_, 0U);  // Guaranteed copy elision
+#endif
+
+    const auto rich = makeResult<std::string, std::uint32_t>(2U, 'z');
+    EXPECT_EQ(rich.getValue(), "zz");
+    EXPECT_TRUE(makeResult<void>().hasValue());
+}
+
+#if __cplusplus >= 201703L
+/// @brief Payload which can be neither copied nor moved.
+class PinnedPayload
+{
+  public:
+    explicit PinnedPayload(std::uint32_t value) : value_(value) {}
+    PinnedPayload(const PinnedPayload&) = delete;
+    PinnedPayload& operator=(const PinnedPayload&) = delete;
+
+    std::uint32_t value() const { return value_; }
+
+  private:
+    std::uint32_t value_;
+};
+
+Result<PinnedPayload> makePinned(std::uint32_t value)
+{
+    return makeResult<PinnedPayload>(value);
+}
+
+TEST_F(ResultTest, MakeResultOfPinnedPayload)
+{
+    const Result<PinnedPayload> result = makePinned(4U);
+    EXPECT_EQ(result.getValue().value(), 4U);
+}
+#endif
+
+// Assignment:
+/// @brief Payload whose copy constructor throws on request, the move constructor is `noexcept(NothrowMove)`.
+template <bool NothrowMove>
+struct ThrowingCopy
+{
+    explicit ThrowingCopy(bool throwOnCopy) : throwOnCopy_(throwOnCopy) {}
+    ThrowingCopy(const ThrowingCopy& other) : throwOnCopy_(other.throwOnCopy_)
+    {
+        if (throwOnCopy_)
+        {
+            throw std::runtime_error("copy failed");
+        }
+    }
+    ThrowingCopy(ThrowingCopy&& other) noexcept(NothrowMove) : throwOnCopy_(other.throwOnCopy_) {}
+    ThrowingCopy& operator=(const ThrowingCopy&) = default;
+    ThrowingCopy& operator=(ThrowingCopy&&) = default;
+
+    bool throwOnCopy_;
+};
+
+TEST_F(ResultTest, AssignmentReusesValueStorage)
+{
+    Result<std::string> slot(std::string(100U, 'x'));
+    const char* buffer = slot->data();
+    const Result<std::string> request(std::string(20U, 'y'));
+    slot = request;
+    EXPECT_EQ(slot.getValue(), request.getValue());
+    EXPECT_EQ(slot->data(), buffer);
+
+    Result<std::vector<std::uint32_t>> values(inPlace);
+    values->reserve(64U);
+    const std::uint32_t* data = values->data();
+    const Result<std::vector<std::uint32_t>> source(std::vector<std::uint32_t>{1U, 2U, 3U});
+    values = source;
+    EXPECT_EQ(values.getValue(), source.getValue());
+    EXPECT_EQ(values->data(), data);
+}
+
+TEST_F(ResultTest, AssignmentOfSameStateAssigns)
+{
+    ConstructionCounters counters;
+    Result<CountingPayload> target(inPlace, counters, 1U);
+    const Result<CountingPayload> source(inPlace, counters, 2U);
+    target = source;
+    EXPECT_EQ(target.getValue().value(), 2U);
+    target = Result<CountingPayload>(inPlace, counters, 3U);
+    EXPECT_EQ(target.getValue().value(), 3U);
+    EXPECT_EQ(counters.assignments_, 2U);
+    EXPECT_EQ(counters.copies_, 0U);
+    EXPECT_EQ(counters.moves_, 0U);
+}
+
+TEST_F(ResultTest, AssignmentChangingStateIsStrong)
+{
+    // The value is constructed aside and moved in
+    Result<ThrowingCopy<true>, std::string> movable(std::string("kept"));
+    const Result<ThrowingCopy<true>, std::string> failingMovable(inPlace, true);
+    EXPECT_THROW(movable = failingMovable, std::runtime_error);
+    EXPECT_EQ(movable.getError(), "kept");
+
+    // The error is moved aside and restored
+    Result<ThrowingCopy<false>, std::string> backedUp(std::string("kept"));
+    const Result<ThrowingCopy<false>, std::string> failingBackedUp(inPlace, true);
+    EXPECT_THROW(backedUp = failingBackedUp, std::runtime_error);
+    EXPECT_EQ(backedUp.getError(), "kept");
+    backedUp = Result<ThrowingCopy<false>, std::string>(inPlace, false);
+    EXPECT_TRUE(backedUp.hasValue());
+
+    Result<std::string, ThrowingCopy<false>> value(std::string("kept"));
+    const Result<std::string, ThrowingCopy<false>> failingError(inPlaceError, true);
+    EXPECT_THROW(value = failingError, std::runtime_error);
+    EXPECT_EQ(value.getValue(), "kept");
+}
+
+// Swap, comparison and hashing:
+/// @brief Payload whose move constructor throws on request.
+struct ThrowingMove
+{
+    explicit ThrowingMove(bool throwOnMove) : throwOnMove_(throwOnMove) {}
+    ThrowingMove(const ThrowingMove&) = default;
+    ThrowingMove(ThrowingMove&& other) noexcept(false) : throwOnMove_(other.throwOnMove_)
+    {
+        if (throwOnMove_)
+        {
+            throw std::runtime_error("move failed");
+        }
+    }
+    ThrowingMove& operator=(const ThrowingMove&) = default;
+    ThrowingMove& operator=(ThrowingMove&&) = default;
+
+    bool throwOnMove_;
+};
+
+static_assert(noexcept(std::declval<Result<std::string>&>().swap(std::declval<Result<std::string>&>())),
+              "Swapping nothrow movable payloads must not throw");
+static_assert(!noexcept(std::declval<Result<ThrowingMove>&>().swap(std::declval<Result<ThrowingMove>&>())),
+              "Swapping payloads with a throwing move may throw");
+
+TEST_F(ResultTest, SwapSameState)
+{
+    Result<std::string> a(std::string(32U, 'a'));
+    Result<std::string> b(std::string(32U, 'b'));
+    const char* bufferA = a->data();
+    const char* bufferB = b->data();
+    a.swap(b);
+    EXPECT_EQ(a->data(), bufferB);  // Swapped in place, no copy of the contents
+    EXPECT_EQ(b->data(), bufferA);
+
+    Result<std::uint32_t, std::string> errorA(std::string("first"));
+    Result<std::uint32_t, std::string> errorB(std::string("second"));
+    using std::swap;
+    swap(errorA, errorB);  // Argument dependent lookup
+    EXPECT_EQ(errorA.getError(), "second");
+    EXPECT_EQ(errorB.getError(), "first");
+}
+
+TEST_F(ResultTest, SwapDifferentStates)
+{
+    Result<std::string> value(std::string("value"));
+    Result<std::string> error(Status::ERROR);
+    value.swap(error);
+    EXPECT_EQ(value.getError(), Status::ERROR);
+    EXPECT_EQ(error.getValue(), "value");
+    value.swap(error);
+    EXPECT_EQ(value.getValue(), "value");
+    EXPECT_EQ(error.getError(), Status::ERROR);
+
+    std::uint32_t target = 1U;
+    Result<std::uint32_t*> pointer(&target);  // Compact storage
+    Result<std::uint32_t*> failure(Status::INVALID_ARG);
+    swap(pointer, failure);
+    EXPECT_EQ(pointer.getError(), Status::INVALID_ARG);
+    EXPECT_EQ(failure.getValue(), &target);
+
+    Result<void> success;
+    Result<void> failed(Status::ERROR);
+    swap(success, failed);
+    EXPECT_EQ(success.getError(), Status::ERROR);
+    EXPECT_TRUE(failed.hasValue());
+
+    Result<std::uint32_t&> reference(target);
+    Result<std::uint32_t&> missing(Status::ERROR);
+    swap(reference, missing);
+    EXPECT_EQ(&missing.getValue(), &target);
+    EXPECT_EQ(reference.getError(), Status::ERROR);
+}
+
+TEST_F(ResultTest, SwapDifferentStatesKeepsStateOnThrow)
+{
+    Result<ThrowingMove, std::string> value(inPlace, true);
+    Result<ThrowingMove, std::string> error(std::string("kept"));
+    EXPECT_THROW(value.swap(error), std::runtime_error);
+    EXPECT_TRUE(value.hasValue());
+    EXPECT_EQ(error.getError(), "kept");
+}
+
+TEST_F(ResultTest, Comparison)
+{
+    const Result<std::uint32_t> one(1U);
+    const Result<std::uint32_t> two(2U);
+    const Result<std::uint32_t> invalid(Status::INVALID_ARG);
+    const Result<std::uint32_t> error(Status::ERROR);
+    EXPECT_TRUE(one == Result<std::uint32_t>(1U));
+    EXPECT_TRUE(one != two);
+    EXPECT_TRUE(invalid != error);
+    EXPECT_TRUE(one < two);
+    EXPECT_TRUE(error < one);  // Errors order before values
+    EXPECT_TRUE(invalid < error);
+    EXPECT_TRUE(two >= one);
+    EXPECT_TRUE(one <= one);
+    EXPECT_TRUE(one > invalid);
+
+    EXPECT_TRUE(Result<void>() == Result<void>());
+    EXPECT_TRUE(Result<void>(Status::ERROR) < Result<void>());
+
+    std::uint32_t first = 3U;
+    std::uint32_t second = 3U;
+    EXPECT_TRUE(Result<std::uint32_t&>(first) == Result<std::uint32_t&>(second));  // Compares the objects
+}
+
+TEST_F(ResultTest, SortGroupsErrorsFirst)
+{
+    std::vector<Result<std::uint32_t>> results{Result<std::uint32_t>(3U), Result<std::uint32_t>(Status::ERROR),
+                                               Result<std::uint32_t>(1U), Result<std::uint32_t>(Status::INVALID_ARG)};
+    std::sort(results.begin(), results.end());
+    EXPECT_EQ(results[0U].getError(), Status::INVALID_ARG);
+    EXPECT_EQ(results[1U].getError(), Status::ERROR);
+    EXPECT_EQ(results[2U].getValue(), 1U);
+    EXPECT_EQ(results[3U].getValue(), 3U);
+}
+
+static_assert(std::is_default_constructible<std::hash<Result<void>>>::value, "Result<void> must hash");
+static_assert(std::is_default_constructible<std::hash<Result<const std::string&>>>::value,
+              "Result<const std::string&> must hash");
+static_assert(!std::is_default_constructible<std::hash<Result<CustomType>>>::value,
+              "std::hash<Result<CustomType>> must be disabled, CustomType does not hash");
+
+TEST_F(ResultTest, Hash)
+{
+    EXPECT_EQ(std::hash<Result<std::string>>{}(Result<std::string>(std::string("key"))),
+              std::hash<std::string>{}("key"));
+    EXPECT_NE(std::hash<Result<std::uint32_t>>{}(Result<std::uint32_t>(2U)),
+              std::hash<Result<std::uint32_t>>{}(Result<std::uint32_t>(Status::ERROR)));
+
+    std::unordered_set<Result<std::uint32_t>> seen;
+    seen.insert(Result<std::uint32_t>(1U));
+    seen.insert(Result<std::uint32_t>(1U));
+    seen.insert(Result<std::uint32_t>(Status::ERROR));
+    EXPECT_EQ(seen.size(), 2U);
+    EXPECT_EQ(seen.count(Result<std::uint32_t>(Status::ERROR)), 1U);
+
+    std::unordered_map<std::uint32_t, Result<std::string>> cache;
+    cache.emplace(1U, Result<std::string>(std::string("cached")));
+    EXPECT_EQ(cache.at(1U).getValue(), "cached");
+}
+
+/// @brief Allocator identified by a tag, to check which allocator a payload was constructed with.
+template <typename T>
+struct TaggedAllocator
+{
+    using value_type = T;
+
+    explicit TaggedAllocator(std::uint32_t tag) noexcept : tag_(tag) {}
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U>& other) noexcept : tag_(other.tag_)
+    {
+    }
+
+    T* allocate(std::size_t count) { return std::allocator<T>().allocate(count); }
+    void deallocate(T* pointer, std::size_t count) noexcept { std::allocator<T>().deallocate(pointer, count); }
+
+    bool operator==(const TaggedAllocator& other) const noexcept { return tag_ == other.tag_; }
+    bool operator!=(const TaggedAllocator& other) const noexcept { return tag_ != other.tag_; }
+
+    std::uint32_t tag_;
+};
+
+using TaggedVector = std::vector<std::uint32_t, TaggedAllocator<std::uint32_t>>;
+
+/// @brief Payload taking the allocator first, after `std::allocator_arg`.
+struct LeadingAllocatorPayload
+{
+    using allocator_type = TaggedAllocator<char>;
+
+    LeadingAllocatorPayload(std::allocator_arg_t, const allocator_type& alloc, std::uint32_t value)
+        : tag_(alloc.tag_), value_(value)
+    {
+    }
+
+    std::uint32_t tag_;
+    std::uint32_t value_;
+};
+
+TEST_F(ResultTest, UsesAllocatorConstruction)
+{
+    static_assert(std::uses_allocator<Result<TaggedVector>, TaggedAllocator<std::uint32_t>>::value,
+                  "Result uses the allocator of its value");
+    static_assert(!std::uses_allocator<Result<std::uint32_t>, TaggedAllocator<std::uint32_t>>::value,
+                  "Result of a plain value does not use allocators");
+
+    const TaggedAllocator<std::uint32_t> alloc(7U);
+    const Result<TaggedVector> values(std::allocator_arg, alloc, inPlace, 3U, 1U);
+    EXPECT_EQ(values->size(), 3U);
+    EXPECT_EQ(values->get_allocator().tag_, 7U);
+
+    const Result<LeadingAllocatorPayload> leading(std::allocator_arg, alloc, inPlace, 5U);
+    EXPECT_EQ(leading->tag_, 7U);
+    EXPECT_EQ(leading->value_, 5U);
+
+    // Payloads not using the allocator ignore it
+    const Result<std::uint32_t> plain(std::allocator_arg, alloc, inPlace, 9U);
+    EXPECT_EQ(plain.getValue(), 9U);
+    const Result<std::uint32_t, TaggedVector> error(std::allocator_arg, alloc, inPlaceError, 2U, 4U);
+    EXPECT_EQ(error.getError().get_allocator().tag_, 7U);
+}
+
+TEST_F(ResultTest, AllocatorExtendedCopyAndMove)
+{
+    const Result<TaggedVector> original(std::allocator_arg, TaggedAllocator<std::uint32_t>(1U), inPlace, 2U, 8U);
+    const Result<TaggedVector> copy(std::allocator_arg, TaggedAllocator<std::uint32_t>(2U), original);
+    EXPECT_EQ(copy->get_allocator().tag_, 2U);
+    EXPECT_EQ(copy, original);
+
+    Result<TaggedVector> source(std::allocator_arg, TaggedAllocator<std::uint32_t>(1U), inPlace, 2U, 8U);
+    const Result<TaggedVector> moved(std::allocator_arg, TaggedAllocator<std::uint32_t>(3U), std::move(source));
+    EXPECT_EQ(moved->get_allocator().tag_, 3U);
+    EXPECT_EQ(*moved, *original);
+
+    const Result<TaggedVector> failed(Status::ERROR);
+    const Result<TaggedVector> failedCopy(std::allocator_arg, TaggedAllocator<std::uint32_t>(2U), failed);
+    EXPECT_EQ(failedCopy.getError(), Status::ERROR);
+}
+
+// Boundary to throwing code:
+std::uint32_t parsePort(const std::string& text)
+{
+    const unsigned long port = std::stoul(text);
+    if (port > 65535U)
+    {
+        throw std::out_of_range("port");
+    }
+    return static_cast<std::uint32_t>(port);
+}
+
+TEST_F(ResultTest, TryInvokeValue)
+{
+    const Result<std::uint32_t> port = tryInvoke(parsePort, std::string("8080"));
+    EXPECT_EQ(port.getValue(), 8080U);
+
+    std::uint32_t calls = 0U;
+    const Result<void> done = tryInvoke([&calls]() { ++calls; });
+    EXPECT_TRUE(done.hasValue());
+    EXPECT_EQ(calls, 1U);
+}
+
+TEST_F(ResultTest, TryInvokeMapsExceptions)
+{
+    EXPECT_EQ(tryInvoke(parsePort, std::string("port")).getError(), Status::INVALID_ARG);  // std::invalid_argument
+    EXPECT_EQ(tryInvoke(parsePort, std::string("70000")).getError(), Status::INVALID_ARG);  // std::out_of_range
+    EXPECT_EQ(tryInvoke([]() -> std::string { throw std::runtime_error("io"); }).getError(), Status::ERROR);
+    EXPECT_EQ(tryInvoke([]() { throw 42; }).getError(), Status::ERROR);
+}
+
+TEST_F(ResultTest, OrThrow)
+{
+    Result<std::string> text("value");
+    text.orThrow() += "s";
+    EXPECT_EQ(text.orThrow(), "values");
+    const std::string moved = std::move(text).orThrow();
+    EXPECT_EQ(moved, "values");
+    Result<void>().orThrow();
+
+    const Result<std::uint32_t> failed(Status::INVALID_ARG);
+    try
+    {
+        static_cast<void>(failed.orThrow());
+        FAIL() << "orThrow must throw on error";
+    }
+    catch (const ResultException<Status>& exception)
+    {
+        EXPECT_EQ(exception.error(), Status::INVALID_ARG);
+        EXPECT_STREQ(exception.what(), "INVALID_ARG");
+    }
+    EXPECT_THROW(Result<void>(Status::ERROR).orThrow(), ResultException<Status>);
+}
+
+TEST_F(ResultTest, OrThrowRoundTrip)
+{
+    const auto fetch = [](std::uint32_t id) { return (id == 0U) ? Result<std::uint32_t>(Status::INVALID_ARG) : id; };
+    EXPECT_EQ(tryInvoke([&fetch]() { return fetch(0U).orThrow(); }).getError(), Status::INVALID_ARG);
+    EXPECT_EQ(tryInvoke([&fetch]() { return fetch(3U).orThrow(); }).getValue(), 3U);
+}
+
+}  // namespace test
+
+template <>
+struct ResultExceptionTraits<test::FieldError>
+{
+    static test::FieldError fromCurrentException() noexcept { return test::FieldError::MALFORMED; }
+
+    [[noreturn]] static void raise(test::FieldError /* error */) { throw std::invalid_argument("field"); }
+};
+
+namespace test
+{
+
+TEST_F(ResultTest, OwnExceptionTraits)
+{
+    const Result<std::uint32_t, FieldError> port = tryInvoke<FieldError>(parsePort, std::string("port"));
+    EXPECT_EQ(port.getError(), FieldError::MALFORMED);
+    EXPECT_THROW(port.orThrow(), std::invalid_argument);
+}
+
 // Run all the tests
 int main(int argc, char** argv)
 {
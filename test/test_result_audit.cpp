@@ -0,0 +1,269 @@
+#include "lib/atomic_result_slot.hpp"
+#include "lib/result.hpp"
+#include "lib/result_collect.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+static_assert(INTERVIEW_RESULT_AUDIT == 1, "This test must be built with INTERVIEW_RESULT_AUDIT=1");
+
+// The audit state is the only difference to the release layout:
+static_assert(sizeof(Result<int*>) > sizeof(int*), "Result<T*> must carry the audit state");
+static_assert(sizeof(Result<void>) > sizeof(Status), "Result<void> must carry the audit state");
+
+/// @brief Violations reported since the test case started.
+struct AuditCounts
+{
+    int uncheckedAccesses_{0};
+    int uncheckedErrors_{0};
+};
+
+AuditCounts& auditCounts()
+{
+    static AuditCounts counts;
+    return counts;
+}
+
+void countViolation(AuditViolation violation, const char* /* message */)
+{
+    if (violation == AuditViolation::UNCHECKED_ACCESS)
+    {
+        ++auditCounts().uncheckedAccesses_;
+    }
+    else
+    {
+        ++auditCounts().uncheckedErrors_;
+    }
+}
+
+class ResultAuditTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        auditCounts() = AuditCounts{};
+        setResultAuditHandler(&countViolation);
+    }
+
+    void TearDown() override { setResultAuditHandler(nullptr); }
+
+    static const AuditCounts& counts() { return auditCounts(); }
+};
+
+Result<std::uint32_t> parse(bool succeed)
+{
+    if (succeed)
+    {
+        return 42U;
+    }
+    return createError(Status::INVALID_ARG);
+}
+
+Result<std::uint32_t> increment(bool succeed)
+{
+    RESULT_TRY(const std::uint32_t value, parse(succeed));
+    return value + 1U;
+}
+
+TEST_F(ResultAuditTest, AccessAfterCheck)
+{
+    const Result<std::uint32_t> value = parse(true);
+    ASSERT_TRUE(value.hasValue());
+    EXPECT_EQ(*value, 42U);
+    EXPECT_EQ(value.getValue(), 42U);
+    EXPECT_EQ(value.valueUnchecked(), 42U);
+
+    const Result<std::uint32_t> error = parse(false);
+    if (!error)
+    {
+        EXPECT_EQ(error.getError(), Status::INVALID_ARG);
+        EXPECT_EQ(error.errorUnchecked(), Status::INVALID_ARG);
+    }
+    EXPECT_EQ(counts().uncheckedAccesses_, 0);
+}
+
+TEST_F(ResultAuditTest, ReportsUncheckedAccess)
+{
+    const Result<std::uint32_t> value = parse(true);
+    EXPECT_EQ(value.valueUnchecked(), 42U);
+    EXPECT_EQ(*value, 42U);
+    EXPECT_EQ(counts().uncheckedAccesses_, 2);
+
+    // The checked accessors are reported as well, the check may be removed from them:
+    const Result<std::string> text(inPlace, "text");
+    EXPECT_EQ(text->size(), 4U);
+    EXPECT_EQ(text.getValue(), "text");
+    EXPECT_EQ(counts().uncheckedAccesses_, 4);
+
+    const Result<std::uint32_t> error = parse(false);
+    EXPECT_EQ(error.getError(), Status::INVALID_ARG);
+    EXPECT_EQ(counts().uncheckedAccesses_, 5);
+    EXPECT_EQ(counts().uncheckedErrors_, 0);
+}
+
+TEST_F(ResultAuditTest, ReportsUncheckedError)
+{
+    {
+        const Result<std::uint32_t> value = parse(true);
+        const Result<std::uint32_t> error = parse(false);
+    }
+    EXPECT_EQ(counts().uncheckedErrors_, 1);
+
+    {
+        const Result<std::uint32_t> error = parse(false);
+        EXPECT_FALSE(error.hasValue());
+        const Result<std::uint32_t> discarded = parse(false);
+        discarded.discard();
+        const Result<std::uint32_t> defaulted = parse(false);
+        EXPECT_EQ(defaulted.valueOr(7U), 7U);
+    }
+    EXPECT_EQ(counts().uncheckedErrors_, 1);
+    EXPECT_EQ(counts().uncheckedAccesses_, 0);
+}
+
+TEST_F(ResultAuditTest, MovesTakeOverTheCheck)
+{
+    {
+        Result<std::uint32_t> error = parse(false);
+        const Result<std::uint32_t> moved(std::move(error));
+        EXPECT_FALSE(moved.hasValue());
+    }
+    EXPECT_EQ(counts().uncheckedErrors_, 0);
+
+    {
+        Result<std::uint32_t> error = parse(false);
+        Result<std::uint32_t> target = parse(true);
+        EXPECT_TRUE(target.hasValue());
+        target = std::move(error);
+    }
+    EXPECT_EQ(counts().uncheckedErrors_, 1);
+
+    // A copy is an outcome of its own, both must be checked:
+    {
+        const Result<std::uint32_t> error = parse(false);
+        const Result<std::uint32_t> copy(error);
+        EXPECT_FALSE(copy.hasValue());
+    }
+    EXPECT_EQ(counts().uncheckedErrors_, 2);
+
+    {
+        const Result<std::uint32_t> error = parse(false);
+        EXPECT_FALSE(error.hasValue());
+        const Result<std::uint32_t> copy(error);
+        EXPECT_EQ(copy.errorUnchecked(), Status::INVALID_ARG);
+    }
+    EXPECT_EQ(counts().uncheckedErrors_, 2);
+    EXPECT_EQ(counts().uncheckedAccesses_, 0);
+}
+
+TEST_F(ResultAuditTest, SwapsTheAuditState)
+{
+    {
+        Result<std::uint32_t> checked = parse(true);
+        EXPECT_TRUE(checked.hasValue());
+        Result<std::uint32_t> error = parse(false);
+        checked.swap(error);
+        EXPECT_EQ(error.valueUnchecked(), 42U);
+        EXPECT_EQ(counts().uncheckedAccesses_, 0);
+    }
+    EXPECT_EQ(counts().uncheckedErrors_, 1);
+}
+
+TEST_F(ResultAuditTest, CombinatorsCheck)
+{
+    const Result<std::uint32_t> doubled = parse(true).map([](std::uint32_t value) { return value * 2U; });
+    EXPECT_EQ(*doubled, 84U);
+    EXPECT_EQ(counts().uncheckedAccesses_, 1);
+
+    {
+        const Result<std::uint32_t> error = increment(false);
+        const Result<std::uint32_t> recovered =
+            increment(false).orElse([](Status /* status */) { return Result<std::uint32_t>(0U); });
+        ASSERT_TRUE(recovered);
+        EXPECT_EQ(*recovered, 0U);
+        EXPECT_THROW(parse(false).orThrow(), std::runtime_error);
+        EXPECT_TRUE(increment(false) == parse(false));
+    }
+    EXPECT_EQ(counts().uncheckedErrors_, 1);
+    EXPECT_EQ(counts().uncheckedAccesses_, 1);
+}
+
+TEST_F(ResultAuditTest, VoidResult)
+{
+    {
+        const Result<void> error = createError(Status::ERROR);
+        const Result<void> success;
+        EXPECT_EQ(counts().uncheckedErrors_, 0);
+    }
+    EXPECT_EQ(counts().uncheckedErrors_, 1);
+
+    const Result<void> error = createError(Status::ERROR);
+    EXPECT_EQ(error.errorUnchecked(), Status::ERROR);
+    EXPECT_EQ(counts().uncheckedAccesses_, 1);
+    // Checking the success is a check:
+    EXPECT_THROW(error.getValue(), std::runtime_error);
+    EXPECT_EQ(error.getError(), Status::ERROR);
+    EXPECT_EQ(counts().uncheckedAccesses_, 1);
+}
+
+TEST_F(ResultAuditTest, ReferenceResult)
+{
+    int object = 3;
+    const Result<int&> reference(object);
+    EXPECT_EQ(&*reference, &object);
+    EXPECT_EQ(counts().uncheckedAccesses_, 1);
+    {
+        const Result<int&> error = createError(Status::ERROR);
+        const Result<int&> discarded = createError(Status::ERROR);
+        discarded.discard();
+    }
+    EXPECT_EQ(counts().uncheckedErrors_, 1);
+}
+
+TEST_F(ResultAuditTest, SlotDiscardsItsResult)
+{
+    AtomicResultSlot<std::uint32_t> slot;
+    slot.publish(inPlaceError, Status::ERROR);
+    slot.reset();
+    slot.publish(inPlaceError, Status::ERROR);
+    EXPECT_EQ(counts().uncheckedErrors_, 0);
+}
+
+TEST_F(ResultAuditTest, CollectChecksEveryResult)
+{
+    // The arguments past the first error are temporaries the caller cannot check
+    EXPECT_FALSE(collect(parse(false), parse(false)).hasValue());
+
+    std::vector<Result<std::uint32_t>> rows;
+    rows.push_back(parse(true));
+    rows.push_back(parse(false));
+    rows.push_back(parse(false));
+    EXPECT_FALSE(collectAll(std::move(rows)).hasValue());
+    rows.clear();
+    EXPECT_EQ(counts().uncheckedErrors_, 0);
+}
+
+TEST_F(ResultAuditTest, AbortsWithoutHandler)
+{
+    setResultAuditHandler(nullptr);
+    EXPECT_DEATH({ const Result<std::uint32_t> error = parse(false); }, "Error destructed without checking");
+    EXPECT_DEATH(static_cast<void>(*parse(true)), "Accessed before checking");
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
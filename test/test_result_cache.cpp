@@ -0,0 +1,300 @@
+#include "lib/result_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+/// @brief Clock advanced manually by the tests.
+struct ManualClock
+{
+    using duration = std::chrono::milliseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<ManualClock>;
+    static constexpr bool is_steady = true;
+
+    static time_point now() noexcept { return time_point(duration(ticks().load())); }
+    static void advance(duration step) noexcept { ticks().fetch_add(step.count()); }
+
+    static std::atomic<rep>& ticks() noexcept
+    {
+        static std::atomic<rep> ticks{0};
+        return ticks;
+    }
+};
+
+using Cache = ResultCache<std::uint32_t, std::string, Status, std::hash<std::uint32_t>, ManualClock>;
+
+class ResultCacheTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+    /// @brief Lookup of the example: odd keys fail.
+    Result<std::string> lookup(std::uint32_t key)
+    {
+        ++calls_;
+        if ((key % 2U) != 0U)
+        {
+            return createError(Status::INVALID_ARG);
+        }
+        return std::to_string(key);
+    }
+
+    std::uint32_t calls_{0U};
+};
+
+TEST_F(ResultCacheTest, ComputesOnce)
+{
+    Cache cache(std::chrono::milliseconds(100), std::chrono::milliseconds(10));
+    const auto compute = [this](std::uint32_t key) { return lookup(key); };
+    EXPECT_EQ(cache.getOrCompute(2U, compute).getValue(), "2");
+    EXPECT_EQ(cache.getOrCompute(2U, compute).getValue(), "2");
+    EXPECT_EQ(calls_, 1U);
+
+    const ResultCacheStats stats = cache.stats();
+    EXPECT_EQ(stats.hits_, 1U);
+    EXPECT_EQ(stats.misses_, 1U);
+    EXPECT_EQ(stats.computations_, 1U);
+}
+
+TEST_F(ResultCacheTest, CachesErrors)
+{
+    Cache cache(std::chrono::milliseconds(100), std::chrono::milliseconds(10));
+    const auto compute = [this](std::uint32_t key) { return lookup(key); };
+    EXPECT_EQ(cache.getOrCompute(3U, compute).getError(), Status::INVALID_ARG);
+    EXPECT_EQ(cache.getOrCompute(3U, compute).getError(), Status::INVALID_ARG);
+    EXPECT_EQ(calls_, 1U);
+    EXPECT_EQ(cache.stats().errorHits_, 1U);
+}
+
+TEST_F(ResultCacheTest, ErrorsExpireFirst)
+{
+    Cache cache(std::chrono::milliseconds(100), std::chrono::milliseconds(10));
+    const auto compute = [this](std::uint32_t key) { return lookup(key); };
+    (void)cache.getOrCompute(2U, compute);
+    (void)cache.getOrCompute(3U, compute);
+    ManualClock::advance(std::chrono::milliseconds(10));
+    (void)cache.getOrCompute(2U, compute);
+    (void)cache.getOrCompute(3U, compute);
+    EXPECT_EQ(calls_, 3U);  // Only the error was computed again
+
+    ManualClock::advance(std::chrono::milliseconds(100));
+    Result<std::string> entry(Status::OK);
+    EXPECT_FALSE(cache.tryGet(2U, entry));
+}
+
+TEST_F(ResultCacheTest, ZeroErrorTtlDisablesNegativeCaching)
+{
+    Cache cache(std::chrono::milliseconds(100), std::chrono::milliseconds(0));
+    const auto compute = [this](std::uint32_t key) { return lookup(key); };
+    (void)cache.getOrCompute(3U, compute);
+    (void)cache.getOrCompute(3U, compute);
+    EXPECT_EQ(calls_, 2U);
+    EXPECT_EQ(cache.size(), 0U);
+}
+
+TEST_F(ResultCacheTest, PutTryGetInvalidate)
+{
+    Cache cache(std::chrono::milliseconds(100), std::chrono::milliseconds(10));
+    Result<std::string> entry(Status::OK);
+    EXPECT_FALSE(cache.tryGet(4U, entry));
+    cache.put(4U, Result<std::string>(std::string("four")));
+    ASSERT_TRUE(cache.tryGet(4U, entry));
+    EXPECT_EQ(entry.getValue(), "four");
+    cache.put(4U, Result<std::string>(Status::ERROR));
+    ASSERT_TRUE(cache.tryGet(4U, entry));
+    EXPECT_EQ(entry.getError(), Status::ERROR);
+
+    EXPECT_TRUE(cache.invalidate(4U));
+    EXPECT_FALSE(cache.invalidate(4U));
+    EXPECT_FALSE(cache.tryGet(4U, entry));
+
+    cache.put(6U, Result<std::string>(std::string("six")));
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0U);
+}
+
+TEST_F(ResultCacheTest, EvictsLeastRecentlyUsed)
+{
+    Cache cache(std::chrono::milliseconds(100), std::chrono::milliseconds(10), 2U, 1U);
+    const auto compute = [this](std::uint32_t key) { return lookup(key); };
+    (void)cache.getOrCompute(2U, compute);
+    (void)cache.getOrCompute(4U, compute);
+    (void)cache.getOrCompute(2U, compute);  // 4 is the least recently used now
+    (void)cache.getOrCompute(6U, compute);
+    EXPECT_EQ(cache.size(), 2U);
+    EXPECT_EQ(cache.stats().evictions_, 1U);
+
+    Result<std::string> entry(Status::OK);
+    EXPECT_TRUE(cache.tryGet(2U, entry));
+    EXPECT_FALSE(cache.tryGet(4U, entry));
+    EXPECT_TRUE(cache.tryGet(6U, entry));
+}
+
+TEST_F(ResultCacheTest, ExceptionIsNotCached)
+{
+    Cache cache(std::chrono::milliseconds(100), std::chrono::milliseconds(10));
+    EXPECT_THROW(cache.getOrCompute(2U,
+                                    [](std::uint32_t) -> Result<std::string> {
+                                        throw std::runtime_error("backend unavailable");
+                                    }),
+                 std::runtime_error);
+    const auto compute = [this](std::uint32_t key) { return lookup(key); };
+    EXPECT_EQ(cache.getOrCompute(2U, compute).getValue(), "2");
+    EXPECT_EQ(calls_, 1U);
+}
+
+/// @brief Copies and moves of `Fragile` throw while set, like a payload failing to allocate.
+bool failCopies = false;
+bool failMoves = false;
+
+struct Fragile
+{
+    explicit Fragile(int id) noexcept : id_(id) {}
+    Fragile(const Fragile& other) : id_(other.id_) { fail(failCopies); }
+    Fragile(Fragile&& other) : id_(other.id_) { fail(failMoves); }
+    Fragile& operator=(const Fragile&) = default;
+    Fragile& operator=(Fragile&&) = default;
+
+    static void fail(bool armed)
+    {
+        if (armed)
+        {
+            throw std::runtime_error("out of memory");
+        }
+    }
+
+    int id_;
+};
+
+using FragileCache = ResultCache<std::uint32_t, Fragile, Status, std::hash<std::uint32_t>, ManualClock>;
+
+TEST_F(ResultCacheTest, FailedStoreCompletesTheFlight)
+{
+    FragileCache cache(std::chrono::milliseconds(100), std::chrono::milliseconds(10));
+    // The computation succeeds, copying its result into the cache throws
+    EXPECT_THROW(cache.getOrCompute(2U,
+                                    [](std::uint32_t key) {
+                                        failCopies = true;
+                                        return Result<Fragile>(inPlace, static_cast<int>(key));
+                                    }),
+                 std::runtime_error);
+    failCopies = false;
+
+    // The flight is completed, the next caller computes the key again instead of waiting for it forever
+    const Result<Fragile> entry =
+        cache.getOrCompute(2U, [](std::uint32_t key) { return Result<Fragile>(inPlace, static_cast<int>(key) + 1); });
+    EXPECT_EQ(entry->id_, 3);
+}
+
+TEST_F(ResultCacheTest, FailedStoreLeavesNoStrayKey)
+{
+    FragileCache cache(std::chrono::milliseconds(100), std::chrono::milliseconds(10), 1U, 1U);
+    const Result<Fragile> first(inPlace, 1);
+    failMoves = true;
+    EXPECT_THROW(cache.put(1U, first), std::runtime_error);
+    failMoves = false;
+    EXPECT_EQ(cache.size(), 0U);
+
+    // The eviction takes the least recently used key, which must have a node
+    cache.put(2U, Result<Fragile>(inPlace, 2));
+    cache.put(3U, Result<Fragile>(inPlace, 3));
+    EXPECT_EQ(cache.size(), 1U);
+    Result<Fragile> cached(inPlace, 0);
+    ASSERT_TRUE(cache.tryGet(3U, cached));
+    EXPECT_EQ(cached->id_, 3);
+}
+
+TEST_F(ResultCacheTest, ConcurrentMissesComputeOnce)
+{
+    constexpr std::uint32_t kThreads = 8U;
+    Cache cache(std::chrono::milliseconds(100), std::chrono::milliseconds(10));
+    std::atomic<std::uint32_t> computations{0U};
+    std::atomic<bool> release{false};
+    const auto compute = [&computations, &release](std::uint32_t key) -> Result<std::string> {
+        computations.fetch_add(1U);
+        while (!release.load())
+        {
+            std::this_thread::yield();
+        }
+        return std::to_string(key);
+    };
+
+    std::vector<std::thread> threads;
+    std::vector<std::string> values(kThreads);
+    for (std::uint32_t thread = 0U; thread < kThreads; ++thread)
+    {
+        threads.emplace_back([&cache, &compute, &values, thread]() {
+            values[thread] = cache.getOrCompute(8U, compute).getValue();
+        });
+    }
+    // Release the computation once all the other callers wait for it
+    while (cache.stats().coalesced_ < (kThreads - 1U))
+    {
+        std::this_thread::yield();
+    }
+    release.store(true);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(computations.load(), 1U);
+    for (const std::string& value : values)
+    {
+        EXPECT_EQ(value, "8");
+    }
+}
+
+TEST_F(ResultCacheTest, ConcurrentKeys)
+{
+    Cache cache(std::chrono::milliseconds(100), std::chrono::milliseconds(10), 64U, 4U);
+    std::atomic<std::uint32_t> mismatches{0U};
+    std::vector<std::thread> threads;
+    for (std::uint32_t thread = 0U; thread < 4U; ++thread)
+    {
+        threads.emplace_back([&cache, &mismatches]() {
+            for (std::uint32_t i = 0U; i < 2000U; ++i)
+            {
+                const std::uint32_t key = (i * 7U) % 97U;
+                const Result<std::string> result = cache.getOrCompute(key, [](std::uint32_t k) -> Result<std::string> {
+                    if ((k % 2U) != 0U)
+                    {
+                        return createError(Status::INVALID_ARG);
+                    }
+                    return std::to_string(k);
+                });
+                if (result.hasValue() != ((key % 2U) == 0U))
+                {
+                    mismatches.fetch_add(1U);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    EXPECT_EQ(mismatches.load(), 0U);
+    EXPECT_LE(cache.size(), 64U);
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
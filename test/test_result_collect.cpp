@@ -0,0 +1,186 @@
+#include "lib/result_collect.hpp"
+#include "lib/result_vector.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+/// @brief Payload counting its copies.
+struct Tracked
+{
+    explicit Tracked(int value, int* copies) noexcept : value_(value), copies_(copies) {}
+    Tracked(const Tracked& other) noexcept : value_(other.value_), copies_(other.copies_) { ++*copies_; }
+    Tracked(Tracked&& other) noexcept = default;
+    Tracked& operator=(const Tracked&) = delete;
+    Tracked& operator=(Tracked&&) = delete;
+
+    int value_;
+    int* copies_;
+};
+
+class ResultCollectTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+    static Result<std::uint32_t> divideNumbers(std::uint32_t a, std::uint32_t b)
+    {
+        if (b == 0U)
+        {
+            return createError(Status::INVALID_ARG);
+        }
+        return a / b;
+    }
+
+    static Result<std::string> greetName(const std::string& name)
+    {
+        if (name.empty())
+        {
+            return createError(Status::INVALID_ARG);
+        }
+        return "Hello, " + name + "!";
+    }
+
+    int copies_{0};
+};
+
+TEST_F(ResultCollectTest, CollectMovesValuesIntoTuple)
+{
+    Result<Tracked> tracked(inPlace, 7, &copies_);
+    const auto all = collect(divideNumbers(10U, 2U), greetName("Daniel"), std::move(tracked),
+                             Result<std::unique_ptr<int>>(std::make_unique<int>(3)));
+    ASSERT_TRUE(all.hasValue());
+    EXPECT_EQ(std::get<0>(*all), 5U);
+    EXPECT_EQ(std::get<1>(*all), "Hello, Daniel!");
+    EXPECT_EQ(std::get<2>(*all).value_, 7);
+    EXPECT_EQ(*std::get<3>(*all), 3);
+    EXPECT_EQ(copies_, 0);
+
+    // Lvalues are copied and left unchanged
+    const Result<Tracked> kept(inPlace, 8, &copies_);
+    const auto copied = collect(kept, divideNumbers(9U, 3U));
+    EXPECT_EQ(std::get<0>(copied.getValue()).value_, 8);
+    EXPECT_EQ(copies_, 1);
+    EXPECT_EQ(kept->value_, 8);
+}
+
+TEST_F(ResultCollectTest, CollectReturnsFirstError)
+{
+    const auto failed = collect(divideNumbers(10U, 2U), greetName(""), Result<std::string>(createError(Status::ERROR)));
+    EXPECT_EQ(failed.getError(), Status::INVALID_ARG);
+
+    const auto single = collect(Result<int>(createError(Status::ERROR)));
+    EXPECT_EQ(single.getError(), Status::ERROR);
+}
+
+TEST_F(ResultCollectTest, CollectAllReservesOnce)
+{
+    std::vector<Result<Tracked>> results;
+    for (int value = 0; value < 5; ++value)
+    {
+        results.emplace_back(inPlace, value, &copies_);
+    }
+    const auto copied = collectAll(results);
+    ASSERT_TRUE(copied.hasValue());
+    EXPECT_EQ(copied->size(), 5U);
+    EXPECT_EQ(copied->capacity(), 5U);
+    EXPECT_EQ(copies_, 5);
+
+    const auto moved = collectAll(std::move(results));
+    ASSERT_TRUE(moved.hasValue());
+    EXPECT_EQ(moved->back().value_, 4);
+    EXPECT_EQ(copies_, 5);
+
+    EXPECT_TRUE(collectAll(std::vector<Result<int>>()).getValue().empty());
+}
+
+TEST_F(ResultCollectTest, CollectAllReturnsFirstError)
+{
+    const std::vector<Result<std::uint32_t>> results{divideNumbers(4U, 2U), Result<std::uint32_t>(Status::ERROR),
+                                                     divideNumbers(1U, 0U)};
+    EXPECT_EQ(collectAll(results).getError(), Status::ERROR);
+
+    // Ranges yielding results by value, e.g. a ResultVector
+    ResultVector<std::uint32_t> batch;
+    batch.pushBack(Result<std::uint32_t>(1U));
+    batch.pushBack(Result<std::uint32_t>(2U));
+    EXPECT_EQ(collectAll(batch).getValue(), (std::vector<std::uint32_t>{1U, 2U}));
+    batch.pushBack(Result<std::uint32_t>(Status::INVALID_ARG));
+    EXPECT_EQ(collectAll(batch).getError(), Status::INVALID_ARG);
+}
+
+TEST_F(ResultCollectTest, CollectErrors)
+{
+    const auto none = collectErrors(divideNumbers(1U, 1U), greetName("Daniel"));
+    EXPECT_TRUE(none.empty());
+
+    const auto some = collectErrors(divideNumbers(1U, 0U), greetName("Daniel"),
+                                    Result<std::uint32_t>(createError(Status::ERROR)));
+    ASSERT_EQ(some.size(), 2U);
+    EXPECT_EQ(some[0], Status::INVALID_ARG);
+    EXPECT_EQ(some[1], Status::ERROR);
+    EXPECT_TRUE(some.isInline());
+
+    std::vector<Result<std::uint32_t>> results;
+    for (std::uint32_t divisor = 0U; divisor < 20U; ++divisor)
+    {
+        results.push_back(divideNumbers(100U, divisor % 4U));
+    }
+    const auto inlined = collectErrors<8U>(results);
+    EXPECT_EQ(inlined.size(), 5U);
+    EXPECT_TRUE(inlined.isInline());
+    const auto spilled = collectErrors<2U>(results);
+    EXPECT_EQ(spilled.size(), 5U);
+    EXPECT_FALSE(spilled.isInline());
+    EXPECT_EQ(spilled.back(), Status::INVALID_ARG);
+}
+
+TEST_F(ResultCollectTest, SmallVectorStorage)
+{
+    SmallVector<std::string, 2U> strings;
+    EXPECT_EQ(strings.capacity(), 2U);
+    strings.push_back("first string longer than the small string buffer");
+    strings.emplace_back(3U, 'x');
+    EXPECT_TRUE(strings.isInline());
+    strings.push_back(strings.front());  // Refers to an element while growing
+    EXPECT_FALSE(strings.isInline());
+    EXPECT_EQ(strings[2], strings[0]);
+
+    // Copies and moves of inline and heap storage
+    SmallVector<std::string, 2U> copy(strings);
+    EXPECT_EQ(copy.size(), 3U);
+    const std::string* data = strings.data();
+    SmallVector<std::string, 2U> moved(std::move(strings));
+    EXPECT_EQ(moved.data(), data);
+    EXPECT_TRUE(strings.empty());
+    EXPECT_TRUE(strings.isInline());
+
+    SmallVector<std::string, 2U> small;
+    small.push_back("one");
+    copy = std::move(small);
+    EXPECT_TRUE(copy.isInline());
+    EXPECT_EQ(copy.size(), 1U);
+    EXPECT_EQ(copy.back(), "one");
+    moved = copy;
+    EXPECT_EQ(moved.size(), 1U);
+    moved.pop_back();
+    EXPECT_TRUE(moved.empty());
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
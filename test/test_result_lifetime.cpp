@@ -0,0 +1,281 @@
+#include "lib/atomic_result_slot.hpp"
+#include "lib/result.hpp"
+#include "lib/small_vector.hpp"
+#include "test/lifetime_tracker.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <utility>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+using TrackedResult = Result<TrackedValue, TrackedError>;
+
+class ResultLifetimeTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override { lifetimeCounters() = LifetimeCounters{}; }
+
+    void TearDown() override
+    {
+        EXPECT_EQ(lifetimeCounters().live(), 0U);
+        EXPECT_EQ(lifetimeCounters().violations_, 0);
+        EXPECT_EQ(counters().constructed_ + counters().copied_ + counters().moved_, counters().destroyed_);
+    }
+
+    static const LifetimeCounters& counters() { return lifetimeCounters(); }
+};
+
+TEST_F(ResultLifetimeTest, ConstructsInPlace)
+{
+    {
+        const TrackedResult value(inPlace, 1);
+        const TrackedResult error(inPlaceError, 2);
+        EXPECT_EQ(value.getValue().payload(), 1);
+        EXPECT_EQ(error.getError().payload(), 2);
+        EXPECT_EQ(counters().live(), 2U);
+    }
+    EXPECT_EQ(counters().constructed_, 2);
+    EXPECT_EQ(counters().moved_, 0);
+    EXPECT_EQ(counters().copied_, 0);
+    EXPECT_EQ(counters().destroyed_, 2);
+}
+
+TEST_F(ResultLifetimeTest, ConstructsFromPayload)
+{
+    {
+        const TrackedResult value(TrackedValue(1));
+        const TrackedResult error = createError(TrackedError(2));
+        EXPECT_EQ(value.getValue().payload(), 1);
+        EXPECT_EQ(error.getError().payload(), 2);
+        EXPECT_EQ(counters().live(), 2U);
+    }
+    EXPECT_EQ(counters().copied_, 0);
+}
+
+TEST_F(ResultLifetimeTest, CopiesAndMoves)
+{
+    const TrackedResult value(inPlace, 1);
+    const TrackedResult error(inPlaceError, 2);
+
+    TrackedResult valueCopy(value);
+    TrackedResult errorCopy(error);
+    EXPECT_EQ(counters().copied_, 2);
+    EXPECT_EQ(valueCopy.getValue().payload(), 1);
+    EXPECT_EQ(errorCopy.getError().payload(), 2);
+
+    const TrackedResult valueMoved(std::move(valueCopy));
+    const TrackedResult errorMoved(std::move(errorCopy));
+    EXPECT_EQ(counters().moved_, 2);
+    EXPECT_EQ(valueMoved.getValue().payload(), 1);
+    EXPECT_EQ(errorMoved.getError().payload(), 2);
+    // The moved-from results keep their moved-from alternative alive:
+    EXPECT_EQ(valueCopy.getValue().payload(), TrackedValue::kMovedFrom);
+    EXPECT_EQ(errorCopy.getError().payload(), TrackedError::kMovedFrom);
+    EXPECT_EQ(counters().live(), 6U);
+}
+
+TEST_F(ResultLifetimeTest, AssignsSameAlternative)
+{
+    TrackedResult value(inPlace, 1);
+    TrackedResult error(inPlaceError, 2);
+    const TrackedResult otherValue(inPlace, 3);
+    const TrackedResult otherError(inPlaceError, 4);
+
+    value = otherValue;
+    error = otherError;
+    EXPECT_EQ(counters().assigned_, 2);
+    EXPECT_EQ(counters().copied_, 0);
+    EXPECT_EQ(counters().destroyed_, 0);
+    EXPECT_EQ(value.getValue().payload(), 3);
+    EXPECT_EQ(error.getError().payload(), 4);
+
+    value = TrackedResult(inPlace, 5);
+    EXPECT_EQ(counters().assigned_, 3);
+    EXPECT_EQ(value.getValue().payload(), 5);
+    EXPECT_EQ(counters().live(), 4U);
+}
+
+TEST_F(ResultLifetimeTest, AssignsOtherAlternative)
+{
+    TrackedResult result(inPlace, 1);
+    const TrackedResult error(inPlaceError, 2);
+    const TrackedResult value(inPlace, 3);
+
+    result = error;
+    ASSERT_FALSE(result.hasValue());
+    EXPECT_EQ(result.getError().payload(), 2);
+    EXPECT_EQ(counters().live(), 3U);
+
+    result = value;
+    ASSERT_TRUE(result.hasValue());
+    EXPECT_EQ(result.getValue().payload(), 3);
+    EXPECT_EQ(counters().live(), 3U);
+
+    result = TrackedResult(inPlaceError, 4);
+    ASSERT_FALSE(result.hasValue());
+    EXPECT_EQ(result.getError().payload(), 4);
+    EXPECT_EQ(counters().live(), 3U);
+    EXPECT_EQ(counters().assigned_, 0);
+}
+
+TEST_F(ResultLifetimeTest, ThrowingCopyKeepsAlternative)
+{
+    TrackedResult result(inPlace, 1);
+    const TrackedResult error(inPlaceError, 2);
+
+    lifetimeCounters().copiesUntilThrow_ = 0;
+    EXPECT_THROW(result = error, std::runtime_error);
+    ASSERT_TRUE(result.hasValue());
+    EXPECT_EQ(result.getValue().payload(), 1);
+    EXPECT_EQ(counters().live(), 2U);
+
+    lifetimeCounters().copiesUntilThrow_ = 0;
+    EXPECT_THROW(TrackedResult copy(error), std::runtime_error);
+    EXPECT_EQ(counters().live(), 2U);
+
+    lifetimeCounters().copiesUntilThrow_ = 0;
+    EXPECT_THROW(result.emplace(result.getValue()), std::runtime_error);
+    EXPECT_EQ(result.getValue().payload(), 1);
+    EXPECT_EQ(counters().live(), 2U);
+}
+
+TEST_F(ResultLifetimeTest, Swaps)
+{
+    TrackedResult a(inPlace, 1);
+    TrackedResult b(inPlace, 2);
+    a.swap(b);
+    EXPECT_EQ(a.getValue().payload(), 2);
+    EXPECT_EQ(b.getValue().payload(), 1);
+
+    TrackedResult error(inPlaceError, 3);
+    a.swap(error);
+    ASSERT_FALSE(a.hasValue());
+    ASSERT_TRUE(error.hasValue());
+    EXPECT_EQ(a.getError().payload(), 3);
+    EXPECT_EQ(error.getValue().payload(), 2);
+
+    a.swap(error);
+    ASSERT_TRUE(a.hasValue());
+    EXPECT_EQ(a.getValue().payload(), 2);
+    EXPECT_EQ(error.getError().payload(), 3);
+
+    TrackedResult otherError(inPlaceError, 4);
+    swap(error, otherError);
+    EXPECT_EQ(error.getError().payload(), 4);
+    EXPECT_EQ(otherError.getError().payload(), 3);
+    EXPECT_EQ(counters().live(), 4U);
+    EXPECT_EQ(counters().copied_, 0);
+}
+
+TEST_F(ResultLifetimeTest, Emplaces)
+{
+    TrackedResult result(inPlaceError, 1);
+    result.emplace(2);
+    ASSERT_TRUE(result.hasValue());
+    EXPECT_EQ(result.getValue().payload(), 2);
+    result.emplace(3);
+    EXPECT_EQ(result.getValue().payload(), 3);
+    EXPECT_EQ(counters().live(), 1U);
+    // The constructor of Tracked may throw, so each value is constructed aside and moved in:
+    EXPECT_EQ(counters().constructed_, 3);
+    EXPECT_EQ(counters().moved_, 2);
+}
+
+TEST_F(ResultLifetimeTest, MovesPayloadOut)
+{
+    TrackedResult value(inPlace, 1);
+    TrackedResult error(inPlaceError, 2);
+    {
+        const TrackedValue moved = std::move(value).getValue();
+        const TrackedError movedError = std::move(error).getError();
+        EXPECT_EQ(moved.payload(), 1);
+        EXPECT_EQ(movedError.payload(), 2);
+        EXPECT_EQ(counters().live(), 4U);
+    }
+    EXPECT_EQ(std::move(value).valueOr(TrackedValue(3)).payload(), TrackedValue::kMovedFrom);
+    EXPECT_EQ(counters().copied_, 0);
+}
+
+TEST_F(ResultLifetimeTest, CombinatorsReleaseIntermediates)
+{
+    {
+        const Result<TrackedValue, TrackedError> mapped =
+            TrackedResult(inPlace, 1)
+                .map([](TrackedValue value) { return TrackedValue(value.payload() + 1); })
+                .andThen([](const TrackedValue& value) { return TrackedResult(inPlaceError, value.payload()); })
+                .orElse([](TrackedError error) { return TrackedResult(inPlace, error.payload() * 10); });
+        EXPECT_EQ(mapped.getValue().payload(), 20);
+        EXPECT_EQ(counters().live(), 1U);
+    }
+    EXPECT_EQ(counters().copied_, 0);
+}
+
+TEST_F(ResultLifetimeTest, VoidResult)
+{
+    Result<void, TrackedError> result(inPlaceError, 1);
+    EXPECT_EQ(result.getError().payload(), 1);
+    result = Result<void, TrackedError>();
+    EXPECT_TRUE(result.hasValue());
+    EXPECT_EQ(counters().live(), 0U);
+
+    const Result<void, TrackedError> error(inPlaceError, 2);
+    result = error;
+    EXPECT_EQ(result.getError().payload(), 2);
+    result.emplace();
+    EXPECT_TRUE(result.hasValue());
+    EXPECT_EQ(counters().live(), 1U);
+}
+
+TEST_F(ResultLifetimeTest, SmallVectorRelocation)
+{
+    SmallVector<TrackedResult, 2U> results;
+    for (int index = 0; index < 9; ++index)
+    {
+        if ((index % 3) == 0)
+        {
+            results.emplace_back(inPlaceError, index);
+        }
+        else
+        {
+            results.emplace_back(inPlace, index);
+        }
+    }
+    EXPECT_FALSE(results.isInline());
+    EXPECT_EQ(counters().live(), 9U);
+    EXPECT_EQ(results[3].getError().payload(), 3);
+    EXPECT_EQ(results[8].getValue().payload(), 8);
+
+    SmallVector<TrackedResult, 2U> copy(results);
+    SmallVector<TrackedResult, 2U> moved(std::move(copy));
+    EXPECT_EQ(counters().live(), 18U);
+    EXPECT_EQ(moved[4].getValue().payload(), 4);
+}
+
+TEST_F(ResultLifetimeTest, AtomicResultSlot)
+{
+    AtomicResultSlot<TrackedValue, TrackedError> slot;
+    slot.publish(inPlace, 1);
+    EXPECT_EQ(counters().live(), 1U);
+    {
+        const TrackedResult taken = slot.take();
+        EXPECT_EQ(taken.getValue().payload(), 1);
+        EXPECT_EQ(counters().live(), 1U);
+    }
+    slot.publish(inPlaceError, 2);
+    slot.reset();
+    EXPECT_EQ(counters().live(), 0U);
+    slot.publish(inPlace, 3);
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
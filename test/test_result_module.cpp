@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+import interview.result;
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+class ResultModuleTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+Result<std::uint32_t> parse(const std::string& text)
+{
+    if (text.empty())
+    {
+        return createError(Status::INVALID_ARG);
+    }
+    return static_cast<std::uint32_t>(text.size());
+}
+
+TEST_F(ResultModuleTest, ConstructsAndAccesses)
+{
+    const Result<std::uint32_t> value = parse("four");
+    ASSERT_TRUE(value.hasValue());
+    EXPECT_EQ(*value, 4U);
+
+    const Result<std::uint32_t> error = parse("");
+    ASSERT_FALSE(error);
+    EXPECT_EQ(error.getError(), Status::INVALID_ARG);
+    EXPECT_STREQ(toString(error.getError()), "INVALID_ARG");
+    EXPECT_EQ(error.valueOr(7U), 7U);
+
+    const Result<std::string> text(inPlace, 3U, 'x');
+    EXPECT_EQ(text.getValue(), "xxx");
+    const Result<void> done;
+    EXPECT_TRUE(done.hasValue());
+}
+
+TEST_F(ResultModuleTest, Combinators)
+{
+    const Result<std::string> mapped =
+        parse("abc").map([](std::uint32_t size) { return size * 2U; }).map([](std::uint32_t size) {
+            return std::to_string(size);
+        });
+    EXPECT_EQ(mapped.getValue(), "6");
+
+    const Result<std::uint32_t> recovered =
+        parse("").orElse([](Status /* status */) { return Result<std::uint32_t>(0U); });
+    EXPECT_EQ(recovered.getValue(), 0U);
+}
+
+TEST_F(ResultModuleTest, ComparesAndHashes)
+{
+    EXPECT_TRUE(parse("ab") == parse("xy"));
+    EXPECT_TRUE(parse("") < parse("a"));
+
+    std::unordered_set<Result<std::uint32_t>> seen;
+    seen.insert(parse("a"));
+    seen.insert(parse("b"));
+    seen.insert(parse(""));
+    EXPECT_EQ(seen.size(), 2U);
+
+    Result<std::uint32_t> a = parse("a");
+    Result<std::uint32_t> b = parse("");
+    swap(a, b);
+    EXPECT_FALSE(a.hasValue());
+    EXPECT_EQ(b.getValue(), 1U);
+}
+
+TEST_F(ResultModuleTest, ExceptionBoundary)
+{
+    const Result<std::uint32_t> error = tryInvoke([]() -> std::uint32_t { throw std::string("failure"); });
+    EXPECT_EQ(error.getError(), Status::ERROR);
+    EXPECT_THROW(parse("").orThrow(), ResultException<Status>);
+    EXPECT_EQ(makeResult<std::string>(2U, 'y').getValue(), "yy");
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
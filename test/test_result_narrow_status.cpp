@@ -0,0 +1,59 @@
+#include "lib/result.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+// Built with INTERVIEW_RESULT_STATUS_TYPE=std::uint8_t:
+static_assert(std::is_same<std::underlying_type_t<Status>, std::uint8_t>::value, "Status must be declared narrow");
+#if !INTERVIEW_RESULT_AUDIT
+static_assert(sizeof(Result<void>) == 1U, "Result<void> must store the status only");
+static_assert(sizeof(Result<std::uint8_t>) == 2U, "discriminant and error code must share the tag byte");
+static_assert(sizeof(Result<std::uint16_t>) == 4U, "discriminant and error code must share the tag byte");
+#endif
+static_assert(sizeof(Result<std::string>) <= sizeof(std::string) + alignof(std::string),
+              "narrow status must fit next to the flag");
+
+class ResultNarrowStatusTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(ResultNarrowStatusTest, ValueAndError)
+{
+    const Result<std::uint16_t> value(std::uint16_t{42U});
+    const Result<std::uint16_t> error = createError(Status::INVALID_ARG);
+    EXPECT_EQ(value.getValue(), 42U);
+    EXPECT_EQ(error.getError(), Status::INVALID_ARG);
+    EXPECT_STREQ(toString(error.getError()), "INVALID_ARG");
+
+    const Result<void> failed(Status::ERROR);
+    EXPECT_FALSE(failed.hasValue());
+    EXPECT_EQ(failed.getError(), Status::ERROR);
+    EXPECT_TRUE(Result<void>().hasValue());
+}
+
+TEST_F(ResultNarrowStatusTest, NonTrivialPayload)
+{
+    Result<std::string> result(Status::ERROR);
+    EXPECT_EQ(result.getError(), Status::ERROR);
+    result = Result<std::string>("value longer than the small string buffer");
+    EXPECT_EQ(result.getValue(), "value longer than the small string buffer");
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
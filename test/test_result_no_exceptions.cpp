@@ -0,0 +1,71 @@
+#include "lib/result.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+static_assert(INTERVIEW_RESULT_HAS_EXCEPTIONS == 0, "This test must be built with -fno-exceptions");
+
+class ResultNoExceptionsTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {}
+    void TearDown() override { setResultTerminateHandler(nullptr); }
+};
+
+void customHandler(const char* message)
+{
+    std::fprintf(stderr, "custom handler: %s\n", message);
+}
+
+TEST_F(ResultNoExceptionsTest, CheckedAccessWithValue)
+{
+    const Result<std::uint32_t> result(42U);
+    EXPECT_EQ(result.getValue(), 42U);
+}
+
+TEST_F(ResultNoExceptionsTest, GetValueAborts)
+{
+    const Result<std::uint32_t> result(Status::ERROR);
+    EXPECT_DEATH(result.getValue(), "No value");
+}
+
+TEST_F(ResultNoExceptionsTest, GetErrorAborts)
+{
+    const Result<std::uint32_t> result(42U);
+    EXPECT_DEATH(result.getError(), "No error");
+}
+
+TEST_F(ResultNoExceptionsTest, CustomHandlerIsCalled)
+{
+    EXPECT_EQ(setResultTerminateHandler(customHandler), nullptr);
+    const Result<std::uint32_t> result(Status::ERROR);
+    EXPECT_DEATH(result.getValue(), "custom handler: No value");
+    EXPECT_EQ(setResultTerminateHandler(nullptr), customHandler);
+}
+
+TEST_F(ResultNoExceptionsTest, TryInvokeInvokes)
+{
+    const Result<std::uint32_t> result = tryInvoke([](std::uint32_t value) { return value * 2U; }, 21U);
+    EXPECT_EQ(result.getValue(), 42U);
+}
+
+TEST_F(ResultNoExceptionsTest, OrThrowAborts)
+{
+    const Result<std::uint32_t> result(Status::ERROR);
+    EXPECT_EQ(Result<std::uint32_t>(7U).orThrow(), 7U);
+    EXPECT_DEATH(result.orThrow(), "No value");
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
@@ -0,0 +1,239 @@
+#include "lib/result_parallel.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+class ResultParallelTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        inputs_.resize(100000U);
+        std::iota(inputs_.begin(), inputs_.end(), 0U);
+    }
+    void TearDown() override {}
+
+    /// @brief Division of the example, fails for the zero divisor.
+    static Result<std::uint32_t> divideNumbers(std::uint32_t dividend, std::uint32_t divisor)
+    {
+        if (divisor == 0U)
+        {
+            return createError(Status::INVALID_ARG);
+        }
+        return dividend / divisor;
+    }
+
+    WorkStealingPool pool_{3U};
+    std::vector<std::uint32_t> inputs_;
+};
+
+TEST_F(ResultParallelTest, ParallelForRunsEveryTaskOnce)
+{
+    constexpr std::size_t kTasks = 5000U;
+    std::vector<std::atomic<std::uint32_t>> runs(kTasks);
+    pool_.parallelFor(kTasks, [&runs](std::size_t task) {
+        // Uneven tasks make the idle threads steal
+        if ((task % 1000U) == 0U)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        runs[task].fetch_add(1U);
+    });
+    for (const auto& run : runs)
+    {
+        EXPECT_EQ(run.load(), 1U);
+    }
+    EXPECT_EQ(pool_.concurrency(), 4U);
+}
+
+TEST_F(ResultParallelTest, TransformAllValues)
+{
+    const auto result =
+        parallelTransform(pool_, inputs_, [](std::uint32_t value) { return divideNumbers(value, 2U); }, 256U);
+    ASSERT_TRUE(result.hasValue());
+    ASSERT_EQ(result->size(), inputs_.size());
+    for (std::size_t index = 0U; index < inputs_.size(); ++index)
+    {
+        EXPECT_EQ((*result)[index], inputs_[index] / 2U);
+    }
+
+    const std::vector<std::uint32_t> empty;
+    EXPECT_TRUE(parallelTransform(pool_, empty, [](std::uint32_t value) { return divideNumbers(1U, value); })
+                    .getValue()
+                    .empty());
+}
+
+TEST_F(ResultParallelTest, TransformReturnsFirstErrorByPosition)
+{
+    std::atomic<std::uint32_t> calls{0U};
+    const auto result = parallelTransform(
+        pool_,
+        inputs_,
+        [&calls](std::uint32_t value) -> Result<std::uint32_t> {
+            calls.fetch_add(1U, std::memory_order_relaxed);
+            if (value == 70000U)
+            {
+                return createError(Status::ERROR);
+            }
+            if (value == 30000U)
+            {
+                return createError(Status::INVALID_ARG);
+            }
+            return value;
+        },
+        64U);
+    // The earlier error wins whichever thread fails first
+    EXPECT_EQ(result.getError(), Status::INVALID_ARG);
+    EXPECT_GE(calls.load(), 30001U);
+}
+
+TEST_F(ResultParallelTest, ErrorCancelsOtherWorkers)
+{
+    std::atomic<std::uint32_t> calls{0U};
+    std::atomic<bool> failed{false};
+    const auto result = parallelTransform(
+        pool_,
+        inputs_,
+        [&calls, &failed](std::uint32_t value) {
+            calls.fetch_add(1U, std::memory_order_relaxed);
+            if (value == 0U)
+            {
+                failed.store(true);
+                return divideNumbers(value, 0U);
+            }
+            // The other threads hold their first element until the first one failed
+            while (!failed.load())
+            {
+                std::this_thread::yield();
+            }
+            return divideNumbers(value, 1U);
+        },
+        16U);
+    EXPECT_EQ(result.getError(), Status::INVALID_ARG);
+    EXPECT_LT(calls.load(), inputs_.size() / 2U);
+}
+
+TEST_F(ResultParallelTest, ReduceFoldsInOrder)
+{
+    const auto sum = parallelReduce(
+        pool_,
+        inputs_,
+        std::uint64_t{0U},
+        [](std::uint32_t value) { return divideNumbers(value, 1U); },
+        [](std::uint64_t a, std::uint64_t b) { return a + b; },
+        512U);
+    EXPECT_EQ(sum.getValue(), (std::uint64_t{99999U} * 100000U) / 2U);
+
+    // Concatenation is associative only, the order of the inputs is kept
+    const std::vector<std::uint32_t> digits{1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U};
+    const auto text = parallelReduce(
+        pool_,
+        digits,
+        std::string(),
+        [](std::uint32_t digit) -> Result<std::string> { return std::to_string(digit); },
+        [](std::string a, const std::string& b) { return a + b; },
+        2U);
+    EXPECT_EQ(text.getValue(), "123456789");
+}
+
+TEST_F(ResultParallelTest, ReduceReturnsFirstError)
+{
+    const auto sum = parallelReduce(
+        pool_,
+        inputs_,
+        std::uint64_t{0U},
+        [](std::uint32_t value) { return divideNumbers(1U, value % 50000U); },
+        [](std::uint64_t a, std::uint64_t b) { return a + b; });
+    EXPECT_EQ(sum.getError(), Status::INVALID_ARG);
+}
+
+TEST_F(ResultParallelTest, ExceptionIsRethrown)
+{
+    EXPECT_THROW(parallelTransform(
+                     pool_,
+                     inputs_,
+                     [](std::uint32_t value) -> Result<std::uint32_t> {
+                         if (value == 5000U)
+                         {
+                             throw std::runtime_error("row rejected");
+                         }
+                         return value;
+                     },
+                     128U),
+                 std::runtime_error);
+    // The pool stays usable
+    EXPECT_TRUE(parallelTransform(pool_, inputs_, [](std::uint32_t value) { return divideNumbers(value, 1U); })
+                    .hasValue());
+}
+
+TEST_F(ResultParallelTest, NestedLoopsRunSequentially)
+{
+    const std::vector<std::uint32_t> rows{1U, 2U, 3U, 4U};
+    const auto result = parallelTransform(
+        pool_,
+        rows,
+        [this](std::uint32_t row) -> Result<std::uint64_t> {
+            return parallelReduce(
+                pool_,
+                inputs_,
+                std::uint64_t{0U},
+                [row](std::uint32_t value) { return divideNumbers(value, row); },
+                [](std::uint64_t a, std::uint64_t b) { return a + b; });
+        },
+        1U);
+    ASSERT_TRUE(result.hasValue());
+    EXPECT_EQ((*result)[0], (std::uint64_t{99999U} * 100000U) / 2U);
+
+    // A loop of another pool in between keeps the outer pool current for the calling thread
+    WorkStealingPool other(2U);
+    std::atomic<std::uint32_t> runs{0U};
+    pool_.parallelFor(8U, [this, &other, &runs](std::size_t) {
+        other.parallelFor(4U, [&runs](std::size_t) { runs.fetch_add(1U); });
+        pool_.parallelFor(4U, [&runs](std::size_t) { runs.fetch_add(1U); });
+    });
+    EXPECT_EQ(runs.load(), 8U * 8U);
+
+    // A loop of the outer pool inside a task of another pool runs sequentially as well
+    runs.store(0U);
+    pool_.parallelFor(4U, [this, &other, &runs](std::size_t) {
+        other.parallelFor(4U, [this, &runs](std::size_t) {
+            pool_.parallelFor(4U, [&runs](std::size_t) { runs.fetch_add(1U); });
+        });
+    });
+    EXPECT_EQ(runs.load(), 4U * 4U * 4U);
+}
+
+TEST_F(ResultParallelTest, GlobalAndSequentialPools)
+{
+    const auto global = parallelTransform(inputs_, [](std::uint32_t value) { return divideNumbers(value, 3U); });
+    ASSERT_TRUE(global.hasValue());
+    EXPECT_EQ(global->back(), 99999U / 3U);
+
+    WorkStealingPool sequential(0U);
+    EXPECT_EQ(sequential.concurrency(), 1U);
+    const auto result = parallelTransform(sequential, inputs_, [](std::uint32_t value) {
+        return divideNumbers(value, (value == 10U) ? 0U : 1U);
+    });
+    EXPECT_EQ(result.getError(), Status::INVALID_ARG);
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
@@ -0,0 +1,210 @@
+#include "lib/result_pipeline.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+/// @brief Endless source of the natural numbers counting the elements read.
+class CountingSource
+{
+  public:
+    using ValueType = std::uint32_t;
+
+    explicit CountingSource(std::size_t& reads) noexcept : reads_(&reads) {}
+
+    std::size_t read(std::vector<std::uint32_t>& batch, std::size_t count)
+    {
+        for (std::size_t index = 0U; index < count; ++index)
+        {
+            batch.push_back(next_++);
+        }
+        *reads_ += count;
+        return count;
+    }
+
+  private:
+    std::size_t* reads_;
+    std::uint32_t next_{0U};
+};
+
+class ResultPipelineTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        numbers_.resize(1000U);
+        std::iota(numbers_.begin(), numbers_.end(), 0U);
+    }
+    void TearDown() override {}
+
+    static Result<std::uint32_t> parse(const std::string& line)
+    {
+        if (line.empty() || (line.find_first_not_of("0123456789") != std::string::npos))
+        {
+            return createError(Status::INVALID_ARG);
+        }
+        return static_cast<std::uint32_t>(std::stoul(line));
+    }
+
+    /// @brief Stage failing with `status` for the element `failing`.
+    static auto failAt(std::uint32_t failing, Status status)
+    {
+        return [failing, status](std::uint32_t value) -> Result<std::uint32_t> {
+            if (value == failing)
+            {
+                return createError(status);
+            }
+            return value;
+        };
+    }
+
+    std::vector<std::uint32_t> numbers_;
+    std::vector<std::uint32_t> delivered_;
+};
+
+TEST_F(ResultPipelineTest, ParsesLinesAndSkipsErrors)
+{
+    std::istringstream file("1\n22\nbroken\n\n333\n");
+    const auto stats =
+        fromLines(file, 2U) | stage(parse, ErrorPolicy::SKIP) |
+        stage([](std::uint32_t value) -> Result<std::uint64_t> { return std::uint64_t{value} * 2U; }) |
+        sink([this](std::uint64_t value) { delivered_.push_back(static_cast<std::uint32_t>(value)); });
+    ASSERT_TRUE(stats.hasValue());
+    EXPECT_EQ(delivered_, (std::vector<std::uint32_t>{2U, 44U, 666U}));
+    EXPECT_EQ(stats->read_, 5U);
+    EXPECT_EQ(stats->batches_, 3U);
+    EXPECT_EQ(stats->delivered_, 3U);
+    EXPECT_EQ(stats->errors_, (std::vector<std::size_t>{2U, 0U}));
+}
+
+TEST_F(ResultPipelineTest, StopKeepsTheFirstErrorByPosition)
+{
+    // The later stage fails for an earlier element of the same batch
+    const auto late = fromRange(numbers_) | stage(failAt(700U, Status::ERROR)) |
+                      stage(failAt(300U, Status::INVALID_ARG)) |
+                      sink([this](std::uint32_t value) { delivered_.push_back(value); });
+    EXPECT_EQ(late.getError(), Status::INVALID_ARG);
+    ASSERT_EQ(delivered_.size(), 300U);
+    EXPECT_EQ(delivered_.back(), 299U);
+
+    // The elements before the failing one reach the sink, the following ones are not processed
+    delivered_.clear();
+    std::uint32_t processed = 0U;
+    const auto early = fromRange(numbers_) | stage(failAt(100U, Status::ERROR)) |
+                       stage([&processed](std::uint32_t value) -> Result<std::uint32_t> {
+                           ++processed;
+                           return failAt(500U, Status::INVALID_ARG)(value);
+                       }) |
+                       sink([this](std::uint32_t value) { delivered_.push_back(value); });
+    EXPECT_EQ(early.getError(), Status::ERROR);
+    EXPECT_EQ(delivered_.size(), 100U);
+    EXPECT_EQ(processed, 100U);
+}
+
+TEST_F(ResultPipelineTest, RoutesErrorsToChannel)
+{
+    std::vector<Status> routed;
+    const auto stats = fromRange(numbers_, 64U) |
+                       stage([](std::uint32_t value) -> Result<std::uint32_t> {
+                           if ((value % 100U) == 0U)
+                           {
+                               return createError(Status::INVALID_ARG);
+                           }
+                           return value;
+                       },
+                             [&routed](const Status& error) { routed.push_back(error); }) |
+                       sink([this](std::uint32_t value) { delivered_.push_back(value); });
+    ASSERT_TRUE(stats.hasValue());
+    EXPECT_EQ(routed, std::vector<Status>(10U, Status::INVALID_ARG));
+    EXPECT_EQ(stats->errors_[0], 10U);
+    EXPECT_EQ(stats->delivered_, 990U);
+    EXPECT_EQ(delivered_.front(), 1U);
+}
+
+TEST_F(ResultPipelineTest, ReadsLazily)
+{
+    std::size_t reads = 0U;
+    std::size_t consumed = 0U;
+    const auto stats = fromSource(CountingSource(reads), 128U) | stage(failAt(1U, Status::ERROR), ErrorPolicy::SKIP) |
+                       sink([&consumed](std::uint32_t) -> Result<void> {
+                           if (++consumed == 1000U)
+                           {
+                               return createError(Status::ERROR);
+                           }
+                           return Result<void>();
+                       });
+    // The endless source stops at the batch of the failing element
+    EXPECT_EQ(stats.getError(), Status::ERROR);
+    EXPECT_EQ(reads, 8U * 128U);
+}
+
+TEST_F(ResultPipelineTest, MoveOnlyValues)
+{
+    std::vector<std::unique_ptr<std::uint32_t>> owned;
+    const auto stats =
+        fromRange(numbers_, 0U) |
+        stage([](std::uint32_t value) -> Result<std::unique_ptr<std::uint32_t>> {
+            return std::make_unique<std::uint32_t>(value);
+        }) |
+        stage([](std::unique_ptr<std::uint32_t> value) -> Result<std::unique_ptr<std::uint32_t>> {
+            *value += 1U;
+            return value;
+        }) |
+        sink([&owned](std::unique_ptr<std::uint32_t> value) { owned.push_back(std::move(value)); });
+    ASSERT_TRUE(stats.hasValue());
+    EXPECT_EQ(stats->batches_, numbers_.size());  // A batch size of 0 reads one element at a time
+    ASSERT_EQ(owned.size(), numbers_.size());
+    EXPECT_EQ(*owned.back(), 1000U);
+}
+
+TEST_F(ResultPipelineTest, RangeElements)
+{
+    // The elements of a forward range are read in place
+    const std::vector<std::string> lines{"4", "5"};
+    std::vector<const std::string*> addresses;
+    const auto stats = fromRange(lines) | stage([&addresses](const std::string& line) {
+                           addresses.push_back(&line);
+                           return parse(line);
+                       }) |
+                       sink([this](std::uint32_t value) { delivered_.push_back(value); });
+    ASSERT_TRUE(stats.hasValue());
+    EXPECT_EQ(addresses, (std::vector<const std::string*>{&lines[0], &lines[1]}));
+
+    // Input iterators are copied, their reference is not stable
+    std::istringstream file("6 7 8");
+    EXPECT_TRUE((fromRange(std::istream_iterator<std::uint32_t>(file), std::istream_iterator<std::uint32_t>()) |
+                 sink([this](std::uint32_t value) { delivered_.push_back(value); }))
+                    .hasValue());
+    EXPECT_EQ(delivered_, (std::vector<std::uint32_t>{4U, 5U, 6U, 7U, 8U}));
+}
+
+TEST_F(ResultPipelineTest, SinkWithoutStages)
+{
+    const auto stats = fromRange(numbers_.begin(), numbers_.begin() + 10) |
+                       sink([this](std::uint32_t value) { delivered_.push_back(value); });
+    ASSERT_TRUE(stats.hasValue());
+    EXPECT_EQ(stats->delivered_, 10U);
+    EXPECT_TRUE(stats->errors_.empty());
+
+    std::istringstream empty;
+    EXPECT_EQ((fromLines(empty) | stage(parse) | sink([](std::uint32_t) {})).getValue().read_, 0U);
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
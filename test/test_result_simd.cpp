@@ -0,0 +1,205 @@
+#include "lib/result_simd.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+class ResultSimdTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override
+    {
+        levels_.clear();
+        for (const SimdLevel level : {SimdLevel::SCALAR, SimdLevel::NEON, SimdLevel::AVX2, SimdLevel::AVX512})
+        {
+            if (isSimdLevelSupported(level))
+            {
+                levels_.push_back(level);
+            }
+        }
+    }
+    void TearDown() override {}
+
+    /// @brief Builds a batch of `size` rows, each row holds an error with probability `errorRate`.
+    static ResultVector<std::uint32_t> makeBatch(std::size_t size, double errorRate, std::uint32_t seed)
+    {
+        std::mt19937 generator(seed);
+        std::bernoulli_distribution isError(errorRate);
+        ResultVector<std::uint32_t> results;
+        for (std::size_t i = 0U; i < size; ++i)
+        {
+            if (isError(generator))
+            {
+                results.pushError(Status::ERROR);
+            }
+            else
+            {
+                results.pushValue(static_cast<std::uint32_t>(i * 3U));
+            }
+        }
+        return results;
+    }
+
+    /// @brief Checks all kernels of all supported levels against a row by row loop.
+    void expectMatchesReference(const ResultVector<std::uint32_t>& results) const
+    {
+        std::size_t first = results.size();
+        std::vector<std::uint32_t> ok;
+        std::vector<std::uint32_t> failed;
+        std::vector<std::uint32_t> values;
+        for (std::size_t i = 0U; i < results.size(); ++i)
+        {
+            if (results.isOk(i))
+            {
+                ok.push_back(static_cast<std::uint32_t>(i));
+                values.push_back(results.valueAt(i));
+            }
+            else
+            {
+                first = (first == results.size()) ? i : first;
+                failed.push_back(static_cast<std::uint32_t>(i));
+            }
+        }
+
+        for (const SimdLevel level : levels_)
+        {
+            SCOPED_TRACE(std::string(simdLevelName(level)) + ", size " + std::to_string(results.size()));
+            EXPECT_EQ(anyError(results.validity(), results.size(), level), !results.allOk());
+            EXPECT_EQ(firstError(results, level), first);
+
+            std::vector<std::uint32_t> okOut;
+            std::vector<std::uint32_t> failedOut;
+            partition(results, okOut, failedOut, level);
+            EXPECT_EQ(okOut, ok);
+            EXPECT_EQ(failedOut, failed);
+
+            std::vector<std::uint32_t> valuesOut;
+            compressValues(results, valuesOut, level);
+            EXPECT_EQ(valuesOut, values);
+        }
+    }
+
+    std::vector<SimdLevel> levels_; /* Levels supported by the CPU. */
+};
+
+TEST_F(ResultSimdTest, ScalarAlwaysSupported)
+{
+    EXPECT_TRUE(isSimdLevelSupported(SimdLevel::SCALAR));
+    EXPECT_TRUE(isSimdLevelSupported(bestSimdLevel()));
+}
+
+TEST_F(ResultSimdTest, Empty)
+{
+    expectMatchesReference(ResultVector<std::uint32_t>());
+}
+
+TEST_F(ResultSimdTest, AllValues)
+{
+    for (const std::size_t size : {1U, 7U, 64U, 1000U, 1024U})
+    {
+        expectMatchesReference(makeBatch(size, 0.0, 1U));
+    }
+}
+
+TEST_F(ResultSimdTest, AllErrors)
+{
+    for (const std::size_t size : {1U, 15U, 64U, 1000U})
+    {
+        expectMatchesReference(makeBatch(size, 1.0, 2U));
+    }
+}
+
+TEST_F(ResultSimdTest, RandomErrors)
+{
+    for (const std::size_t size : {3U, 17U, 63U, 65U, 129U, 1031U, 65536U})
+    {
+        expectMatchesReference(makeBatch(size, 0.3, static_cast<std::uint32_t>(size)));
+    }
+}
+
+TEST_F(ResultSimdTest, SingleErrorPosition)
+{
+    // The error is placed at the start, in the middle of a vector block and in the last rows
+    for (const std::size_t position : {0U, 9U, 1024U, 1100U, 4095U})
+    {
+        ResultVector<std::uint32_t> results;
+        for (std::size_t i = 0U; i < 4096U; ++i)
+        {
+            if (i == position)
+            {
+                results.pushError(Status::INVALID_ARG);
+            }
+            else
+            {
+                results.pushValue(static_cast<std::uint32_t>(i));
+            }
+        }
+        expectMatchesReference(results);
+    }
+}
+
+TEST_F(ResultSimdTest, BlockOfLargerBatch)
+{
+    const ResultVector<std::uint32_t> results = makeBatch(4096U, 0.001, 7U);
+    const std::size_t words = 1024U / ResultVector<std::uint32_t>::kBitsPerWord;
+    for (std::size_t block = 0U; block < 4U; ++block)
+    {
+        const Span<const std::uint64_t> validity = results.validity().subspan(block * words, words);
+        std::size_t expected = 1024U;
+        for (std::size_t i = 0U; i < 1024U; ++i)
+        {
+            if (!results.isOk((block * 1024U) + i))
+            {
+                expected = i;
+                break;
+            }
+        }
+        EXPECT_EQ(firstError(validity, 1024U), expected);
+    }
+}
+
+TEST_F(ResultSimdTest, SignedAndNonTrivialValues)
+{
+    ResultVector<std::int32_t> numbers;
+    ResultVector<std::string> strings;
+    for (std::int32_t i = -20; i < 20; ++i)
+    {
+        if ((i % 3) == 0)
+        {
+            numbers.pushError(Status::ERROR);
+            strings.pushError(Status::ERROR);
+        }
+        else
+        {
+            numbers.pushValue(i);
+            strings.pushValue(std::to_string(i));
+        }
+    }
+
+    std::vector<std::int32_t> numbersOut;
+    std::vector<std::string> stringsOut;
+    compressValues(numbers, numbersOut);
+    compressValues(strings, stringsOut);
+    ASSERT_EQ(numbersOut.size(), numbers.size() - numbers.countErrors());
+    ASSERT_EQ(stringsOut.size(), numbersOut.size());
+    EXPECT_EQ(numbersOut.front(), -20);
+    EXPECT_EQ(stringsOut.front(), "-20");
+    EXPECT_EQ(numbersOut.back(), 19);
+    EXPECT_EQ(stringsOut.back(), "19");
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
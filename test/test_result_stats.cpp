@@ -0,0 +1,156 @@
+#include "lib/result_stats.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+static_assert(INTERVIEW_RESULT_STATS == 1, "This test must be built with INTERVIEW_RESULT_STATS=1");
+
+class ResultStatsTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+
+    /// @brief Get the number of errors counted for the line of this file with the code.
+    static std::uint64_t countAt(std::uint32_t line, std::size_t code)
+    {
+        const ResultStatsSnapshot snapshot = takeResultStatsSnapshot();
+        const ResultCallSiteStats* callSite = snapshot.find(__FILE__, line);
+        return (callSite != nullptr) ? callSite->counts_[code] : 0U;
+    }
+};
+
+constexpr std::uint32_t kFailLine = __LINE__ + 3U;
+Result<std::uint32_t> fail(Status status)
+{
+    return createError(status);
+}
+
+constexpr std::uint32_t kFailStringLine = __LINE__ + 3U;
+Result<std::uint32_t, std::string> failString()
+{
+    return createError(std::string("not an enumeration"));
+}
+
+constexpr std::uint32_t kPropagateLine = __LINE__ + 3U;
+Result<std::uint32_t> propagate(Status status)
+{
+    RESULT_TRY(const std::uint32_t value, fail(status));
+    return value + 1U;
+}
+
+#if INTERVIEW_RESULT_HAS_CONSTEXPR
+constexpr Result<std::uint32_t> constexprFail()
+{
+    return createError(Status::INVALID_ARG);
+}
+#endif
+
+TEST_F(ResultStatsTest, Enabled)
+{
+    EXPECT_TRUE(resultStatsEnabled());
+}
+
+TEST_F(ResultStatsTest, CountsPerCode)
+{
+    const std::uint64_t invalidBefore = countAt(kFailLine, static_cast<std::size_t>(Status::INVALID_ARG));
+    const std::uint64_t errorBefore = countAt(kFailLine, static_cast<std::size_t>(Status::ERROR));
+    for (std::uint32_t i = 0U; i < 3U; ++i)
+    {
+        EXPECT_FALSE(fail(Status::INVALID_ARG).hasValue());
+    }
+    for (std::uint32_t i = 0U; i < 2U; ++i)
+    {
+        EXPECT_FALSE(fail(Status::ERROR).hasValue());
+    }
+    EXPECT_EQ(countAt(kFailLine, static_cast<std::size_t>(Status::INVALID_ARG)), invalidBefore + 3U);
+    EXPECT_EQ(countAt(kFailLine, static_cast<std::size_t>(Status::ERROR)), errorBefore + 2U);
+}
+
+TEST_F(ResultStatsTest, CallSiteLocation)
+{
+    EXPECT_FALSE(fail(Status::ERROR).hasValue());
+    const ResultStatsSnapshot snapshot = takeResultStatsSnapshot();
+    const ResultCallSiteStats* callSite = snapshot.find(__FILE__, kFailLine);
+    ASSERT_NE(callSite, nullptr);
+    EXPECT_NE(std::string(callSite->function_).find("fail"), std::string::npos);
+    EXPECT_GE(callSite->total_, 1U);
+}
+
+TEST_F(ResultStatsTest, NonEnumErrorsAreCountedAsOther)
+{
+    const std::size_t other = kResultStatsCodeCount - 1U;
+    const std::uint64_t before = countAt(kFailStringLine, other);
+    EXPECT_FALSE(failString().hasValue());
+    EXPECT_EQ(countAt(kFailStringLine, other), before + 1U);
+}
+
+TEST_F(ResultStatsTest, PropagationIsCountedAtEachLevel)
+{
+    const std::size_t code = static_cast<std::size_t>(Status::INVALID_ARG);
+    const std::uint64_t failBefore = countAt(kFailLine, code);
+    const std::uint64_t propagateBefore = countAt(kPropagateLine, code);
+    EXPECT_FALSE(propagate(Status::INVALID_ARG).hasValue());
+    EXPECT_EQ(countAt(kFailLine, code), failBefore + 1U);
+    EXPECT_EQ(countAt(kPropagateLine, code), propagateBefore + 1U);
+}
+
+TEST_F(ResultStatsTest, CountsOfAllThreads)
+{
+    const std::size_t code = static_cast<std::size_t>(Status::ERROR);
+    const std::uint64_t before = countAt(kFailLine, code);
+    std::vector<std::thread> threads;
+    for (std::uint32_t thread = 0U; thread < 4U; ++thread)
+    {
+        threads.emplace_back([]() {
+            for (std::uint32_t i = 0U; i < 1000U; ++i)
+            {
+                (void)fail(Status::ERROR);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    // The counters of the exited threads are kept
+    EXPECT_EQ(countAt(kFailLine, code), before + 4000U);
+}
+
+#if INTERVIEW_RESULT_HAS_CONSTEXPR
+TEST_F(ResultStatsTest, ConstantEvaluationIsNotCounted)
+{
+    constexpr Result<std::uint32_t> result = constexprFail();
+    static_assert(!result.hasValue(), "createError must stay usable in constant expressions");
+    EXPECT_EQ(result.getError(), Status::INVALID_ARG);
+}
+#endif
+
+TEST_F(ResultStatsTest, Dump)
+{
+    EXPECT_FALSE(fail(Status::INVALID_ARG).hasValue());
+    std::ostringstream out;
+    dumpResultStats(out);
+    const std::string dump = out.str();
+    const std::string location = std::string(__FILE__) + ":" + std::to_string(kFailLine) + " ";
+    EXPECT_NE(dump.find(location), std::string::npos);
+    EXPECT_NE(dump.find("INVALID_ARG="), std::string::npos);
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
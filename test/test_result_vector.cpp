@@ -0,0 +1,224 @@
+#include "lib/result_vector.hpp"
+#include "lib/rich_error.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+class ResultVectorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+TEST_F(ResultVectorTest, Empty)
+{
+    const ResultVector<std::uint32_t> results;
+    EXPECT_TRUE(results.empty());
+    EXPECT_EQ(results.size(), 0U);
+    EXPECT_TRUE(results.allOk());
+    EXPECT_EQ(results.countErrors(), 0U);
+    EXPECT_TRUE(results.values().empty());
+    EXPECT_TRUE(results.validity().empty());
+    EXPECT_TRUE(results.begin() == results.end());
+}
+
+TEST_F(ResultVectorTest, ValuesAndErrors)
+{
+    ResultVector<std::uint32_t> results;
+    results.pushValue(1U);
+    results.pushError(Status::INVALID_ARG);
+    results.pushBack(Result<std::uint32_t>(3U));
+    results.pushBack(Result<std::uint32_t>(Status::ERROR));
+
+    EXPECT_EQ(results.size(), 4U);
+    EXPECT_FALSE(results.allOk());
+    EXPECT_EQ(results.countErrors(), 2U);
+    EXPECT_TRUE(results.isOk(0U));
+    EXPECT_FALSE(results.isOk(1U));
+    EXPECT_TRUE(results.isOk(2U));
+    EXPECT_FALSE(results.isOk(3U));
+    EXPECT_EQ(results[0U].getValue(), 1U);
+    EXPECT_EQ(results[1U].getError(), Status::INVALID_ARG);
+    EXPECT_EQ(results[2U].getValue(), 3U);
+    EXPECT_EQ(results.errorAt(3U), Status::ERROR);
+}
+
+TEST_F(ResultVectorTest, DenseValues)
+{
+    ResultVector<std::uint32_t> results;
+    results.pushValue(10U);
+    results.pushError(Status::ERROR);
+    results.pushValue(30U);
+
+    const Span<const std::uint32_t> values = results.values();
+    ASSERT_EQ(values.size(), 3U);
+    EXPECT_EQ(values[0U], 10U);
+    EXPECT_EQ(values[1U], 0U);  // Placeholder of the error element
+    EXPECT_EQ(values[2U], 30U);
+}
+
+TEST_F(ResultVectorTest, ValidityBitmap)
+{
+    ResultVector<std::uint32_t> results;
+    results.reserve(130U);
+    for (std::uint32_t i = 0U; i < 130U; ++i)
+    {
+        if ((i % 64U) == 5U)
+        {
+            results.pushError(Status::ERROR);
+        }
+        else
+        {
+            results.pushValue(i);
+        }
+    }
+
+    const Span<const std::uint64_t> validity = results.validity();
+    ASSERT_EQ(validity.size(), 3U);
+    EXPECT_EQ(validity[0U], ~(std::uint64_t{1U} << 5U));
+    EXPECT_EQ(validity[1U], ~(std::uint64_t{1U} << 5U));
+    EXPECT_EQ(validity[2U], 0x3U);  // Bits past size() are zero
+    EXPECT_EQ(results.countErrors(), 2U);
+
+    std::size_t setBits = 0U;
+    for (const std::uint64_t word : validity)
+    {
+        setBits += static_cast<std::size_t>(__builtin_popcountll(word));
+    }
+    EXPECT_EQ(setBits, results.size() - results.countErrors());
+}
+
+TEST_F(ResultVectorTest, ErrorList)
+{
+    ResultVector<std::uint32_t> results;
+    results.pushValue(1U);
+    results.pushError(Status::INVALID_ARG);
+    results.pushValue(2U);
+    results.pushError(Status::ERROR);
+
+    const auto errors = results.errors();
+    ASSERT_EQ(errors.size(), 2U);
+    EXPECT_EQ(errors[0U].index_, 1U);
+    EXPECT_EQ(errors[0U].error_, Status::INVALID_ARG);
+    EXPECT_EQ(errors[1U].index_, 3U);
+    EXPECT_EQ(errors[1U].error_, Status::ERROR);
+}
+
+TEST_F(ResultVectorTest, IterateAsResults)
+{
+    const std::vector<Result<std::uint32_t>> input = {Result<std::uint32_t>(1U), Result<std::uint32_t>(Status::ERROR),
+                                                      Result<std::uint32_t>(Status::INVALID_ARG),
+                                                      Result<std::uint32_t>(4U)};
+    ResultVector<std::uint32_t> results;
+    for (const auto& result : input)
+    {
+        results.pushBack(result);
+    }
+
+    std::size_t index = 0U;
+    for (const Result<std::uint32_t> result : results)
+    {
+        ASSERT_LT(index, input.size());
+        EXPECT_EQ(result.hasValue(), input[index].hasValue());
+        if (result.hasValue())
+        {
+            EXPECT_EQ(result.getValue(), input[index].getValue());
+        }
+        else
+        {
+            EXPECT_EQ(result.getError(), input[index].getError());
+        }
+        ++index;
+    }
+    EXPECT_EQ(index, input.size());
+}
+
+TEST_F(ResultVectorTest, NonTrivialTypes)
+{
+    ResultVector<std::string, RichError> results;
+    results.pushValue(std::string("first"));
+    results.pushError(RichError(Status::ERROR, "a message which does not fit inline"));
+    Result<std::string, RichError> moved(std::string("third"));
+    results.pushBack(std::move(moved));
+
+    EXPECT_EQ(results[0U].getValue(), "first");
+    EXPECT_STREQ(results[1U].getError().message(), "a message which does not fit inline");
+    EXPECT_EQ(results.valueAt(2U), "third");
+}
+
+/// @brief Value whose default construction throws while `failPlaceholders` is set.
+bool failPlaceholders = false;
+
+struct ThrowingPlaceholder
+{
+    ThrowingPlaceholder()
+    {
+        if (failPlaceholders)
+        {
+            throw std::runtime_error("placeholder");
+        }
+    }
+};
+
+/// @brief Error whose copies throw, like a message failing to allocate.
+struct ThrowingError
+{
+    ThrowingError() = default;
+    ThrowingError(const ThrowingError& /* other */) { throw std::runtime_error("copy"); }
+    ThrowingError(ThrowingError&&) noexcept = default;
+    ThrowingError& operator=(const ThrowingError&) = default;
+    ThrowingError& operator=(ThrowingError&&) noexcept = default;
+};
+
+TEST_F(ResultVectorTest, FailedPushLeavesNoElement)
+{
+    ResultVector<ThrowingPlaceholder, ThrowingError> results;
+    results.pushValue(ThrowingPlaceholder());
+    failPlaceholders = true;
+    EXPECT_THROW(results.pushError(ThrowingError()), std::runtime_error);
+    failPlaceholders = false;
+    const ThrowingError error;
+    EXPECT_THROW(results.pushError(error), std::runtime_error);
+    EXPECT_EQ(results.size(), 1U);
+    EXPECT_EQ(results.values().size(), 1U);
+    EXPECT_TRUE(results.allOk());
+
+    results.pushError(ThrowingError());
+    EXPECT_EQ(results.size(), 2U);
+    EXPECT_FALSE(results.isOk(1U));
+    ASSERT_EQ(results.countErrors(), 1U);
+    EXPECT_EQ(results.errors()[0U].index_, 1U);
+}
+
+TEST_F(ResultVectorTest, Clear)
+{
+    ResultVector<std::uint32_t> results;
+    results.pushValue(1U);
+    results.pushError(Status::ERROR);
+    results.clear();
+    EXPECT_TRUE(results.empty());
+    EXPECT_TRUE(results.allOk());
+    EXPECT_TRUE(results.validity().empty());
+
+    results.pushValue(2U);
+    EXPECT_TRUE(results.isOk(0U));
+    EXPECT_EQ(results.validity()[0U], 1U);
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
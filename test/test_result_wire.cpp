@@ -0,0 +1,287 @@
+#include "lib/result_wire.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+/// @brief Sample sent by the workers, trivially copyable.
+struct Sample
+{
+    std::uint64_t id_;
+    double values_[3];
+};
+
+/// @brief Reading of a sensor, trivially copyable with padding between its members.
+struct PaddedReading
+{
+    std::uint8_t channel_;
+    std::uint32_t value_;
+};
+
+/// @brief Name of a sensor, not trivially copyable, encoded by the traits below.
+struct SensorName
+{
+    std::string name_;
+};
+
+/// @brief Channel of a sample, an error code enumeration encoded by the default traits.
+enum class Channel : std::uint8_t
+{
+    LEFT = 0,
+    RIGHT
+};
+
+}  // namespace test
+
+/// @brief `Channel` codes are `0 .. 1`.
+template <>
+struct ResultErrorCodeTraits<test::Channel>
+{
+    static constexpr std::size_t kCount = 2U;
+};
+
+/// @brief Encodes the name as its length followed by at most 31 characters, viewed without copying.
+template <>
+struct ResultWireTraits<test::SensorName>
+{
+    using ViewType = Span<const char>;
+
+    static constexpr std::size_t kSize = 32U;
+    static constexpr std::size_t kAlignment = 1U;
+
+    static bool encode(const test::SensorName& value, unsigned char* payload) noexcept
+    {
+        if (value.name_.size() >= kSize)
+        {
+            return false;
+        }
+        payload[0] = static_cast<unsigned char>(value.name_.size());
+        std::memcpy(payload + 1U, value.name_.data(), value.name_.size());
+        return true;
+    }
+
+    static ViewType view(const unsigned char* payload) noexcept
+    {
+        return ViewType(reinterpret_cast<const char*>(payload + 1U), payload[0]);
+    }
+
+    static test::SensorName decode(const unsigned char* payload)
+    {
+        const ViewType name = view(payload);
+        return test::SensorName{std::string(name.data(), name.size())};
+    }
+};
+
+namespace test
+{
+
+using namespace interview::library;
+
+class ResultWireTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override { std::fill(std::begin(buffer_), std::end(buffer_), 0xAAU); }
+    void TearDown() override {}
+
+    Span<unsigned char> buffer() noexcept { return Span<unsigned char>(buffer_); }
+
+    alignas(16) unsigned char buffer_[256];
+    const Sample sample_{42U, {1.5, -2.0, 3.25}};
+};
+
+TEST_F(ResultWireTest, FrameLayout)
+{
+    EXPECT_EQ(resultWireSize<Sample>(), 8U + sizeof(Sample));
+    EXPECT_EQ(resultWireAlignment<Sample>(), alignof(Sample));
+    EXPECT_EQ(resultWireSize<std::uint8_t>(), 12U);  // Rounded up to the alignment of the status
+    EXPECT_EQ(resultWireAlignment<std::uint8_t>(), 4U);
+    EXPECT_EQ(resultWireSize<SensorName>(), 40U);
+
+    ASSERT_EQ(serializeInto(buffer(), Result<Sample>(sample_)).getValue(), resultWireSize<Sample>());
+    EXPECT_EQ(buffer_[0], kResultWireVersion);
+    EXPECT_EQ(buffer_[1], 1U);
+    std::uint16_t size = 0U;
+    std::memcpy(&size, buffer_ + 2U, sizeof(size));
+    EXPECT_EQ(size, sizeof(Sample));
+    std::uint32_t status = 0xFFU;
+    std::memcpy(&status, buffer_ + 4U, sizeof(status));
+    EXPECT_EQ(status, static_cast<std::uint32_t>(Status::OK));
+    EXPECT_EQ(std::memcmp(buffer_ + 8U, &sample_, sizeof(Sample)), 0);
+    EXPECT_EQ(buffer_[resultWireSize<Sample>()], 0xAAU);  // Nothing written past the frame
+}
+
+TEST_F(ResultWireTest, ViewReadsValueInPlace)
+{
+    ASSERT_TRUE(serializeInto(buffer(), Result<Sample>(sample_)).hasValue());
+    const Result<ResultView<Sample>> view = ResultView<Sample>::fromBuffer(buffer());
+    ASSERT_TRUE(view.hasValue());
+    ASSERT_TRUE(view->hasValue());
+    const Sample& sample = view->getValue();
+    EXPECT_EQ(reinterpret_cast<const unsigned char*>(&sample), buffer_ + 8U);
+    EXPECT_EQ(sample.id_, 42U);
+    EXPECT_EQ((**view).values_[2], 3.25);
+
+    const Result<Sample> decoded = view->toResult();
+    ASSERT_TRUE(decoded.hasValue());
+    EXPECT_EQ(decoded->values_[1], -2.0);
+    EXPECT_THROW(view->getError(), std::runtime_error);
+}
+
+TEST_F(ResultWireTest, ErrorFrames)
+{
+    ASSERT_TRUE(serializeInto(buffer(), Result<Sample>(createError(Status::INVALID_ARG))).hasValue());
+    EXPECT_EQ(buffer_[1], 0U);
+    const unsigned char zeros[sizeof(Sample)] = {};
+    EXPECT_EQ(std::memcmp(buffer_ + 8U, zeros, sizeof(zeros)), 0);  // The payload is zeroed
+
+    const ResultView<Sample> view = ResultView<Sample>::fromBuffer(buffer()).getValue();
+    EXPECT_FALSE(view);
+    EXPECT_EQ(view.getError(), Status::INVALID_ARG);
+    EXPECT_THROW(view.getValue(), std::runtime_error);
+    EXPECT_EQ(view.toResult().getError(), Status::INVALID_ARG);
+}
+
+TEST_F(ResultWireTest, RejectsSmallOrMisalignedBuffers)
+{
+    const Result<Sample> sample(sample_);
+    EXPECT_EQ(serializeInto(buffer().subspan(0U, resultWireSize<Sample>() - 1U), sample).getError(),
+              Status::INVALID_ARG);
+    EXPECT_EQ(serializeInto(buffer().subspan(4U, 128U), sample).getError(), Status::INVALID_ARG);
+    EXPECT_EQ(buffer_[0], 0xAAU);
+
+    ASSERT_TRUE(serializeInto(buffer(), sample).hasValue());
+    const Span<const unsigned char> frame = buffer();
+    EXPECT_EQ(ResultView<Sample>::fromBuffer(frame.subspan(0U, resultWireSize<Sample>() - 1U)).getError(),
+              Status::INVALID_ARG);
+    EXPECT_EQ(ResultView<Sample>::fromBuffer(frame.subspan(8U, 128U)).getError(), Status::INVALID_ARG);
+}
+
+TEST_F(ResultWireTest, RejectsForeignFrames)
+{
+    // Another payload type
+    ASSERT_TRUE(serializeInto(buffer(), Result<std::uint32_t>(7U)).hasValue());
+    EXPECT_EQ(ResultView<Sample>::fromBuffer(buffer()).getError(), Status::INVALID_ARG);
+    EXPECT_EQ(ResultView<std::uint32_t>::fromBuffer(buffer()).getValue().getValue(), 7U);
+
+    // Another version
+    buffer_[0] = kResultWireVersion + 1U;
+    EXPECT_EQ(ResultView<std::uint32_t>::fromBuffer(buffer()).getError(), Status::INVALID_ARG);
+
+    // Unknown kind
+    buffer_[0] = kResultWireVersion;
+    buffer_[1] = 2U;
+    EXPECT_EQ(ResultView<std::uint32_t>::fromBuffer(buffer()).getError(), Status::INVALID_ARG);
+}
+
+TEST_F(ResultWireTest, ZeroesPadding)
+{
+    ASSERT_TRUE(serializeInto(buffer(), Result<std::uint8_t>(std::uint8_t{7U})).hasValue());
+    EXPECT_EQ(buffer_[8], 7U);
+    EXPECT_EQ(buffer_[9], 0U);
+    EXPECT_EQ(buffer_[11], 0U);
+    EXPECT_EQ(buffer_[resultWireSize<std::uint8_t>()], 0xAAU);  // Nothing written past the frame
+}
+
+TEST_F(ResultWireTest, RejectsErrorFramesWithoutErrorCode)
+{
+    ASSERT_TRUE(serializeInto(buffer(), Result<std::uint16_t>(createError(Status::ERROR))).hasValue());
+    ASSERT_TRUE(ResultView<std::uint16_t>::fromBuffer(buffer()).hasValue());
+
+    // A status past the codes would be packed into the value tag of Result<std::uint16_t>
+    const std::uint32_t statuses[] = {0xFFU, static_cast<std::uint32_t>(Status::OK),
+                                      static_cast<std::uint32_t>(ResultErrorCodeTraits<Status>::kCount)};
+    for (const std::uint32_t status : statuses)
+    {
+        std::memcpy(buffer_ + 4U, &status, sizeof(status));
+        EXPECT_EQ(ResultView<std::uint16_t>::fromBuffer(buffer()).getError(), Status::INVALID_ARG);
+    }
+}
+
+TEST_F(ResultWireTest, RejectsPayloadsOfNoValue)
+{
+    ASSERT_TRUE(serializeInto(buffer(), Result<bool>(true)).hasValue());
+    EXPECT_TRUE(ResultView<bool>::fromBuffer(buffer()).getValue().getValue());
+
+    // Reading a bool of another byte than 0 or 1 is undefined behaviour
+    buffer_[8] = 0x7FU;
+    EXPECT_EQ(ResultView<bool>::fromBuffer(buffer()).getError(), Status::INVALID_ARG);
+
+    // Nor is reading an enumeration of no code
+    ASSERT_TRUE(serializeInto(buffer(), Result<Channel>(Channel::RIGHT)).hasValue());
+    EXPECT_EQ(ResultView<Channel>::fromBuffer(buffer()).getValue().getValue(), Channel::RIGHT);
+    buffer_[8] = 2U;
+    EXPECT_EQ(ResultView<Channel>::fromBuffer(buffer()).getError(), Status::INVALID_ARG);
+}
+
+TEST_F(ResultWireTest, PaddingInsideValueCopiedAsIs)
+{
+    static_assert(sizeof(PaddedReading) > (sizeof(std::uint8_t) + sizeof(std::uint32_t)), "reading without padding");
+    constexpr std::size_t kPadding = offsetof(PaddedReading, value_) - sizeof(std::uint8_t);
+
+    // The padding of the value held by the result, copies of the value need not keep it
+    Result<PaddedReading> result(PaddedReading{});
+    PaddedReading& reading = result.getValue();
+    std::memset(&reading, 0x5A, sizeof(reading));
+    reading.channel_ = 1U;
+    reading.value_ = 7U;
+    ASSERT_TRUE(serializeInto(buffer(), result).hasValue());
+    EXPECT_EQ(std::memcmp(buffer_ + 8U, &reading, sizeof(reading)), 0);
+    EXPECT_TRUE(std::all_of(buffer_ + 9U, buffer_ + 9U + kPadding, [](unsigned char byte) { return byte == 0x5AU; }));
+    EXPECT_EQ(ResultView<PaddedReading>::fromBuffer(buffer()).getValue().getValue().value_, 7U);
+
+    // Zeroing the value before setting its members keeps the padding of the frame zero
+    std::memset(&reading, 0, sizeof(reading));
+    reading.channel_ = 1U;
+    reading.value_ = 7U;
+    ASSERT_TRUE(serializeInto(buffer(), result).hasValue());
+    EXPECT_TRUE(std::all_of(buffer_ + 9U, buffer_ + 9U + kPadding, [](unsigned char byte) { return byte == 0U; }));
+}
+
+TEST_F(ResultWireTest, FramesInArray)
+{
+    constexpr std::size_t kFrameSize = resultWireSize<std::uint16_t>();
+    std::vector<Result<std::uint16_t>> results;
+    for (std::uint16_t slot = 0U; slot < 16U; ++slot)
+    {
+        results.push_back((slot % 5U) == 0U ? Result<std::uint16_t>(createError(Status::ERROR))
+                                            : Result<std::uint16_t>(slot));
+        ASSERT_TRUE(serializeInto(buffer().subspan(slot * kFrameSize, kFrameSize), results.back()).hasValue());
+    }
+    for (std::size_t slot = 0U; slot < results.size(); ++slot)
+    {
+        const auto view = ResultView<std::uint16_t>::fromBuffer(buffer().subspan(slot * kFrameSize, kFrameSize));
+        ASSERT_TRUE(view.hasValue());
+        EXPECT_EQ(view->toResult(), results[slot]);
+    }
+}
+
+TEST_F(ResultWireTest, CustomTraits)
+{
+    ASSERT_TRUE(serializeInto(buffer(), Result<SensorName>(SensorName{"pressure"})).hasValue());
+    const ResultView<SensorName> view = ResultView<SensorName>::fromBuffer(buffer()).getValue();
+    const Span<const char> name = view.getValue();
+    EXPECT_EQ(std::string(name.data(), name.size()), "pressure");
+    EXPECT_EQ(reinterpret_cast<const unsigned char*>(name.data()), buffer_ + 9U);
+    EXPECT_EQ(view.toResult()->name_, "pressure");
+
+    // Not representable
+    EXPECT_EQ(serializeInto(buffer(), Result<SensorName>(SensorName{std::string(40U, 'x')})).getError(),
+              Status::INVALID_ARG);
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview
@@ -0,0 +1,183 @@
+#include "lib/rich_error.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cerrno>
+#include <cstddef>
+#include <new>
+#include <string>
+
+namespace interview
+{
+namespace library
+{
+namespace test
+{
+
+using namespace interview::library;
+
+class RichErrorTest : public ::testing::Test
+{
+  protected:
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+static_assert(sizeof(RichError) == 24U, "RichError must stay compact");
+
+TEST_F(RichErrorTest, CodeOnly)
+{
+    const RichError error(Status::INVALID_ARG);
+    EXPECT_EQ(error.code(), Status::INVALID_ARG);
+    EXPECT_FALSE(error.hasMessage());
+    EXPECT_FALSE(error.hasPayload());
+    EXPECT_STREQ(error.message(), "");
+}
+
+TEST_F(RichErrorTest, InlineMessage)
+{
+    const RichError error(Status::ERROR, "short message");
+    EXPECT_EQ(error.code(), Status::ERROR);
+    EXPECT_TRUE(error.hasMessage());
+    EXPECT_FALSE(error.isHeapAllocated());
+    EXPECT_STREQ(error.message(), "short message");
+    EXPECT_EQ(error.messageSize(), 13U);
+}
+
+TEST_F(RichErrorTest, HeapMessage)
+{
+    const std::string text(100, 'x');
+    const RichError error(Status::ERROR, text);
+    EXPECT_TRUE(error.isHeapAllocated());
+    EXPECT_EQ(std::string(error.message()), text);
+    EXPECT_EQ(error.messageSize(), 100U);
+}
+
+TEST_F(RichErrorTest, Payload)
+{
+    const RichError error = RichError::withPayload(Status::ERROR, static_cast<std::int32_t>(ENOENT));
+    EXPECT_TRUE(error.hasPayload());
+    std::int32_t code = 0;
+    EXPECT_TRUE(error.getPayload(code));
+    EXPECT_EQ(code, ENOENT);
+    std::uint64_t wrongSize = 0U;
+    EXPECT_FALSE(error.getPayload(wrongSize));
+}
+
+TEST_F(RichErrorTest, CopyHeapMessage)
+{
+    const RichError original(Status::ERROR, std::string(64, 'y'));
+    const RichError copy(original);
+    EXPECT_TRUE(copy.isHeapAllocated());
+    EXPECT_NE(copy.message(), original.message());
+    EXPECT_STREQ(copy.message(), original.message());
+}
+
+TEST_F(RichErrorTest, MoveHeapMessage)
+{
+    RichError original(Status::ERROR, std::string(64, 'y'));
+    const char* data = original.message();
+    const RichError moved(std::move(original));
+    EXPECT_EQ(moved.message(), data);
+    EXPECT_FALSE(original.hasMessage());
+}
+
+TEST_F(RichErrorTest, Assignment)
+{
+    RichError error(Status::ERROR, std::string(64, 'y'));
+    error = RichError(Status::INVALID_ARG, "inline");
+    EXPECT_EQ(error.code(), Status::INVALID_ARG);
+    EXPECT_STREQ(error.message(), "inline");
+
+    const RichError other(Status::ERROR, std::string(32, 'z'));
+    error = other;
+    EXPECT_STREQ(error.message(), other.message());
+}
+
+/// @brief Memory resource without `std::pmr`, counting the blocks it holds.
+struct CountingResource
+{
+    void* allocate(std::size_t bytes, std::size_t /* alignment */)
+    {
+        ++blocks_;
+        return ::operator new(bytes);
+    }
+
+    void deallocate(void* block, std::size_t /* bytes */, std::size_t /* alignment */) noexcept
+    {
+        --blocks_;
+        ::operator delete(block);
+    }
+
+    int blocks_{0};
+};
+
+TEST_F(RichErrorTest, MessageFromMemoryResource)
+{
+    CountingResource resource;
+    {
+        const RichError error(Status::ERROR, std::string(64, 'y'), RichError::allocator_type(&resource));
+        EXPECT_EQ(resource.blocks_, 1);
+        EXPECT_EQ(error.get_allocator(), RichError::allocator_type(&resource));
+
+        // The copy allocates from the global heap, the assignment from the resource of the assigned error
+        RichError copy(error);
+        EXPECT_EQ(resource.blocks_, 1);
+        EXPECT_EQ(copy.get_allocator(), RichError::allocator_type());
+        RichError assigned(Status::INVALID_ARG, std::string(32, 'z'), RichError::allocator_type(&resource));
+        assigned = copy;
+        EXPECT_EQ(resource.blocks_, 2);
+        EXPECT_STREQ(assigned.message(), error.message());
+        EXPECT_EQ(assigned.get_allocator(), RichError::allocator_type(&resource));
+    }
+    EXPECT_EQ(resource.blocks_, 0);
+}
+
+// Result with a custom error type:
+Result<std::uint32_t, RichError> parseDigit(char character)
+{
+    if ((character < '0') || (character > '9'))
+    {
+        return createError(RichError(Status::INVALID_ARG, "not a digit"));
+    }
+    return static_cast<std::uint32_t>(character - '0');
+}
+
+TEST_F(RichErrorTest, ResultWithRichError)
+{
+    const auto success = parseDigit('7');
+    EXPECT_EQ(success.getValue(), 7U);
+
+    const auto failure = parseDigit('x');
+    ASSERT_FALSE(failure.hasValue());
+    EXPECT_EQ(failure.getError().code(), Status::INVALID_ARG);
+    EXPECT_STREQ(failure.getError().message(), "not a digit");
+}
+
+TEST_F(RichErrorTest, ResultFromStatus)
+{
+    const Result<std::uint32_t, RichError> result = createError(Status::ERROR);
+    EXPECT_EQ(result.getError().code(), Status::ERROR);
+}
+
+TEST_F(RichErrorTest, ResultFromLValueError)
+{
+    const RichError error(Status::ERROR, "lvalue");
+    const Result<std::string, RichError> fromCreate = createError(error);
+    const Result<std::string, RichError> fromError(error);
+    EXPECT_STREQ(fromCreate.getError().message(), "lvalue");
+    EXPECT_STREQ(fromError.getError().message(), "lvalue");
+}
+
+TEST_F(RichErrorTest, MapErrorToRichError)
+{
+    const Result<std::uint32_t> result(Status::INVALID_ARG);
+    const Result<std::uint32_t, RichError> mapped =
+        result.mapError([](Status status) { return RichError(status, "while parsing"); });
+    EXPECT_EQ(mapped.getError().code(), Status::INVALID_ARG);
+    EXPECT_STREQ(mapped.getError().message(), "while parsing");
+}
+
+}  // namespace test
+}  // namespace library
+}  // namespace interview